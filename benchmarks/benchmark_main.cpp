@@ -0,0 +1,29 @@
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#include "benchmarks/benchmarks.hpp"
+
+using data_structures::perf::benchmark_options;
+using data_structures::perf::benchmark_runner;
+
+// Usage: DataStructure_Benchmarks [--repetitions=N] [--filter=substring]
+int main(int argc, char** argv) {
+    benchmark_options options;
+    for(int index = 1; index < argc; ++index) {
+        if(std::strncmp(argv[index], "--repetitions=", 14) == 0) {
+            options.repetitions = static_cast<unsigned int>(std::strtoul(argv[index] + 14, nullptr, 10));
+        }
+        else if(std::strncmp(argv[index], "--filter=", 9) == 0) {
+            options.filter = argv[index] + 9;
+        }
+        else {
+            std::cerr << "Usage: " << argv[0] << " [--repetitions=N] [--filter=substring]\n";
+            return 1;
+        }
+    }
+    benchmark_runner runner(options);
+    benchmarks::run_dynamic_array_benchmarks(runner);
+    runner.report(std::cout);
+    return 0;
+}
@@ -0,0 +1,11 @@
+#ifndef DATA_STRUCTURES_BENCHMARKS_BENCHMARKS_HPP
+#define DATA_STRUCTURES_BENCHMARKS_BENCHMARKS_HPP
+
+#include "data_structures/src/perf/benchmark_runner.hpp"
+
+// Each container's benchmarks live in their own file and are listed here and in main.
+namespace benchmarks {
+    void run_dynamic_array_benchmarks(data_structures::perf::benchmark_runner& runner);
+}
+
+#endif
@@ -0,0 +1,89 @@
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "benchmarks/benchmarks.hpp"
+#include "data_structures/src/linear/dynamic_array.hpp"
+
+using data_structures::linear::dynamic_array;
+using data_structures::perf::benchmark_runner;
+using data_structures::perf::do_not_optimize;
+
+namespace {
+    // Each benchmark runs against dynamic_array and std::vector so a change can be judged
+    // against the standard container on the same host and counters.
+    template<class Container>
+    void run_container_benchmarks(benchmark_runner& runner, const std::string& prefix) {
+        constexpr unsigned long append_count = 1ul << 20;
+        constexpr unsigned long table_size = 1ul << 22;
+        constexpr unsigned long lookup_count = 1ul << 20;
+        constexpr unsigned long middle_insert_count = 1ul << 12;
+
+        runner.run(prefix + "/push_back", append_count, [&]() {
+            Container values;
+            for(unsigned long index = 0; index < append_count; ++index) {
+                values.push_back(static_cast<std::uint32_t>(index));
+            }
+            do_not_optimize(values.data());
+        });
+
+        runner.run(prefix + "/push_back_reserved", append_count, [&]() {
+            Container values;
+            values.reserve(append_count);
+            for(unsigned long index = 0; index < append_count; ++index) {
+                values.push_back(static_cast<std::uint32_t>(index));
+            }
+            do_not_optimize(values.data());
+        });
+
+        Container table;
+        for(unsigned long index = 0; index < table_size; ++index) {
+            table.push_back(static_cast<std::uint32_t>(index * 2654435761u));
+        }
+
+        runner.run(prefix + "/sequential_sum", table_size, [&]() {
+            std::uint64_t sum = 0;
+            for(auto iterator = table.begin(); iterator != table.end(); ++iterator) {
+                sum += *iterator;
+            }
+            do_not_optimize(sum);
+        });
+
+        // Indices are drawn up front so the measured loop is the dependent loads alone; a
+        // table larger than the last level cache makes most of them misses.
+        std::vector<std::uint32_t> indices(lookup_count);
+        std::mt19937 generator(42);
+        std::uniform_int_distribution<std::uint32_t> distribution(0, table_size - 1);
+        for(std::uint32_t& index : indices) {
+            index = distribution(generator);
+        }
+        runner.run(prefix + "/random_access", lookup_count, [&]() {
+            std::uint64_t sum = 0;
+            for(std::uint32_t index : indices) {
+                sum += table[index];
+            }
+            do_not_optimize(sum);
+        });
+
+        runner.run(prefix + "/copy", table_size, [&]() {
+            Container copy = table;
+            do_not_optimize(copy.data());
+        });
+
+        runner.run(prefix + "/insert_middle", middle_insert_count, [&]() {
+            Container values;
+            for(unsigned long index = 0; index < middle_insert_count; ++index) {
+                values.insert(values.cbegin() + values.size() / 2, static_cast<std::uint32_t>(index));
+            }
+            do_not_optimize(values.data());
+        });
+    }
+}
+
+namespace benchmarks {
+    void run_dynamic_array_benchmarks(benchmark_runner& runner) {
+        run_container_benchmarks<dynamic_array<std::uint32_t>>(runner, "dynamic_array");
+        run_container_benchmarks<std::vector<std::uint32_t>>(runner, "std::vector");
+    }
+}
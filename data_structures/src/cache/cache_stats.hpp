@@ -0,0 +1,25 @@
+#ifndef DATA_STRUCTURES_CACHE_CACHE_STATS_HPP
+#define DATA_STRUCTURES_CACHE_CACHE_STATS_HPP
+
+#include <cstdint>
+
+namespace data_structures {
+    namespace cache {
+
+        struct cache_stats {
+            std::uint64_t hits = 0;
+            std::uint64_t misses = 0;
+            std::uint64_t insertions = 0;
+            std::uint64_t evictions = 0;
+
+            double hit_rate() const noexcept {
+                std::uint64_t lookups = hits + misses;
+                return lookups == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(lookups);
+            }
+
+            bool operator==(const cache_stats& other) const = default;
+        };
+    }
+}
+
+#endif
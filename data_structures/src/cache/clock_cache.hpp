@@ -0,0 +1,204 @@
+#ifndef DATA_STRUCTURES_CACHE_CLOCK_CACHE_HPP
+#define DATA_STRUCTURES_CACHE_CLOCK_CACHE_HPP
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "data_structures/src/cache/cache_stats.hpp"
+#include "data_structures/src/linear/bit_array.hpp"
+#include "data_structures/src/linear/dynamic_array.hpp"
+#include "data_structures/src/map/hash_index.hpp"
+
+namespace data_structures {
+    namespace cache {
+
+        // CLOCK (second chance) approximation of LRU. A hit only sets the entry's referenced
+        // bit, so lookups never write to the entries themselves; the hand sweeps the slots on
+        // eviction, clearing referenced bits until it reaches an entry that was not used since
+        // its last pass. New entries start unreferenced, so keys seen only once tend to go
+        // first and a scan displaces fewer hot entries than under LRU. A scan long enough to
+        // carry the hand round the slots still clears their referenced bits and evicts them.
+        template<class Key, class Value, class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>>
+        class clock_cache {
+            public:
+                using key_type = Key;
+                using mapped_type = Value;
+                using size_type = unsigned long;
+
+            private:
+                using slot_type = std::uint32_t;
+
+                static constexpr slot_type null_slot = std::numeric_limits<slot_type>::max();
+
+                struct entry {
+                    Key key;
+                    Value value;
+                };
+
+                linear::dynamic_array<entry, std::allocator<entry>, linear::no_instrumentation, linear::unchecked> entries_;
+                linear::bit_array referenced_;
+                map::hash_index<Key, Hash, KeyEqual> index_;
+                size_type capacity_;
+                size_type hand_ = 0;
+                cache_stats stats_;
+
+                auto key_at() const {
+                    return [this](slot_type slot) -> const Key& { return entries_[slot].key; };
+                }
+
+                slot_type advance_hand() noexcept {
+                    while(referenced_[hand_]) {
+                        referenced_.reset(hand_);
+                        hand_ = hand_ + 1 == entries_.size() ? 0 : hand_ + 1;
+                    }
+                    slot_type victim = static_cast<slot_type>(hand_);
+                    hand_ = hand_ + 1 == entries_.size() ? 0 : hand_ + 1;
+                    return victim;
+                }
+
+                template<class K, class V>
+                Value& insert_new(std::uint64_t hash, K&& key, V&& value) {
+                    slot_type slot;
+                    if(entries_.size() < capacity_) {
+                        slot = static_cast<slot_type>(entries_.size());
+                        entries_.push_back(entry{std::forward<K>(key), std::forward<V>(value)});
+                        referenced_.push_back(false);
+                    }
+                    else {
+                        slot = advance_hand();
+                        index_.erase(entries_[slot].key, key_at());
+                        entries_[slot].key = std::forward<K>(key);
+                        entries_[slot].value = std::forward<V>(value);
+                        ++stats_.evictions;
+                    }
+                    index_.insert(hash, slot);
+                    ++stats_.insertions;
+                    return entries_[slot].value;
+                }
+
+            public:
+                explicit clock_cache(size_type capacity, const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual())
+                    : index_(hash, equal), capacity_(capacity) {
+                    if(capacity == 0 || capacity >= null_slot) {
+                        throw std::invalid_argument("Cache capacity " + std::to_string(capacity) + " must be between 1 and 2^32 - 2.");
+                    }
+                    entries_.reserve_exact(capacity);
+                    index_.reserve(capacity);
+                }
+
+                // Counts a hit or a miss and marks the entry as referenced.
+                Value* find(const Key& key) {
+                    slot_type slot = index_.find(key, key_at());
+                    if(slot == null_slot) {
+                        ++stats_.misses;
+                        return nullptr;
+                    }
+                    ++stats_.hits;
+                    referenced_.set(slot);
+                    return &entries_[slot].value;
+                }
+
+                // Looks an entry up without marking it or changing the counters.
+                const Value* peek(const Key& key) const {
+                    slot_type slot = index_.find(key, key_at());
+                    return slot == null_slot ? nullptr : &entries_[slot].value;
+                }
+
+                bool contains(const Key& key) const {
+                    return index_.find(key, key_at()) != null_slot;
+                }
+
+                template<class V>
+                Value& put(const Key& key, V&& value) {
+                    std::uint64_t hash = index_.hash(key);
+                    slot_type slot = index_.find(key, hash, key_at());
+                    if(slot != null_slot) {
+                        entries_[slot].value = std::forward<V>(value);
+                        referenced_.set(slot);
+                        return entries_[slot].value;
+                    }
+                    return insert_new(hash, key, std::forward<V>(value));
+                }
+
+                template<class Factory>
+                Value& get_or_insert(const Key& key, Factory&& make) {
+                    std::uint64_t hash = index_.hash(key);
+                    slot_type slot = index_.find(key, hash, key_at());
+                    if(slot != null_slot) {
+                        ++stats_.hits;
+                        referenced_.set(slot);
+                        return entries_[slot].value;
+                    }
+                    ++stats_.misses;
+                    return insert_new(hash, key, make());
+                }
+
+                // The last entry is moved into the freed slot so the entries stay contiguous.
+                bool erase(const Key& key) {
+                    slot_type slot = index_.erase(key, key_at());
+                    if(slot == null_slot) {
+                        return false;
+                    }
+                    slot_type last = static_cast<slot_type>(entries_.size() - 1);
+                    if(slot != last) {
+                        entries_[slot] = std::move(entries_[last]);
+                        referenced_.set(slot, referenced_[last]);
+                        index_.relocate(index_.hash(entries_[slot].key), last, slot);
+                    }
+                    entries_.pop_back();
+                    referenced_.resize(last);
+                    if(hand_ >= entries_.size()) {
+                        hand_ = 0;
+                    }
+                    return true;
+                }
+
+                template<class Function>
+                void for_each(Function&& function) const {
+                    for(size_type slot = 0; slot < entries_.size(); ++slot) {
+                        function(entries_[slot].key, entries_[slot].value);
+                    }
+                }
+
+                void clear() {
+                    entries_.clear();
+                    referenced_.clear();
+                    index_.clear();
+                    hand_ = 0;
+                }
+
+                size_type size() const noexcept {
+                    return entries_.size();
+                }
+
+                size_type capacity() const noexcept {
+                    return capacity_;
+                }
+
+                // Entry slots allocated up front; always exactly capacity(), so a full cache
+                // never holds more memory than it was sized for.
+                size_type storage_capacity() const noexcept {
+                    return entries_.capacity();
+                }
+
+                [[nodiscard]] bool empty() const noexcept {
+                    return entries_.size() == 0;
+                }
+
+                const cache_stats& stats() const noexcept {
+                    return stats_;
+                }
+
+                void reset_stats() noexcept {
+                    stats_ = cache_stats();
+                }
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,237 @@
+#ifndef DATA_STRUCTURES_CACHE_LRU_CACHE_HPP
+#define DATA_STRUCTURES_CACHE_LRU_CACHE_HPP
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "data_structures/src/cache/cache_stats.hpp"
+#include "data_structures/src/linear/dynamic_array.hpp"
+#include "data_structures/src/map/hash_index.hpp"
+
+namespace data_structures {
+    namespace cache {
+
+        // Least recently used cache with a fixed capacity. Entries live in one dynamic_array
+        // reserved up front and are chained into the recency list by 32 bit indices, so the
+        // cache never allocates after construction and an eviction reuses the evicted slot.
+        template<class Key, class Value, class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>>
+        class lru_cache {
+            public:
+                using key_type = Key;
+                using mapped_type = Value;
+                using size_type = unsigned long;
+
+            private:
+                using link_type = std::uint32_t;
+
+                static constexpr link_type null_link = std::numeric_limits<link_type>::max();
+
+                struct entry {
+                    Key key;
+                    Value value;
+                    link_type previous;
+                    link_type next;
+                };
+
+                linear::dynamic_array<entry, std::allocator<entry>, linear::no_instrumentation, linear::unchecked> entries_;
+                map::hash_index<Key, Hash, KeyEqual> index_;
+                size_type capacity_;
+                link_type head_ = null_link;
+                link_type tail_ = null_link;
+                cache_stats stats_;
+
+                auto key_at() const {
+                    return [this](link_type slot) -> const Key& { return entries_[slot].key; };
+                }
+
+                void unlink(link_type slot) noexcept {
+                    entry& removed = entries_[slot];
+                    if(removed.previous != null_link) {
+                        entries_[removed.previous].next = removed.next;
+                    }
+                    else {
+                        head_ = removed.next;
+                    }
+                    if(removed.next != null_link) {
+                        entries_[removed.next].previous = removed.previous;
+                    }
+                    else {
+                        tail_ = removed.previous;
+                    }
+                }
+
+                void link_front(link_type slot) noexcept {
+                    entries_[slot].previous = null_link;
+                    entries_[slot].next = head_;
+                    if(head_ != null_link) {
+                        entries_[head_].previous = slot;
+                    }
+                    else {
+                        tail_ = slot;
+                    }
+                    head_ = slot;
+                }
+
+                void touch(link_type slot) noexcept {
+                    if(slot != head_) {
+                        unlink(slot);
+                        link_front(slot);
+                    }
+                }
+
+                template<class K, class V>
+                Value& insert_new(std::uint64_t hash, K&& key, V&& value) {
+                    link_type slot;
+                    if(entries_.size() < capacity_) {
+                        slot = static_cast<link_type>(entries_.size());
+                        entries_.push_back(entry{std::forward<K>(key), std::forward<V>(value), null_link, null_link});
+                    }
+                    else {
+                        slot = tail_;
+                        index_.erase(entries_[slot].key, key_at());
+                        unlink(slot);
+                        entries_[slot].key = std::forward<K>(key);
+                        entries_[slot].value = std::forward<V>(value);
+                        ++stats_.evictions;
+                    }
+                    index_.insert(hash, slot);
+                    link_front(slot);
+                    ++stats_.insertions;
+                    return entries_[slot].value;
+                }
+
+            public:
+                explicit lru_cache(size_type capacity, const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual())
+                    : index_(hash, equal), capacity_(capacity) {
+                    if(capacity == 0 || capacity >= null_link) {
+                        throw std::invalid_argument("Cache capacity " + std::to_string(capacity) + " must be between 1 and 2^32 - 2.");
+                    }
+                    entries_.reserve_exact(capacity);
+                    index_.reserve(capacity);
+                }
+
+                // Counts a hit or a miss and marks the entry as most recently used.
+                Value* find(const Key& key) {
+                    link_type slot = index_.find(key, key_at());
+                    if(slot == null_link) {
+                        ++stats_.misses;
+                        return nullptr;
+                    }
+                    ++stats_.hits;
+                    touch(slot);
+                    return &entries_[slot].value;
+                }
+
+                // Looks an entry up without changing its recency or the counters.
+                const Value* peek(const Key& key) const {
+                    link_type slot = index_.find(key, key_at());
+                    return slot == null_link ? nullptr : &entries_[slot].value;
+                }
+
+                bool contains(const Key& key) const {
+                    return index_.find(key, key_at()) != null_link;
+                }
+
+                template<class V>
+                Value& put(const Key& key, V&& value) {
+                    std::uint64_t hash = index_.hash(key);
+                    link_type slot = index_.find(key, hash, key_at());
+                    if(slot != null_link) {
+                        entries_[slot].value = std::forward<V>(value);
+                        touch(slot);
+                        return entries_[slot].value;
+                    }
+                    return insert_new(hash, key, std::forward<V>(value));
+                }
+
+                template<class Factory>
+                Value& get_or_insert(const Key& key, Factory&& make) {
+                    std::uint64_t hash = index_.hash(key);
+                    link_type slot = index_.find(key, hash, key_at());
+                    if(slot != null_link) {
+                        ++stats_.hits;
+                        touch(slot);
+                        return entries_[slot].value;
+                    }
+                    ++stats_.misses;
+                    return insert_new(hash, key, make());
+                }
+
+                // The last entry is moved into the freed slot so the entries stay contiguous.
+                bool erase(const Key& key) {
+                    link_type slot = index_.erase(key, key_at());
+                    if(slot == null_link) {
+                        return false;
+                    }
+                    unlink(slot);
+                    link_type last = static_cast<link_type>(entries_.size() - 1);
+                    if(slot != last) {
+                        entries_[slot] = std::move(entries_[last]);
+                        entry& moved = entries_[slot];
+                        if(moved.previous != null_link) {
+                            entries_[moved.previous].next = slot;
+                        }
+                        else {
+                            head_ = slot;
+                        }
+                        if(moved.next != null_link) {
+                            entries_[moved.next].previous = slot;
+                        }
+                        else {
+                            tail_ = slot;
+                        }
+                        index_.relocate(index_.hash(moved.key), last, slot);
+                    }
+                    entries_.pop_back();
+                    return true;
+                }
+
+                template<class Function>
+                void for_each(Function&& function) const {
+                    for(link_type slot = head_; slot != null_link; slot = entries_[slot].next) {
+                        function(entries_[slot].key, entries_[slot].value);
+                    }
+                }
+
+                void clear() {
+                    entries_.clear();
+                    index_.clear();
+                    head_ = null_link;
+                    tail_ = null_link;
+                }
+
+                size_type size() const noexcept {
+                    return entries_.size();
+                }
+
+                size_type capacity() const noexcept {
+                    return capacity_;
+                }
+
+                // Entry slots allocated up front; always exactly capacity(), so a full cache
+                // never holds more memory than it was sized for.
+                size_type storage_capacity() const noexcept {
+                    return entries_.capacity();
+                }
+
+                [[nodiscard]] bool empty() const noexcept {
+                    return entries_.size() == 0;
+                }
+
+                const cache_stats& stats() const noexcept {
+                    return stats_;
+                }
+
+                void reset_stats() noexcept {
+                    stats_ = cache_stats();
+                }
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,197 @@
+#ifndef DATA_STRUCTURES_CONCURRENT_EPOCH_RECLAIMER_HPP
+#define DATA_STRUCTURES_CONCURRENT_EPOCH_RECLAIMER_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <utility>
+
+#include "data_structures/src/concurrent/retire_list.hpp"
+#include "data_structures/src/concurrent/thread_registry.hpp"
+
+namespace data_structures {
+    namespace concurrent {
+
+        // Epoch based reclamation. Threads register once and pin the domain around every access
+        // to a shared structure; a pinned thread publishes the global epoch it observed. The
+        // global epoch only advances once every pinned thread has observed the current one, so
+        // when it reaches e + 2 no thread can still hold a pointer it loaded before something
+        // was retired in epoch e. Retired objects are tagged with their epoch and freed in
+        // batches once a thread's list reaches batch_size. Pins are cheap, but a thread that
+        // stays pinned holds back reclamation for everyone; long held references belong in
+        // hazard pointers instead.
+        class epoch_domain {
+            public:
+                using size_type = unsigned long;
+
+                static constexpr size_type default_batch_size = 64;
+
+            private:
+                static constexpr std::uint64_t inactive = std::numeric_limits<std::uint64_t>::max();
+
+                struct alignas(64) participant {
+                    std::atomic<std::uint64_t> epoch{inactive};
+                    unsigned int pin_depth = 0;
+                    retire_list retired;
+                };
+
+                alignas(64) std::atomic<std::uint64_t> epoch_{0};
+                thread_registry<participant> registry_;
+                std::mutex orphan_mutex_;
+                retire_list orphans_;
+                size_type batch_size_;
+
+                bool try_advance() {
+                    std::uint64_t current = epoch_.load(std::memory_order_seq_cst);
+                    bool blocked = false;
+                    registry_.for_each([&](participant& other) {
+                        std::uint64_t observed = other.epoch.load(std::memory_order_seq_cst);
+                        blocked = blocked || (observed != inactive && observed != current);
+                    });
+                    return !blocked && epoch_.compare_exchange_strong(current, current + 1, std::memory_order_seq_cst);
+                }
+
+                size_type collect(participant& owner) {
+                    {
+                        std::unique_lock lock(orphan_mutex_, std::try_to_lock);
+                        if(lock.owns_lock() && !orphans_.empty()) {
+                            owner.retired.splice(orphans_);
+                        }
+                    }
+                    try_advance();
+                    std::uint64_t current = epoch_.load(std::memory_order_seq_cst);
+                    return owner.retired.reclaim_if([current](const retired_object& object) {
+                        return object.tag + 2 <= current;
+                    });
+                }
+
+            public:
+                class guard;
+
+                // A thread's membership in the domain. Handles are not shared between threads;
+                // destroying one hands any objects it could not free yet to the domain.
+                class thread_handle {
+                    public:
+                        thread_handle() = default;
+
+                        thread_handle(const thread_handle&) = delete;
+                        thread_handle& operator=(const thread_handle&) = delete;
+
+                        thread_handle(thread_handle&& other) noexcept : domain_(std::exchange(other.domain_, nullptr)), self_(std::exchange(other.self_, nullptr)) {}
+
+                        thread_handle& operator=(thread_handle&& other) noexcept {
+                            if(this != &other) {
+                                unregister();
+                                domain_ = std::exchange(other.domain_, nullptr);
+                                self_ = std::exchange(other.self_, nullptr);
+                            }
+                            return *this;
+                        }
+
+                        ~thread_handle() {
+                            unregister();
+                        }
+
+                        // Pins are reentrant; only the outermost one publishes an epoch.
+                        [[nodiscard]] guard pin() {
+                            if(self_->pin_depth++ == 0) {
+                                self_->epoch.store(domain_->epoch_.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+                            }
+                            return guard(self_);
+                        }
+
+                        bool is_pinned() const noexcept {
+                            return self_->pin_depth > 0;
+                        }
+
+                        // Call after pointer has been unlinked so no new reader can load it.
+                        void retire(void* pointer, void (*deleter)(void*)) {
+                            self_->retired.push(pointer, deleter, domain_->epoch_.load(std::memory_order_seq_cst));
+                            if(self_->retired.size() >= domain_->batch_size_) {
+                                domain_->collect(*self_);
+                            }
+                        }
+
+                        template<class T>
+                        void retire(T* pointer) {
+                            retire(pointer, &delete_retired<T>);
+                        }
+
+                        // Tries to advance the epoch and frees what has become safe, returning the
+                        // number of objects freed.
+                        size_type collect() {
+                            return domain_->collect(*self_);
+                        }
+
+                        size_type pending() const noexcept {
+                            return self_->retired.size();
+                        }
+
+                    private:
+                        friend class epoch_domain;
+
+                        epoch_domain* domain_ = nullptr;
+                        participant* self_ = nullptr;
+
+                        thread_handle(epoch_domain* domain, participant* self) : domain_(domain), self_(self) {}
+
+                        void unregister() {
+                            if(self_ == nullptr) {
+                                return;
+                            }
+                            self_->pin_depth = 0;
+                            self_->epoch.store(inactive, std::memory_order_seq_cst);
+                            domain_->collect(*self_);
+                            if(!self_->retired.empty()) {
+                                std::lock_guard lock(domain_->orphan_mutex_);
+                                domain_->orphans_.splice(self_->retired);
+                            }
+                            domain_->registry_.release(self_);
+                            self_ = nullptr;
+                            domain_ = nullptr;
+                        }
+                };
+
+                // Keeps the owning thread pinned while it is alive.
+                class guard {
+                    public:
+                        guard(const guard&) = delete;
+                        guard& operator=(const guard&) = delete;
+
+                        guard(guard&& other) noexcept : self_(std::exchange(other.self_, nullptr)) {}
+
+                        ~guard() {
+                            if(self_ != nullptr && --self_->pin_depth == 0) {
+                                self_->epoch.store(inactive, std::memory_order_release);
+                            }
+                        }
+
+                    private:
+                        friend class thread_handle;
+
+                        participant* self_;
+
+                        explicit guard(participant* self) noexcept : self_(self) {}
+                };
+
+                explicit epoch_domain(size_type batch_size = default_batch_size) : batch_size_(batch_size) {}
+
+                epoch_domain(const epoch_domain&) = delete;
+                epoch_domain& operator=(const epoch_domain&) = delete;
+
+                // Every thread_handle must be gone; whatever is still retired is freed here.
+                ~epoch_domain() = default;
+
+                thread_handle register_thread() {
+                    return thread_handle(this, registry_.acquire());
+                }
+
+                std::uint64_t epoch() const noexcept {
+                    return epoch_.load(std::memory_order_acquire);
+                }
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,202 @@
+#ifndef DATA_STRUCTURES_CONCURRENT_HAZARD_POINTER_HPP
+#define DATA_STRUCTURES_CONCURRENT_HAZARD_POINTER_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "data_structures/src/concurrent/retire_list.hpp"
+#include "data_structures/src/concurrent/thread_registry.hpp"
+#include "data_structures/src/linear/dynamic_array.hpp"
+
+namespace data_structures {
+    namespace concurrent {
+
+        // Hazard pointers. Each registered thread owns SlotCount slots in which it publishes the
+        // pointers it is about to dereference; a retired object is freed only once no slot
+        // holds it. Protecting a pointer costs a store and a reload per access, more than an
+        // epoch pin, but a protected reference can be held for as long as needed without
+        // holding back reclamation of anything else. A thread scans all slots once its retire
+        // list reaches the larger of batch_size and twice the number of slots in the domain,
+        // which keeps the amortized cost of a scan constant per retired object.
+        template<unsigned int SlotCount = 2>
+        class hazard_domain {
+            static_assert(SlotCount > 0, "A hazard domain needs at least one slot per thread.");
+
+            public:
+                using size_type = unsigned long;
+
+                static constexpr size_type default_batch_size = 64;
+                static constexpr unsigned int slot_count = SlotCount;
+
+            private:
+                struct alignas(64) participant {
+                    std::array<std::atomic<void*>, SlotCount> hazards{};
+                    retire_list retired;
+                };
+
+                thread_registry<participant> registry_;
+                std::mutex orphan_mutex_;
+                retire_list orphans_;
+                size_type batch_size_;
+
+                size_type scan_threshold() const noexcept {
+                    return std::max<size_type>(batch_size_, 2 * SlotCount * registry_.record_count());
+                }
+
+                size_type scan(participant& owner) {
+                    {
+                        std::unique_lock lock(orphan_mutex_, std::try_to_lock);
+                        if(lock.owns_lock() && !orphans_.empty()) {
+                            owner.retired.splice(orphans_);
+                        }
+                    }
+                    linear::dynamic_array<void*, std::allocator<void*>, linear::no_instrumentation, linear::unchecked> hazards;
+                    registry_.for_each([&](participant& other) {
+                        for(std::atomic<void*>& slot : other.hazards) {
+                            void* value = slot.load(std::memory_order_seq_cst);
+                            if(value != nullptr) {
+                                hazards.push_back(value);
+                            }
+                        }
+                    });
+                    void** first = hazards.data();
+                    void** last = first + hazards.size();
+                    std::sort(first, last);
+                    return owner.retired.reclaim_if([first, last](const retired_object& object) {
+                        return !std::binary_search(first, last, object.pointer);
+                    });
+                }
+
+            public:
+                // A thread's membership in the domain and its slots. Handles are not shared
+                // between threads; destroying one clears its slots and hands any objects that
+                // are still protected elsewhere to the domain.
+                class thread_handle {
+                    public:
+                        thread_handle() = default;
+
+                        thread_handle(const thread_handle&) = delete;
+                        thread_handle& operator=(const thread_handle&) = delete;
+
+                        thread_handle(thread_handle&& other) noexcept : domain_(std::exchange(other.domain_, nullptr)), self_(std::exchange(other.self_, nullptr)) {}
+
+                        thread_handle& operator=(thread_handle&& other) noexcept {
+                            if(this != &other) {
+                                unregister();
+                                domain_ = std::exchange(other.domain_, nullptr);
+                                self_ = std::exchange(other.self_, nullptr);
+                            }
+                            return *this;
+                        }
+
+                        ~thread_handle() {
+                            unregister();
+                        }
+
+                        // Loads source into slot and returns the value once the slot is known to
+                        // have been published before the value could be retired.
+                        template<class T>
+                        T* protect(unsigned int slot, const std::atomic<T*>& source) {
+                            std::atomic<void*>& hazard = hazard_slot(slot);
+                            T* value = source.load(std::memory_order_relaxed);
+                            while(true) {
+                                hazard.store(value, std::memory_order_seq_cst);
+                                T* reloaded = source.load(std::memory_order_seq_cst);
+                                if(reloaded == value) {
+                                    return value;
+                                }
+                                value = reloaded;
+                            }
+                        }
+
+                        // Publishes a pointer that is already protected, such as one held in
+                        // another slot, for hand over hand traversal.
+                        void set(unsigned int slot, void* pointer) {
+                            hazard_slot(slot).store(pointer, std::memory_order_seq_cst);
+                        }
+
+                        void reset(unsigned int slot) {
+                            hazard_slot(slot).store(nullptr, std::memory_order_release);
+                        }
+
+                        void reset_all() noexcept {
+                            for(std::atomic<void*>& hazard : self_->hazards) {
+                                hazard.store(nullptr, std::memory_order_release);
+                            }
+                        }
+
+                        // Call after pointer has been unlinked so no new reader can load it.
+                        void retire(void* pointer, void (*deleter)(void*)) {
+                            self_->retired.push(pointer, deleter, 0);
+                            if(self_->retired.size() >= domain_->scan_threshold()) {
+                                domain_->scan(*self_);
+                            }
+                        }
+
+                        template<class T>
+                        void retire(T* pointer) {
+                            retire(pointer, &delete_retired<T>);
+                        }
+
+                        // Frees every retired object no slot protects, returning how many.
+                        size_type collect() {
+                            return domain_->scan(*self_);
+                        }
+
+                        size_type pending() const noexcept {
+                            return self_->retired.size();
+                        }
+
+                    private:
+                        friend class hazard_domain;
+
+                        hazard_domain* domain_ = nullptr;
+                        participant* self_ = nullptr;
+
+                        thread_handle(hazard_domain* domain, participant* self) : domain_(domain), self_(self) {}
+
+                        std::atomic<void*>& hazard_slot(unsigned int slot) {
+                            if(slot >= SlotCount) {
+                                throw std::out_of_range("Hazard slot " + std::to_string(slot) + " is out of range for a domain with " + std::to_string(SlotCount) + " slots per thread.");
+                            }
+                            return self_->hazards[slot];
+                        }
+
+                        void unregister() {
+                            if(self_ == nullptr) {
+                                return;
+                            }
+                            reset_all();
+                            domain_->scan(*self_);
+                            if(!self_->retired.empty()) {
+                                std::lock_guard lock(domain_->orphan_mutex_);
+                                domain_->orphans_.splice(self_->retired);
+                            }
+                            domain_->registry_.release(self_);
+                            self_ = nullptr;
+                            domain_ = nullptr;
+                        }
+                };
+
+                explicit hazard_domain(size_type batch_size = default_batch_size) : batch_size_(batch_size) {}
+
+                hazard_domain(const hazard_domain&) = delete;
+                hazard_domain& operator=(const hazard_domain&) = delete;
+
+                // Every thread_handle must be gone; whatever is still retired is freed here.
+                ~hazard_domain() = default;
+
+                thread_handle register_thread() {
+                    return thread_handle(this, registry_.acquire());
+                }
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,106 @@
+#ifndef DATA_STRUCTURES_CONCURRENT_RETIRE_LIST_HPP
+#define DATA_STRUCTURES_CONCURRENT_RETIRE_LIST_HPP
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+#include "data_structures/src/linear/dynamic_array.hpp"
+
+namespace data_structures {
+    namespace concurrent {
+
+        // An object unlinked from a shared structure but possibly still read by other threads.
+        // The tag is whatever the reclamation scheme needs to decide when the object is safe
+        // to free, such as the epoch it was retired in.
+        struct retired_object {
+            void* pointer;
+            void (*deleter)(void*);
+            std::uint64_t tag;
+        };
+
+        template<class T>
+        void delete_retired(void* pointer) {
+            delete static_cast<T*>(pointer);
+        }
+
+        // Objects waiting to be freed, kept in retirement order so reclamation frees them in
+        // batches rather than one at a time. Deleters run on the thread that reclaims and must
+        // not retire into the list being reclaimed.
+        class retire_list {
+            public:
+                using size_type = unsigned long;
+
+            private:
+                linear::dynamic_array<retired_object, std::allocator<retired_object>, linear::no_instrumentation, linear::unchecked> objects_;
+
+            public:
+                retire_list() = default;
+
+                retire_list(const retire_list&) = delete;
+                retire_list& operator=(const retire_list&) = delete;
+
+                retire_list(retire_list&& other) noexcept {
+                    objects_.swap(other.objects_);
+                }
+
+                retire_list& operator=(retire_list&& other) noexcept {
+                    objects_.swap(other.objects_);
+                    return *this;
+                }
+
+                // Whoever destroys the list guarantees no thread can still reach its objects.
+                ~retire_list() {
+                    reclaim_all();
+                }
+
+                void push(void* pointer, void (*deleter)(void*), std::uint64_t tag) {
+                    objects_.push_back(retired_object{pointer, deleter, tag});
+                }
+
+                size_type size() const noexcept {
+                    return objects_.size();
+                }
+
+                [[nodiscard]] bool empty() const noexcept {
+                    return objects_.size() == 0;
+                }
+
+                const retired_object& operator[](size_type index) const noexcept {
+                    return objects_[index];
+                }
+
+                // Frees every object for which can_free returns true and keeps the rest in order.
+                template<class Predicate>
+                size_type reclaim_if(Predicate can_free) {
+                    size_type kept = 0;
+                    size_type count = objects_.size();
+                    for(size_type index = 0; index < count; ++index) {
+                        retired_object object = objects_[index];
+                        if(can_free(static_cast<const retired_object&>(object))) {
+                            object.deleter(object.pointer);
+                        }
+                        else {
+                            objects_[kept++] = object;
+                        }
+                    }
+                    objects_.resize_uninitialized(kept);
+                    return count - kept;
+                }
+
+                size_type reclaim_all() {
+                    return reclaim_if([](const retired_object&) { return true; });
+                }
+
+                // Moves every object of other onto the end of this list.
+                void splice(retire_list& other) {
+                    for(size_type index = 0; index < other.objects_.size(); ++index) {
+                        objects_.push_back(other.objects_[index]);
+                    }
+                    other.objects_.clear();
+                }
+        };
+    }
+}
+
+#endif
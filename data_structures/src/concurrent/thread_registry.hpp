@@ -0,0 +1,74 @@
+#ifndef DATA_STRUCTURES_CONCURRENT_THREAD_REGISTRY_HPP
+#define DATA_STRUCTURES_CONCURRENT_THREAD_REGISTRY_HPP
+
+#include <atomic>
+#include <cstddef>
+
+namespace data_structures {
+    namespace concurrent {
+
+        // Per thread records that threads claim when they register with a reclamation domain and
+        // hand back when they leave. Records sit on a lock-free list that only grows while the
+        // registry lives, so a scan can walk it while other threads register, and a released
+        // record is reused by the next thread that registers. Scans visit released records too;
+        // their owners leave them in a state the scan ignores.
+        template<class Record>
+        class thread_registry {
+            private:
+                struct entry : Record {
+                    std::atomic<bool> in_use{true};
+                    entry* next = nullptr;
+                };
+
+                std::atomic<entry*> head_{nullptr};
+                std::atomic<std::size_t> record_count_{0};
+
+            public:
+                thread_registry() = default;
+
+                thread_registry(const thread_registry&) = delete;
+                thread_registry& operator=(const thread_registry&) = delete;
+
+                ~thread_registry() {
+                    entry* current = head_.load(std::memory_order_acquire);
+                    while(current != nullptr) {
+                        entry* next = current->next;
+                        delete current;
+                        current = next;
+                    }
+                }
+
+                Record* acquire() {
+                    for(entry* current = head_.load(std::memory_order_acquire); current != nullptr; current = current->next) {
+                        bool expected = false;
+                        if(!current->in_use.load(std::memory_order_relaxed) && current->in_use.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+                            return current;
+                        }
+                    }
+                    entry* fresh = new entry();
+                    fresh->next = head_.load(std::memory_order_relaxed);
+                    while(!head_.compare_exchange_weak(fresh->next, fresh, std::memory_order_release, std::memory_order_relaxed)) {}
+                    record_count_.fetch_add(1, std::memory_order_relaxed);
+                    return fresh;
+                }
+
+                void release(Record* record) noexcept {
+                    static_cast<entry*>(record)->in_use.store(false, std::memory_order_release);
+                }
+
+                // Number of records ever created, which bounds the number of live threads.
+                std::size_t record_count() const noexcept {
+                    return record_count_.load(std::memory_order_relaxed);
+                }
+
+                template<class Function>
+                void for_each(Function&& function) {
+                    for(entry* current = head_.load(std::memory_order_acquire); current != nullptr; current = current->next) {
+                        function(static_cast<Record&>(*current));
+                    }
+                }
+        };
+    }
+}
+
+#endif
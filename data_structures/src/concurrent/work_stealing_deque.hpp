@@ -0,0 +1,143 @@
+#ifndef DATA_STRUCTURES_CONCURRENT_WORK_STEALING_DEQUE_HPP
+#define DATA_STRUCTURES_CONCURRENT_WORK_STEALING_DEQUE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <type_traits>
+
+namespace data_structures {
+    namespace concurrent {
+
+        // Chase-Lev work stealing deque, after Le et al., "Correct and Efficient Work-Stealing
+        // for Weak Memory Models", with their standalone fences folded into sequentially
+        // consistent accesses of top and bottom so race detectors can follow the
+        // synchronization. One owner thread pushes and pops at the bottom without taking part
+        // in any read-modify-write except when the deque holds a single element; any number of
+        // thieves take from the top with one compare and exchange. The ring grows by doubling.
+        // Thieves may still read a ring after the owner replaces it, so replaced rings are kept
+        // until the deque is destroyed; together they are never larger than the current one.
+        template<class T>
+        class work_stealing_deque {
+            static_assert(std::is_trivially_copyable_v<T>, "Work stealing deques hold trivially copyable values such as task pointers.");
+
+            public:
+                using value_type = T;
+                using size_type = unsigned long;
+
+            private:
+                struct ring {
+                    std::int64_t capacity;
+                    std::unique_ptr<std::atomic<T>[]> slots;
+                    ring* previous;
+
+                    ring(std::int64_t size, ring* older) : capacity(size), slots(new std::atomic<T>[size]), previous(older) {}
+
+                    T get(std::int64_t index) const noexcept {
+                        return slots[index & (capacity - 1)].load(std::memory_order_relaxed);
+                    }
+
+                    void put(std::int64_t index, T value) noexcept {
+                        slots[index & (capacity - 1)].store(value, std::memory_order_relaxed);
+                    }
+                };
+
+                alignas(64) std::atomic<std::int64_t> top_{0};
+                alignas(64) std::atomic<std::int64_t> bottom_{0};
+                std::atomic<ring*> ring_;
+
+                ring* grow(ring* current, std::int64_t bottom, std::int64_t top) {
+                    ring* larger = new ring(current->capacity * 2, current);
+                    for(std::int64_t index = top; index < bottom; ++index) {
+                        larger->put(index, current->get(index));
+                    }
+                    ring_.store(larger, std::memory_order_release);
+                    return larger;
+                }
+
+            public:
+                explicit work_stealing_deque(size_type initial_capacity = 64) : ring_(new ring(static_cast<std::int64_t>(std::bit_ceil(std::max<size_type>(initial_capacity, 2))), nullptr)) {}
+
+                work_stealing_deque(const work_stealing_deque&) = delete;
+                work_stealing_deque& operator=(const work_stealing_deque&) = delete;
+
+                ~work_stealing_deque() {
+                    ring* current = ring_.load(std::memory_order_relaxed);
+                    while(current != nullptr) {
+                        ring* previous = current->previous;
+                        delete current;
+                        current = previous;
+                    }
+                }
+
+                // Owner only.
+                void push(T value) {
+                    std::int64_t bottom = bottom_.load(std::memory_order_relaxed);
+                    std::int64_t top = top_.load(std::memory_order_acquire);
+                    ring* current = ring_.load(std::memory_order_relaxed);
+                    if(bottom - top > current->capacity - 1) {
+                        current = grow(current, bottom, top);
+                    }
+                    current->put(bottom, value);
+                    bottom_.store(bottom + 1, std::memory_order_release);
+                }
+
+                // Owner only. Takes the most recently pushed value.
+                std::optional<T> pop() {
+                    std::int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+                    ring* current = ring_.load(std::memory_order_relaxed);
+                    bottom_.store(bottom, std::memory_order_seq_cst);
+                    std::int64_t top = top_.load(std::memory_order_seq_cst);
+                    if(top > bottom) {
+                        bottom_.store(bottom + 1, std::memory_order_relaxed);
+                        return std::nullopt;
+                    }
+                    T value = current->get(bottom);
+                    if(top == bottom) {
+                        bool won = top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+                        bottom_.store(bottom + 1, std::memory_order_relaxed);
+                        if(!won) {
+                            return std::nullopt;
+                        }
+                    }
+                    return value;
+                }
+
+                // Any thread. Takes the oldest value, or nothing if the deque looked empty or
+                // another thread won the race for it.
+                std::optional<T> steal() {
+                    std::int64_t top = top_.load(std::memory_order_seq_cst);
+                    std::int64_t bottom = bottom_.load(std::memory_order_seq_cst);
+                    if(top >= bottom) {
+                        return std::nullopt;
+                    }
+                    T value = ring_.load(std::memory_order_acquire)->get(top);
+                    if(!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                        return std::nullopt;
+                    }
+                    return value;
+                }
+
+                // A snapshot that may be stale by the time it is read, exact for the owner when
+                // no thief is active.
+                size_type size() const noexcept {
+                    std::int64_t bottom = bottom_.load(std::memory_order_relaxed);
+                    std::int64_t top = top_.load(std::memory_order_relaxed);
+                    return bottom > top ? static_cast<size_type>(bottom - top) : 0;
+                }
+
+                [[nodiscard]] bool empty() const noexcept {
+                    return size() == 0;
+                }
+
+                size_type capacity() const noexcept {
+                    return static_cast<size_type>(ring_.load(std::memory_order_relaxed)->capacity);
+                }
+        };
+    }
+}
+
+#endif
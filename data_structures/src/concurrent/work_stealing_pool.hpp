@@ -0,0 +1,326 @@
+#ifndef DATA_STRUCTURES_CONCURRENT_WORK_STEALING_POOL_HPP
+#define DATA_STRUCTURES_CONCURRENT_WORK_STEALING_POOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "data_structures/src/concurrent/work_stealing_deque.hpp"
+#include "data_structures/src/linear/deque.hpp"
+#include "data_structures/src/linear/dynamic_array.hpp"
+
+namespace data_structures {
+    namespace concurrent {
+
+        class task_group;
+
+        namespace detail {
+            struct pool_task {
+                void (*execute)(pool_task*);
+                task_group* group;
+            };
+        }
+
+        // A fixed set of workers, each owning a work stealing deque. Tasks spawned on a worker
+        // go to the bottom of its own deque and run newest first, which keeps a fork/join
+        // computation depth first and cache warm; idle workers steal the oldest task of a
+        // random victim, which tends to be the largest piece of work left. Tasks spawned from
+        // outside the pool go through a shared injection queue. Workers that find nothing spin
+        // briefly and then sleep, waking on a spawn or after a millisecond at the latest.
+        class work_stealing_pool {
+            public:
+                using size_type = unsigned long;
+
+            private:
+                friend class task_group;
+
+                struct alignas(64) worker {
+                    work_stealing_deque<detail::pool_task*> tasks;
+                    std::uint64_t random_state;
+                    std::thread thread;
+                };
+
+                static inline thread_local work_stealing_pool* current_pool_ = nullptr;
+                static inline thread_local size_type current_index_ = 0;
+
+                linear::dynamic_array<std::unique_ptr<worker>, std::allocator<std::unique_ptr<worker>>, linear::no_instrumentation, linear::unchecked> workers_;
+                std::mutex injection_mutex_;
+                linear::deque<detail::pool_task*> injected_;
+                std::atomic<size_type> injected_count_{0};
+                std::mutex sleep_mutex_;
+                std::condition_variable wake_;
+                std::atomic<unsigned int> sleepers_{0};
+                std::atomic<bool> stopping_{false};
+
+                worker* current_worker() noexcept {
+                    return current_pool_ == this ? workers_[current_index_].get() : nullptr;
+                }
+
+                void submit(detail::pool_task* task) {
+                    if(worker* self = current_worker()) {
+                        self->tasks.push(task);
+                    }
+                    else {
+                        std::lock_guard lock(injection_mutex_);
+                        injected_.push_back(task);
+                        injected_count_.fetch_add(1, std::memory_order_release);
+                    }
+                    if(sleepers_.load(std::memory_order_acquire) > 0) {
+                        wake_.notify_one();
+                    }
+                }
+
+                detail::pool_task* take_injected() {
+                    if(injected_count_.load(std::memory_order_acquire) == 0) {
+                        return nullptr;
+                    }
+                    std::lock_guard lock(injection_mutex_);
+                    if(injected_.empty()) {
+                        return nullptr;
+                    }
+                    detail::pool_task* task = injected_.front();
+                    injected_.pop_front();
+                    injected_count_.fetch_sub(1, std::memory_order_relaxed);
+                    return task;
+                }
+
+                // The caller's own deque first, then one steal attempt per other worker starting
+                // from a random one, then the injection queue.
+                detail::pool_task* find_task() {
+                    worker* self = current_worker();
+                    std::uint64_t random = 0;
+                    if(self != nullptr) {
+                        if(std::optional<detail::pool_task*> task = self->tasks.pop()) {
+                            return *task;
+                        }
+                        self->random_state ^= self->random_state << 13;
+                        self->random_state ^= self->random_state >> 7;
+                        self->random_state ^= self->random_state << 17;
+                        random = self->random_state;
+                    }
+                    else {
+                        random = static_cast<std::uint64_t>(std::hash<std::thread::id>()(std::this_thread::get_id()));
+                    }
+                    size_type count = workers_.size();
+                    size_type start = static_cast<size_type>(random % count);
+                    for(size_type step = 0; step < count; ++step) {
+                        worker* victim = workers_[(start + step) % count].get();
+                        if(victim == self) {
+                            continue;
+                        }
+                        if(std::optional<detail::pool_task*> task = victim->tasks.steal()) {
+                            return *task;
+                        }
+                    }
+                    return take_injected();
+                }
+
+                static void run(detail::pool_task* task) {
+                    task->execute(task);
+                }
+
+                void worker_loop(size_type index) {
+                    current_pool_ = this;
+                    current_index_ = index;
+                    unsigned int idle_rounds = 0;
+                    while(!stopping_.load(std::memory_order_acquire)) {
+                        if(detail::pool_task* task = find_task()) {
+                            run(task);
+                            idle_rounds = 0;
+                            continue;
+                        }
+                        if(++idle_rounds < 64) {
+                            std::this_thread::yield();
+                            continue;
+                        }
+                        std::unique_lock lock(sleep_mutex_);
+                        sleepers_.fetch_add(1, std::memory_order_acq_rel);
+                        wake_.wait_for(lock, std::chrono::milliseconds(1));
+                        sleepers_.fetch_sub(1, std::memory_order_acq_rel);
+                    }
+                    current_pool_ = nullptr;
+                }
+
+                // A worker splits a range only while its own deque is empty, so thieves always
+                // find work without the range being cut finer than they can take. Any other
+                // thread can only hand work out through the injection queue, so it splits only
+                // while some worker is asleep and would pick the other half up.
+                bool should_split() noexcept {
+                    if(worker* self = current_worker()) {
+                        return self->tasks.empty();
+                    }
+                    return sleepers_.load(std::memory_order_acquire) > 0;
+                }
+
+                template<class Function>
+                void run_range(task_group& group, size_type first, size_type last, Function& function, size_type grain);
+
+            public:
+                // A pool of at least one worker; zero means one per hardware thread.
+                explicit work_stealing_pool(unsigned int thread_count = 0) {
+                    if(thread_count == 0) {
+                        thread_count = std::max(1u, std::thread::hardware_concurrency());
+                    }
+                    workers_.reserve(thread_count);
+                    for(unsigned int index = 0; index < thread_count; ++index) {
+                        workers_.push_back(std::make_unique<worker>());
+                        workers_[index]->random_state = 0x9E3779B97F4A7C15ull * (index + 1);
+                    }
+                    for(unsigned int index = 0; index < thread_count; ++index) {
+                        workers_[index]->thread = std::thread([this, index]() { worker_loop(index); });
+                    }
+                }
+
+                work_stealing_pool(const work_stealing_pool&) = delete;
+                work_stealing_pool& operator=(const work_stealing_pool&) = delete;
+
+                // Every task_group using the pool must have been synced.
+                ~work_stealing_pool() {
+                    stopping_.store(true, std::memory_order_release);
+                    wake_.notify_all();
+                    for(size_type index = 0; index < workers_.size(); ++index) {
+                        workers_[index]->thread.join();
+                    }
+                }
+
+                size_type thread_count() const noexcept {
+                    return workers_.size();
+                }
+
+                // Calls function(index) for every index in [first, last). Ranges are split lazily:
+                // a task keeps working through its range grain indices at a time and only hands
+                // the upper half of what is left to the deque when its worker's deque has run
+                // dry, so splitting follows demand from idle workers rather than a fixed chunk
+                // count. A grain of zero picks one that keeps per chunk overhead small.
+                template<class Function>
+                void parallel_for(size_type first, size_type last, Function&& function, size_type grain = 0);
+        };
+
+        // Tasks spawned together and waited for with sync. A task may spawn into its own group
+        // or into others. sync runs pending tasks on the calling thread while it waits, and
+        // rethrows the first exception any task in the group threw.
+        class task_group {
+            private:
+                friend class work_stealing_pool;
+
+                template<class Function>
+                struct closure : detail::pool_task {
+                    Function function;
+
+                    closure(task_group* owner, Function&& body) : detail::pool_task{&closure::execute_closure, owner}, function(std::move(body)) {}
+
+                    static void execute_closure(detail::pool_task* base) {
+                        closure* self = static_cast<closure*>(base);
+                        task_group* owner = self->group;
+                        try {
+                            self->function();
+                        }
+                        catch(...) {
+                            owner->record_exception(std::current_exception());
+                        }
+                        delete self;
+                        owner->pending_.fetch_sub(1, std::memory_order_acq_rel);
+                    }
+                };
+
+                work_stealing_pool& pool_;
+                std::atomic<unsigned long> pending_{0};
+                std::mutex exception_mutex_;
+                std::exception_ptr exception_;
+
+                void record_exception(std::exception_ptr exception) {
+                    std::lock_guard lock(exception_mutex_);
+                    if(!exception_) {
+                        exception_ = std::move(exception);
+                    }
+                }
+
+                void wait() noexcept {
+                    while(pending_.load(std::memory_order_acquire) > 0) {
+                        if(detail::pool_task* task = pool_.find_task()) {
+                            work_stealing_pool::run(task);
+                        }
+                        else {
+                            std::this_thread::yield();
+                        }
+                    }
+                }
+
+            public:
+                explicit task_group(work_stealing_pool& pool) : pool_(pool) {}
+
+                task_group(const task_group&) = delete;
+                task_group& operator=(const task_group&) = delete;
+
+                // Waits for outstanding tasks; their exceptions are dropped.
+                ~task_group() {
+                    wait();
+                }
+
+                template<class Function>
+                void spawn(Function&& function) {
+                    using body_type = std::decay_t<Function>;
+                    closure<body_type>* task = new closure<body_type>(this, body_type(std::forward<Function>(function)));
+                    pending_.fetch_add(1, std::memory_order_relaxed);
+                    pool_.submit(task);
+                }
+
+                void sync() {
+                    wait();
+                    std::exception_ptr exception;
+                    {
+                        std::lock_guard lock(exception_mutex_);
+                        exception = std::exchange(exception_, nullptr);
+                    }
+                    if(exception) {
+                        std::rethrow_exception(exception);
+                    }
+                }
+        };
+
+        template<class Function>
+        void work_stealing_pool::run_range(task_group& group, size_type first, size_type last, Function& function, size_type grain) {
+            while(first < last) {
+                size_type remaining = last - first;
+                if(remaining > grain && should_split()) {
+                    size_type middle = first + remaining / 2;
+                    group.spawn([this, &group, &function, middle, last, grain]() {
+                        run_range(group, middle, last, function, grain);
+                    });
+                    last = middle;
+                    continue;
+                }
+                size_type chunk_end = first + std::min(grain, remaining);
+                for(; first < chunk_end; ++first) {
+                    function(first);
+                }
+            }
+        }
+
+        template<class Function>
+        void work_stealing_pool::parallel_for(size_type first, size_type last, Function&& function, size_type grain) {
+            if(first >= last) {
+                return;
+            }
+            if(grain == 0) {
+                grain = std::max<size_type>(1, (last - first) / (64 * workers_.size()));
+            }
+            task_group group(*this);
+            group.spawn([this, &group, &function, first, last, grain]() {
+                run_range(group, first, last, function, grain);
+            });
+            group.sync();
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,240 @@
+#ifndef DATA_STRUCTURES_FILTER_CUCKOO_FILTER_HPP
+#define DATA_STRUCTURES_FILTER_CUCKOO_FILTER_HPP
+
+#include <bit>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <stdexcept>
+
+#include "data_structures/src/filter/filter_hash.hpp"
+#include "data_structures/src/linear/dynamic_array.hpp"
+
+namespace data_structures {
+    namespace filter {
+
+        // Cuckoo filter with four 16 bit fingerprints per bucket, packed into one 64 bit word
+        // so a bucket is searched with a single SWAR compare. Every key has two candidate
+        // buckets, the second derived from the first and the fingerprint alone, which is what
+        // makes erase possible without the original key. The false positive rate is about
+        // 8 / 2^16 and the filter accepts inserts up to roughly 95% occupancy.
+        template<class Key, class Hash = filter_hash<Key>>
+        class cuckoo_filter {
+            public:
+                using key_type = Key;
+                using size_type = unsigned long;
+                using hasher = Hash;
+                using fingerprint_type = std::uint16_t;
+
+                static constexpr unsigned int slots_per_bucket = 4;
+
+            private:
+                using bucket_type = std::uint64_t;
+
+                static constexpr unsigned int fingerprint_bits = 16;
+                static constexpr unsigned int max_kicks = 500;
+                static constexpr size_type batch_size = 16;
+                static constexpr bucket_type low_bits = 0x0001000100010001ULL;
+                static constexpr bucket_type high_bits = 0x8000800080008000ULL;
+
+                linear::dynamic_array<bucket_type, std::allocator<bucket_type>, linear::no_instrumentation, linear::unchecked> buckets_;
+                size_type mask_ = 0;
+                size_type size_ = 0;
+                size_type victim_index_ = 0;
+                fingerprint_type victim_fingerprint_ = 0;
+                bool has_victim_ = false;
+                std::uint64_t kick_state_ = 0x9E3779B97F4A7C15ULL;
+                Hash hash_;
+
+                static fingerprint_type fingerprint_of(std::uint64_t hash) noexcept {
+                    fingerprint_type fingerprint = static_cast<fingerprint_type>(hash >> (64 - fingerprint_bits));
+                    return fingerprint != 0 ? fingerprint : 1;
+                }
+
+                size_type alternate_index(size_type index, fingerprint_type fingerprint) const noexcept {
+                    return (index ^ static_cast<size_type>(detail::mix64(fingerprint))) & mask_;
+                }
+
+                static fingerprint_type slot(bucket_type bucket, unsigned int position) noexcept {
+                    return static_cast<fingerprint_type>(bucket >> (position * fingerprint_bits));
+                }
+
+                static bool bucket_contains(bucket_type bucket, fingerprint_type fingerprint) noexcept {
+                    bucket_type difference = bucket ^ (low_bits * fingerprint);
+                    return ((difference - low_bits) & ~difference & high_bits) != 0;
+                }
+
+                bool try_store(size_type index, fingerprint_type fingerprint) noexcept {
+                    bucket_type& bucket = buckets_[index];
+                    for(unsigned int position = 0; position < slots_per_bucket; ++position) {
+                        if(slot(bucket, position) == 0) {
+                            bucket |= bucket_type(fingerprint) << (position * fingerprint_bits);
+                            return true;
+                        }
+                    }
+                    return false;
+                }
+
+                bool try_remove(size_type index, fingerprint_type fingerprint) noexcept {
+                    bucket_type& bucket = buckets_[index];
+                    for(unsigned int position = 0; position < slots_per_bucket; ++position) {
+                        if(slot(bucket, position) == fingerprint) {
+                            bucket &= ~(bucket_type(0xFFFF) << (position * fingerprint_bits));
+                            return true;
+                        }
+                    }
+                    return false;
+                }
+
+                unsigned int next_kick_slot() noexcept {
+                    kick_state_ ^= kick_state_ << 13;
+                    kick_state_ ^= kick_state_ >> 7;
+                    kick_state_ ^= kick_state_ << 17;
+                    return static_cast<unsigned int>(kick_state_ % slots_per_bucket);
+                }
+
+                // Evicts fingerprints along a random walk until one lands in a free slot. If
+                // the walk gives up, the homeless fingerprint is parked as the victim so no
+                // stored key is ever lost; the filter then refuses inserts until an erase.
+                void store_with_kicks(size_type index, fingerprint_type fingerprint) {
+                    if(try_store(index, fingerprint) || try_store(alternate_index(index, fingerprint), fingerprint)) {
+                        return;
+                    }
+                    if(kick_state_ & 1) {
+                        index = alternate_index(index, fingerprint);
+                    }
+                    for(unsigned int kick = 0; kick < max_kicks; ++kick) {
+                        unsigned int position = next_kick_slot();
+                        bucket_type& bucket = buckets_[index];
+                        fingerprint_type evicted = slot(bucket, position);
+                        bucket &= ~(bucket_type(0xFFFF) << (position * fingerprint_bits));
+                        bucket |= bucket_type(fingerprint) << (position * fingerprint_bits);
+                        fingerprint = evicted;
+                        index = alternate_index(index, fingerprint);
+                        if(try_store(index, fingerprint)) {
+                            return;
+                        }
+                    }
+                    victim_index_ = index;
+                    victim_fingerprint_ = fingerprint;
+                    has_victim_ = true;
+                }
+
+                bool victim_matches(size_type index, size_type alternate, fingerprint_type fingerprint) const noexcept {
+                    return has_victim_ && victim_fingerprint_ == fingerprint && (victim_index_ == index || victim_index_ == alternate);
+                }
+
+            public:
+                explicit cuckoo_filter(size_type expected_elements, const Hash& hash = Hash()) : hash_(hash) {
+                    size_type wanted_buckets = static_cast<size_type>(expected_elements / (slots_per_bucket * 0.95)) + 1;
+                    size_type bucket_count = std::bit_ceil(wanted_buckets);
+                    buckets_.resize(bucket_count, 0);
+                    mask_ = bucket_count - 1;
+                }
+
+                bool insert_hash(std::uint64_t hash) {
+                    if(has_victim_) {
+                        return false;
+                    }
+                    store_with_kicks(static_cast<size_type>(hash) & mask_, fingerprint_of(hash));
+                    ++size_;
+                    return true;
+                }
+
+                bool contains_hash(std::uint64_t hash) const noexcept {
+                    fingerprint_type fingerprint = fingerprint_of(hash);
+                    size_type index = static_cast<size_type>(hash) & mask_;
+                    size_type alternate = alternate_index(index, fingerprint);
+                    return bucket_contains(buckets_[index], fingerprint) || bucket_contains(buckets_[alternate], fingerprint) ||
+                           victim_matches(index, alternate, fingerprint);
+                }
+
+                // Only erase keys that were inserted: erasing a false positive removes the
+                // fingerprint of some other key.
+                bool erase_hash(std::uint64_t hash) {
+                    fingerprint_type fingerprint = fingerprint_of(hash);
+                    size_type index = static_cast<size_type>(hash) & mask_;
+                    size_type alternate = alternate_index(index, fingerprint);
+                    if(victim_matches(index, alternate, fingerprint)) {
+                        has_victim_ = false;
+                        --size_;
+                        return true;
+                    }
+                    if(!try_remove(index, fingerprint) && !try_remove(alternate, fingerprint)) {
+                        return false;
+                    }
+                    --size_;
+                    if(has_victim_) {
+                        has_victim_ = false;
+                        store_with_kicks(victim_index_, victim_fingerprint_);
+                    }
+                    return true;
+                }
+
+                bool insert(const Key& key) {
+                    return insert_hash(hash_(key));
+                }
+
+                bool contains(const Key& key) const {
+                    return contains_hash(hash_(key));
+                }
+
+                bool erase(const Key& key) {
+                    return erase_hash(hash_(key));
+                }
+
+                // Writes one result per key and returns how many keys may be present.
+                size_type contains_batch(std::span<const Key> keys, std::span<bool> results) const {
+                    if(results.size() < keys.size()) {
+                        throw std::invalid_argument("Result span is smaller than the key span.");
+                    }
+                    std::uint64_t hashes[batch_size];
+                    size_type found = 0;
+                    for(size_type first = 0; first < keys.size(); first += batch_size) {
+                        std::span<const Key> batch = keys.subspan(first, keys.size() - first < batch_size ? keys.size() - first : batch_size);
+                        hash_batch(batch, hashes, hash_);
+                        for(size_type index = 0; index < batch.size(); ++index) {
+                            size_type bucket = static_cast<size_type>(hashes[index]) & mask_;
+                            detail::prefetch(&buckets_[bucket]);
+                            detail::prefetch(&buckets_[alternate_index(bucket, fingerprint_of(hashes[index]))]);
+                        }
+                        for(size_type index = 0; index < batch.size(); ++index) {
+                            results[first + index] = contains_hash(hashes[index]);
+                            found += results[first + index];
+                        }
+                    }
+                    return found;
+                }
+
+                void clear() {
+                    for(size_type index = 0; index < buckets_.size(); ++index) {
+                        buckets_[index] = 0;
+                    }
+                    size_ = 0;
+                    has_victim_ = false;
+                }
+
+                size_type size() const noexcept {
+                    return size_;
+                }
+
+                size_type capacity() const noexcept {
+                    return buckets_.size() * slots_per_bucket;
+                }
+
+                double load_factor() const noexcept {
+                    return static_cast<double>(size_) / static_cast<double>(capacity());
+                }
+
+                bool full() const noexcept {
+                    return has_victim_;
+                }
+
+                size_type size_in_bytes() const noexcept {
+                    return buckets_.size() * sizeof(bucket_type);
+                }
+        };
+    }
+}
+
+#endif
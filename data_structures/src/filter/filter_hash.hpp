@@ -0,0 +1,59 @@
+#ifndef DATA_STRUCTURES_FILTER_FILTER_HASH_HPP
+#define DATA_STRUCTURES_FILTER_FILTER_HASH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <type_traits>
+
+namespace data_structures {
+    namespace filter {
+
+        namespace detail {
+            inline constexpr std::uint64_t mix64(std::uint64_t value) noexcept {
+                value ^= value >> 32;
+                value *= 0xD6E8FEB86659FD93ULL;
+                value ^= value >> 32;
+                value *= 0xD6E8FEB86659FD93ULL;
+                value ^= value >> 32;
+                return value;
+            }
+
+            inline void prefetch(const void* address) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+                __builtin_prefetch(address);
+#else
+                (void)address;
+#endif
+            }
+        }
+
+        // Filters take their bucket index and fingerprint from different bits of one 64 bit
+        // hash, so std::hash (the identity for integers on most standard libraries) is always
+        // passed through a full avalanche mix first.
+        template<class Key>
+        struct filter_hash {
+            std::uint64_t operator()(const Key& key) const {
+                if constexpr(std::is_integral_v<Key> || std::is_enum_v<Key>) {
+                    return detail::mix64(static_cast<std::uint64_t>(key));
+                }
+                else {
+                    return detail::mix64(static_cast<std::uint64_t>(std::hash<Key>()(key)));
+                }
+            }
+        };
+
+        // Hashes are computed for a whole batch before any filter memory is touched: for
+        // integer keys this is a dependency-free multiply/shift loop the compiler vectorizes,
+        // and it lets the probe loop issue every prefetch up front.
+        template<class Key, class Hash>
+        void hash_batch(std::span<const Key> keys, std::uint64_t* hashes, const Hash& hash) {
+            for(std::size_t index = 0; index < keys.size(); ++index) {
+                hashes[index] = hash(keys[index]);
+            }
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,176 @@
+#ifndef DATA_STRUCTURES_HEAP_D_ARY_HEAP_HPP
+#define DATA_STRUCTURES_HEAP_D_ARY_HEAP_HPP
+
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "data_structures/src/linear/dynamic_array.hpp"
+
+namespace data_structures {
+    namespace heap {
+
+        // Implicit d-ary heap with the same ordering convention as std::priority_queue: top()
+        // is the element that compares greatest under Compare. A wider node (Arity 4 or 8)
+        // halves the tree height and keeps all children of a node in one or two cache lines,
+        // which is where binary heaps lose most of their time on large queues.
+        template<class T, unsigned int Arity = 4, class Compare = std::less<T>, class Allocator = std::allocator<T>>
+        class d_ary_heap {
+            static_assert(Arity >= 2, "A heap needs at least two children per node");
+
+            public:
+                using value_type = T;
+                using reference = value_type&;
+                using const_reference = const value_type&;
+                using size_type = unsigned long;
+                using value_compare = Compare;
+                using container_type = linear::dynamic_array<T, Allocator, linear::no_instrumentation, linear::unchecked>;
+
+                static constexpr unsigned int arity = Arity;
+
+            private:
+                container_type elements_;
+                Compare compare_;
+
+                static size_type parent_index(size_type index) {
+                    return (index - 1) / Arity;
+                }
+
+                static size_type first_child_index(size_type index) {
+                    return index * Arity + 1;
+                }
+
+                void sift_up(size_type index) {
+                    value_type value = std::move(elements_[index]);
+                    while(index > 0) {
+                        size_type parent = parent_index(index);
+                        if(!compare_(elements_[parent], value)) {
+                            break;
+                        }
+                        elements_[index] = std::move(elements_[parent]);
+                        index = parent;
+                    }
+                    elements_[index] = std::move(value);
+                }
+
+                void sift_down(size_type index) {
+                    size_type heap_size = elements_.size();
+                    value_type value = std::move(elements_[index]);
+                    while(true) {
+                        size_type first_child = first_child_index(index);
+                        if(first_child >= heap_size) {
+                            break;
+                        }
+                        size_type last_child = first_child + Arity < heap_size ? first_child + Arity : heap_size;
+                        size_type best_child = first_child;
+                        for(size_type child = first_child + 1; child < last_child; ++child) {
+                            if(compare_(elements_[best_child], elements_[child])) {
+                                best_child = child;
+                            }
+                        }
+                        if(!compare_(value, elements_[best_child])) {
+                            break;
+                        }
+                        elements_[index] = std::move(elements_[best_child]);
+                        index = best_child;
+                    }
+                    elements_[index] = std::move(value);
+                }
+
+                void check_not_empty() const {
+                    if(elements_.size() == 0) {
+                        throw std::out_of_range("Heap is empty.");
+                    }
+                }
+
+            public:
+                d_ary_heap() : elements_(), compare_() {}
+
+                explicit d_ary_heap(const Compare& compare, const Allocator& alloc = Allocator()) : elements_(alloc), compare_(compare) {}
+
+                template<class InputIt>
+                d_ary_heap(InputIt first, InputIt last, const Compare& compare = Compare()) : elements_(), compare_(compare) {
+                    for(; first != last; ++first) {
+                        elements_.push_back(*first);
+                    }
+                    make_heap();
+                }
+
+                [[nodiscard]] bool empty() const noexcept {
+                    return elements_.size() == 0;
+                }
+
+                size_type size() const noexcept {
+                    return elements_.size();
+                }
+
+                void reserve(size_type n) {
+                    elements_.reserve(n);
+                }
+
+                void clear() {
+                    elements_.clear();
+                }
+
+                const_reference top() const {
+                    check_not_empty();
+                    return elements_[0];
+                }
+
+                void push(const value_type& value) {
+                    elements_.push_back(value);
+                    sift_up(elements_.size() - 1);
+                }
+
+                void push(value_type&& value) {
+                    elements_.push_back(std::move(value));
+                    sift_up(elements_.size() - 1);
+                }
+
+                template<class... Args>
+                void emplace(Args&&... args) {
+                    elements_.emplace_back(std::forward<Args>(args)...);
+                    sift_up(elements_.size() - 1);
+                }
+
+                void pop() {
+                    check_not_empty();
+                    size_type last_index = elements_.size() - 1;
+                    if(last_index > 0) {
+                        elements_[0] = std::move(elements_[last_index]);
+                    }
+                    elements_.pop_back();
+                    if(elements_.size() > 1) {
+                        sift_down(0);
+                    }
+                }
+
+                value_type extract_top() {
+                    check_not_empty();
+                    value_type top_value = std::move(elements_[0]);
+                    pop();
+                    return top_value;
+                }
+
+                void make_heap() {
+                    size_type heap_size = elements_.size();
+                    if(heap_size < 2) {
+                        return;
+                    }
+                    for(size_type index = parent_index(heap_size - 1) + 1; index > 0; --index) {
+                        sift_down(index - 1);
+                    }
+                }
+
+                const container_type& container() const noexcept {
+                    return elements_;
+                }
+        };
+
+        template<class T, class Compare = std::less<T>>
+        using priority_queue = d_ary_heap<T, 4, Compare>;
+    }
+}
+
+#endif
@@ -0,0 +1,230 @@
+#ifndef DATA_STRUCTURES_HEAP_INDEXED_HEAP_HPP
+#define DATA_STRUCTURES_HEAP_INDEXED_HEAP_HPP
+
+#include <functional>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "data_structures/src/linear/dynamic_array.hpp"
+
+namespace data_structures {
+    namespace heap {
+
+        // d-ary heap over integer ids in [0, id_capacity) with a position table, so the
+        // priority of an id already in the heap can be changed in O(log n). The default
+        // Compare makes it a min-heap: decrease_key moves an id towards top() and
+        // increase_key moves it away, matching the names used in shortest path algorithms.
+        template<class Priority, unsigned int Arity = 4, class Compare = std::greater<Priority>>
+        class indexed_heap {
+            static_assert(Arity >= 2, "A heap needs at least two children per node");
+
+            public:
+                using priority_type = Priority;
+                using id_type = unsigned long;
+                using size_type = unsigned long;
+                using value_compare = Compare;
+
+                static constexpr unsigned int arity = Arity;
+                static constexpr size_type npos = std::numeric_limits<size_type>::max();
+
+            private:
+                template<class T>
+                using array_type = linear::dynamic_array<T, std::allocator<T>, linear::no_instrumentation, linear::unchecked>;
+
+                array_type<id_type> heap_;
+                array_type<size_type> positions_;
+                array_type<Priority> priorities_;
+                Compare compare_;
+
+                bool higher_priority(id_type first, id_type second) const {
+                    return compare_(priorities_[second], priorities_[first]);
+                }
+
+                void place(size_type index, id_type id) {
+                    heap_[index] = id;
+                    positions_[id] = index;
+                }
+
+                void sift_up(size_type index) {
+                    id_type id = heap_[index];
+                    while(index > 0) {
+                        size_type parent = (index - 1) / Arity;
+                        if(!higher_priority(id, heap_[parent])) {
+                            break;
+                        }
+                        place(index, heap_[parent]);
+                        index = parent;
+                    }
+                    place(index, id);
+                }
+
+                void sift_down(size_type index) {
+                    size_type heap_size = heap_.size();
+                    id_type id = heap_[index];
+                    while(true) {
+                        size_type first_child = index * Arity + 1;
+                        if(first_child >= heap_size) {
+                            break;
+                        }
+                        size_type last_child = first_child + Arity < heap_size ? first_child + Arity : heap_size;
+                        size_type best_child = first_child;
+                        for(size_type child = first_child + 1; child < last_child; ++child) {
+                            if(higher_priority(heap_[child], heap_[best_child])) {
+                                best_child = child;
+                            }
+                        }
+                        if(!higher_priority(heap_[best_child], id)) {
+                            break;
+                        }
+                        place(index, heap_[best_child]);
+                        index = best_child;
+                    }
+                    place(index, id);
+                }
+
+                void check_id(id_type id) const {
+                    if(id >= positions_.size()) {
+                        throw std::out_of_range("Id " + std::to_string(id) + " is outside the heap's id range.");
+                    }
+                }
+
+                void check_contains(id_type id) const {
+                    check_id(id);
+                    if(positions_[id] == npos) {
+                        throw std::invalid_argument("Id " + std::to_string(id) + " is not in the heap.");
+                    }
+                }
+
+                void check_not_empty() const {
+                    if(heap_.size() == 0) {
+                        throw std::out_of_range("Heap is empty.");
+                    }
+                }
+
+            public:
+                explicit indexed_heap(size_type id_capacity = 0, const Compare& compare = Compare()) : compare_(compare) {
+                    reserve_ids(id_capacity);
+                }
+
+                void reserve_ids(size_type id_capacity) {
+                    if(id_capacity > positions_.size()) {
+                        positions_.resize(id_capacity, npos);
+                        priorities_.resize(id_capacity);
+                        heap_.reserve(id_capacity);
+                    }
+                }
+
+                size_type id_capacity() const noexcept {
+                    return positions_.size();
+                }
+
+                [[nodiscard]] bool empty() const noexcept {
+                    return heap_.size() == 0;
+                }
+
+                size_type size() const noexcept {
+                    return heap_.size();
+                }
+
+                bool contains(id_type id) const noexcept {
+                    return id < positions_.size() && positions_[id] != npos;
+                }
+
+                const Priority& priority(id_type id) const {
+                    check_contains(id);
+                    return priorities_[id];
+                }
+
+                id_type top_id() const {
+                    check_not_empty();
+                    return heap_[0];
+                }
+
+                const Priority& top_priority() const {
+                    check_not_empty();
+                    return priorities_[heap_[0]];
+                }
+
+                void push(id_type id, const Priority& priority) {
+                    check_id(id);
+                    if(positions_[id] != npos) {
+                        throw std::invalid_argument("Id " + std::to_string(id) + " is already in the heap.");
+                    }
+                    priorities_[id] = priority;
+                    heap_.push_back(id);
+                    sift_up(heap_.size() - 1);
+                }
+
+                void pop() {
+                    check_not_empty();
+                    erase(heap_[0]);
+                }
+
+                void erase(id_type id) {
+                    check_contains(id);
+                    size_type index = positions_[id];
+                    size_type last_index = heap_.size() - 1;
+                    positions_[id] = npos;
+                    if(index != last_index) {
+                        id_type moved_id = heap_[last_index];
+                        heap_.pop_back();
+                        place(index, moved_id);
+                        if(index > 0 && higher_priority(moved_id, heap_[(index - 1) / Arity])) {
+                            sift_up(index);
+                        }
+                        else {
+                            sift_down(index);
+                        }
+                    }
+                    else {
+                        heap_.pop_back();
+                    }
+                }
+
+                void decrease_key(id_type id, const Priority& priority) {
+                    check_contains(id);
+                    if(compare_(priority, priorities_[id])) {
+                        throw std::invalid_argument("decrease_key would move the id away from the top.");
+                    }
+                    priorities_[id] = priority;
+                    sift_up(positions_[id]);
+                }
+
+                void increase_key(id_type id, const Priority& priority) {
+                    check_contains(id);
+                    if(compare_(priorities_[id], priority)) {
+                        throw std::invalid_argument("increase_key would move the id towards the top.");
+                    }
+                    priorities_[id] = priority;
+                    sift_down(positions_[id]);
+                }
+
+                void push_or_update(id_type id, const Priority& priority) {
+                    if(!contains(id)) {
+                        push(id, priority);
+                        return;
+                    }
+                    bool moves_towards_top = compare_(priorities_[id], priority);
+                    priorities_[id] = priority;
+                    if(moves_towards_top) {
+                        sift_up(positions_[id]);
+                    }
+                    else {
+                        sift_down(positions_[id]);
+                    }
+                }
+
+                void clear() {
+                    for(size_type index = 0; index < heap_.size(); ++index) {
+                        positions_[heap_[index]] = npos;
+                    }
+                    heap_.clear();
+                }
+        };
+    }
+}
+
+#endif
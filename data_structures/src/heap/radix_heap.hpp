@@ -0,0 +1,136 @@
+#ifndef DATA_STRUCTURES_HEAP_RADIX_HEAP_HPP
+#define DATA_STRUCTURES_HEAP_RADIX_HEAP_HPP
+
+#include <array>
+#include <bit>
+#include <concepts>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "data_structures/src/linear/dynamic_array.hpp"
+
+namespace data_structures {
+    namespace heap {
+
+        // Min-heap for monotone integer keys: every pushed key must be at least the key of the
+        // last popped element. Entries live in one bucket per bit position of (key ^ last key),
+        // so push is O(1) and each entry is redistributed at most once per bit of the key width.
+        template<std::unsigned_integral Key, class Value>
+        class radix_heap {
+            public:
+                using key_type = Key;
+                using value_type = std::pair<Key, Value>;
+                using size_type = unsigned long;
+
+            private:
+                static constexpr unsigned int bucket_count = std::numeric_limits<Key>::digits + 1;
+
+                using bucket_type = linear::dynamic_array<value_type, std::allocator<value_type>, linear::no_instrumentation, linear::unchecked>;
+
+                std::array<bucket_type, bucket_count> buckets_;
+                size_type size_ = 0;
+                Key last_key_ = 0;
+
+                unsigned int bucket_index(Key key) const {
+                    return static_cast<unsigned int>(std::bit_width(static_cast<Key>(key ^ last_key_)));
+                }
+
+                void refill_front_bucket() {
+                    unsigned int source = 1;
+                    while(buckets_[source].size() == 0) {
+                        ++source;
+                    }
+                    bucket_type& source_bucket = buckets_[source];
+                    Key min_key = source_bucket[0].first;
+                    for(size_type index = 1; index < source_bucket.size(); ++index) {
+                        min_key = source_bucket[index].first < min_key ? source_bucket[index].first : min_key;
+                    }
+                    last_key_ = min_key;
+                    for(size_type index = 0; index < source_bucket.size(); ++index) {
+                        buckets_[bucket_index(source_bucket[index].first)].push_back(std::move(source_bucket[index]));
+                    }
+                    source_bucket.clear();
+                }
+
+                void check_not_empty() const {
+                    if(size_ == 0) {
+                        throw std::out_of_range("Heap is empty.");
+                    }
+                }
+
+            public:
+                [[nodiscard]] bool empty() const noexcept {
+                    return size_ == 0;
+                }
+
+                size_type size() const noexcept {
+                    return size_;
+                }
+
+                Key last_key() const noexcept {
+                    return last_key_;
+                }
+
+                void push(Key key, const Value& value) {
+                    if(key < last_key_) {
+                        throw std::invalid_argument("Key " + std::to_string(key) + " is smaller than the last extracted key " + std::to_string(last_key_));
+                    }
+                    buckets_[bucket_index(key)].push_back(value_type(key, value));
+                    ++size_;
+                }
+
+                void push(Key key, Value&& value) {
+                    if(key < last_key_) {
+                        throw std::invalid_argument("Key " + std::to_string(key) + " is smaller than the last extracted key " + std::to_string(last_key_));
+                    }
+                    buckets_[bucket_index(key)].push_back(value_type(key, std::move(value)));
+                    ++size_;
+                }
+
+                const value_type& top() {
+                    check_not_empty();
+                    if(buckets_[0].size() == 0) {
+                        refill_front_bucket();
+                    }
+                    return buckets_[0].back();
+                }
+
+                Key top_key() {
+                    return top().first;
+                }
+
+                void pop() {
+                    check_not_empty();
+                    if(buckets_[0].size() == 0) {
+                        refill_front_bucket();
+                    }
+                    buckets_[0].pop_back();
+                    --size_;
+                }
+
+                value_type extract_top() {
+                    check_not_empty();
+                    if(buckets_[0].size() == 0) {
+                        refill_front_bucket();
+                    }
+                    value_type top_value = std::move(buckets_[0].back());
+                    buckets_[0].pop_back();
+                    --size_;
+                    return top_value;
+                }
+
+                void clear() {
+                    for(bucket_type& bucket : buckets_) {
+                        bucket.clear();
+                    }
+                    size_ = 0;
+                    last_key_ = 0;
+                }
+        };
+    }
+}
+
+#endif
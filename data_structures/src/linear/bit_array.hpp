@@ -0,0 +1,363 @@
+#ifndef DATA_STRUCTURES_LINEAR_BIT_ARRAY_HPP
+#define DATA_STRUCTURES_LINEAR_BIT_ARRAY_HPP
+
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+
+#include "data_structures/src/linear/dynamic_array.hpp"
+
+namespace data_structures {
+    namespace linear {
+
+        // Bits are packed 64 to a word and the unused high bits of the last word are always
+        // zero, so count and the bulk operations work a whole word at a time. The word loops
+        // have no cross-iteration dependencies and are left to the compiler to vectorize.
+        class bit_array {
+            public:
+                using word_type = std::uint64_t;
+                using size_type = unsigned long;
+
+                static constexpr size_type word_bits = std::numeric_limits<word_type>::digits;
+                static constexpr size_type npos = std::numeric_limits<size_type>::max();
+
+            private:
+                static constexpr size_type rank_block_words = 8;
+                static constexpr size_type rank_block_bits = rank_block_words * word_bits;
+
+                using word_array = dynamic_array<word_type, std::allocator<word_type>, no_instrumentation, unchecked>;
+
+                word_array words_;
+                word_array rank_blocks_;
+                size_type size_ = 0;
+                bool rank_valid_ = false;
+
+                static size_type words_for(size_type bits) {
+                    return (bits + word_bits - 1) / word_bits;
+                }
+
+                static word_type bit_mask(size_type index) {
+                    return word_type(1) << (index % word_bits);
+                }
+
+                void clear_unused_bits() {
+                    size_type used_bits = size_ % word_bits;
+                    if(used_bits != 0) {
+                        words_[words_.size() - 1] &= (word_type(1) << used_bits) - 1;
+                    }
+                }
+
+                void check_index(size_type index) const {
+                    if(index >= size_) {
+                        throw std::out_of_range("Bit " + std::to_string(index) + " is out of range for size " + std::to_string(size_));
+                    }
+                }
+
+                void check_same_size(const bit_array& other) const {
+                    if(other.size_ != size_) {
+                        throw std::invalid_argument("Bit arrays have different sizes.");
+                    }
+                }
+
+                void check_rank_index() const {
+                    if(!rank_valid_) {
+                        throw std::logic_error("Rank index is stale; call build_rank_index() after modifying the bit array.");
+                    }
+                }
+
+                static size_type select_in_word(word_type word, size_type rank) {
+                    for(; rank > 0; --rank) {
+                        word &= word - 1;
+                    }
+                    return static_cast<size_type>(std::countr_zero(word));
+                }
+
+            public:
+                bit_array() = default;
+
+                explicit bit_array(size_type n, bool value = false) {
+                    resize(n, value);
+                }
+
+                size_type size() const noexcept {
+                    return size_;
+                }
+
+                [[nodiscard]] bool empty() const noexcept {
+                    return size_ == 0;
+                }
+
+                size_type word_count() const noexcept {
+                    return words_.size();
+                }
+
+                std::span<const word_type> words() const noexcept {
+                    return std::span<const word_type>(words_.data(), words_.size());
+                }
+
+                void resize(size_type n, bool value = false) {
+                    size_type old_size = size_;
+                    size_type old_words = words_.size();
+                    words_.resize(words_for(n), value ? ~word_type(0) : word_type(0));
+                    if(value && n > old_size && old_size % word_bits != 0) {
+                        words_[old_words - 1] |= ~((word_type(1) << (old_size % word_bits)) - 1);
+                    }
+                    size_ = n;
+                    clear_unused_bits();
+                    rank_valid_ = false;
+                }
+
+                void clear() {
+                    words_.clear();
+                    size_ = 0;
+                    rank_valid_ = false;
+                }
+
+                void push_back(bool value) {
+                    if(size_ % word_bits == 0) {
+                        words_.push_back(0);
+                    }
+                    ++size_;
+                    set(size_ - 1, value);
+                }
+
+                bool test(size_type index) const {
+                    check_index(index);
+                    return (words_[index / word_bits] & bit_mask(index)) != 0;
+                }
+
+                bool operator[](size_type index) const {
+                    return (words_[index / word_bits] & bit_mask(index)) != 0;
+                }
+
+                void set(size_type index) {
+                    check_index(index);
+                    words_[index / word_bits] |= bit_mask(index);
+                    rank_valid_ = false;
+                }
+
+                void set(size_type index, bool value) {
+                    check_index(index);
+                    word_type& word = words_[index / word_bits];
+                    word = (word & ~bit_mask(index)) | (word_type(value) << (index % word_bits));
+                    rank_valid_ = false;
+                }
+
+                void reset(size_type index) {
+                    check_index(index);
+                    words_[index / word_bits] &= ~bit_mask(index);
+                    rank_valid_ = false;
+                }
+
+                void flip(size_type index) {
+                    check_index(index);
+                    words_[index / word_bits] ^= bit_mask(index);
+                    rank_valid_ = false;
+                }
+
+                void set_all() {
+                    word_type* words = words_.data();
+                    for(size_type index = 0; index < words_.size(); ++index) {
+                        words[index] = ~word_type(0);
+                    }
+                    clear_unused_bits();
+                    rank_valid_ = false;
+                }
+
+                void reset_all() {
+                    word_type* words = words_.data();
+                    for(size_type index = 0; index < words_.size(); ++index) {
+                        words[index] = 0;
+                    }
+                    rank_valid_ = false;
+                }
+
+                void flip_all() {
+                    word_type* words = words_.data();
+                    for(size_type index = 0; index < words_.size(); ++index) {
+                        words[index] = ~words[index];
+                    }
+                    clear_unused_bits();
+                    rank_valid_ = false;
+                }
+
+                size_type count() const noexcept {
+                    const word_type* words = words_.data();
+                    size_type total = 0;
+                    for(size_type index = 0; index < words_.size(); ++index) {
+                        total += static_cast<size_type>(std::popcount(words[index]));
+                    }
+                    return total;
+                }
+
+                bool any() const noexcept {
+                    const word_type* words = words_.data();
+                    for(size_type index = 0; index < words_.size(); ++index) {
+                        if(words[index] != 0) {
+                            return true;
+                        }
+                    }
+                    return false;
+                }
+
+                bool none() const noexcept {
+                    return !any();
+                }
+
+                bool all() const noexcept {
+                    return count() == size_;
+                }
+
+                bit_array& operator&=(const bit_array& other) {
+                    check_same_size(other);
+                    word_type* words = words_.data();
+                    const word_type* other_words = other.words_.data();
+                    for(size_type index = 0; index < words_.size(); ++index) {
+                        words[index] &= other_words[index];
+                    }
+                    rank_valid_ = false;
+                    return *this;
+                }
+
+                bit_array& operator|=(const bit_array& other) {
+                    check_same_size(other);
+                    word_type* words = words_.data();
+                    const word_type* other_words = other.words_.data();
+                    for(size_type index = 0; index < words_.size(); ++index) {
+                        words[index] |= other_words[index];
+                    }
+                    rank_valid_ = false;
+                    return *this;
+                }
+
+                bit_array& operator^=(const bit_array& other) {
+                    check_same_size(other);
+                    word_type* words = words_.data();
+                    const word_type* other_words = other.words_.data();
+                    for(size_type index = 0; index < words_.size(); ++index) {
+                        words[index] ^= other_words[index];
+                    }
+                    rank_valid_ = false;
+                    return *this;
+                }
+
+                bit_array& and_not(const bit_array& other) {
+                    check_same_size(other);
+                    word_type* words = words_.data();
+                    const word_type* other_words = other.words_.data();
+                    for(size_type index = 0; index < words_.size(); ++index) {
+                        words[index] &= ~other_words[index];
+                    }
+                    rank_valid_ = false;
+                    return *this;
+                }
+
+                bool operator==(const bit_array& other) const {
+                    if(size_ != other.size_) {
+                        return false;
+                    }
+                    for(size_type index = 0; index < words_.size(); ++index) {
+                        if(words_[index] != other.words_[index]) {
+                            return false;
+                        }
+                    }
+                    return true;
+                }
+
+                size_type find_first() const noexcept {
+                    for(size_type index = 0; index < words_.size(); ++index) {
+                        if(words_[index] != 0) {
+                            return index * word_bits + static_cast<size_type>(std::countr_zero(words_[index]));
+                        }
+                    }
+                    return npos;
+                }
+
+                size_type find_next(size_type position) const noexcept {
+                    size_type start = position + 1;
+                    if(position == npos || start >= size_) {
+                        return npos;
+                    }
+                    size_type word_index = start / word_bits;
+                    word_type word = words_[word_index] & (~word_type(0) << (start % word_bits));
+                    while(word == 0) {
+                        if(++word_index == words_.size()) {
+                            return npos;
+                        }
+                        word = words_[word_index];
+                    }
+                    return word_index * word_bits + static_cast<size_type>(std::countr_zero(word));
+                }
+
+                // Cumulative set bit counts for every 512 bit block: an extra 12.5% of space
+                // that makes rank O(1) and select O(log n). Any modification invalidates it.
+                void build_rank_index() {
+                    size_type block_count = (words_.size() + rank_block_words - 1) / rank_block_words;
+                    rank_blocks_.resize(block_count + 1);
+                    size_type running_count = 0;
+                    for(size_type block = 0; block < block_count; ++block) {
+                        rank_blocks_[block] = running_count;
+                        size_type last_word = (block + 1) * rank_block_words;
+                        last_word = last_word < words_.size() ? last_word : words_.size();
+                        for(size_type index = block * rank_block_words; index < last_word; ++index) {
+                            running_count += static_cast<size_type>(std::popcount(words_[index]));
+                        }
+                    }
+                    rank_blocks_[block_count] = running_count;
+                    rank_valid_ = true;
+                }
+
+                bool has_rank_index() const noexcept {
+                    return rank_valid_;
+                }
+
+                size_type rank(size_type position) const {
+                    check_rank_index();
+                    if(position >= size_) {
+                        return rank_blocks_[rank_blocks_.size() - 1];
+                    }
+                    size_type word_index = position / word_bits;
+                    size_type total = rank_blocks_[position / rank_block_bits];
+                    for(size_type index = (position / rank_block_bits) * rank_block_words; index < word_index; ++index) {
+                        total += static_cast<size_type>(std::popcount(words_[index]));
+                    }
+                    word_type partial = words_[word_index] & (bit_mask(position) - 1);
+                    return total + static_cast<size_type>(std::popcount(partial));
+                }
+
+                size_type select(size_type rank_to_find) const {
+                    check_rank_index();
+                    size_type block_count = rank_blocks_.size() - 1;
+                    if(rank_to_find >= rank_blocks_[block_count]) {
+                        return npos;
+                    }
+                    size_type low = 0;
+                    size_type high = block_count;
+                    while(high - low > 1) {
+                        size_type middle = low + (high - low) / 2;
+                        if(rank_blocks_[middle] <= rank_to_find) {
+                            low = middle;
+                        }
+                        else {
+                            high = middle;
+                        }
+                    }
+                    size_type remaining = rank_to_find - rank_blocks_[low];
+                    for(size_type index = low * rank_block_words; index < words_.size(); ++index) {
+                        size_type word_count = static_cast<size_type>(std::popcount(words_[index]));
+                        if(remaining < word_count) {
+                            return index * word_bits + select_in_word(words_[index], remaining);
+                        }
+                        remaining -= word_count;
+                    }
+                    return npos;
+                }
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,103 @@
+#ifndef DATA_STRUCTURES_LINEAR_BOUNDS_CHECK_HPP
+#define DATA_STRUCTURES_LINEAR_BOUNDS_CHECK_HPP
+
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+
+#define DATA_STRUCTURES_BOUNDS_CHECK_NONE 0
+#define DATA_STRUCTURES_BOUNDS_CHECK_ASSERT 1
+#define DATA_STRUCTURES_BOUNDS_CHECK_THROW 2
+#define DATA_STRUCTURES_BOUNDS_CHECK_ABORT 3
+
+#ifndef DATA_STRUCTURES_BOUNDS_CHECK
+#define DATA_STRUCTURES_BOUNDS_CHECK DATA_STRUCTURES_BOUNDS_CHECK_THROW
+#endif
+
+namespace data_structures {
+    namespace linear {
+
+        // The failure paths are kept out of line so a checked access inlines to one compare
+        // and a never taken branch; message formatting only happens once a check has failed.
+        namespace detail {
+            [[noreturn, gnu::cold, gnu::noinline]] inline void throw_out_of_range(unsigned long index, unsigned long size) {
+                throw std::out_of_range("Index " + std::to_string(index) + " is out of range for size " + std::to_string(size));
+            }
+
+            [[noreturn, gnu::cold, gnu::noinline]] inline void throw_empty_container() {
+                throw std::runtime_error("Dynamic array is empty. Cannot erase elements.");
+            }
+
+            [[noreturn, gnu::cold, gnu::noinline]] inline void abort_out_of_range(unsigned long index, unsigned long size) {
+                std::fprintf(stderr, "Index %lu is out of range for size %lu\n", index, size);
+                std::abort();
+            }
+
+            [[noreturn, gnu::cold, gnu::noinline]] inline void abort_empty_container() {
+                std::fprintf(stderr, "Dynamic array is empty. Cannot erase elements.\n");
+                std::abort();
+            }
+        }
+
+        struct unchecked {
+            static constexpr void check_index(unsigned long, unsigned long) noexcept {}
+            static constexpr void check_not_empty(unsigned long) noexcept {}
+        };
+
+        struct assert_checked {
+            static constexpr void check_index([[maybe_unused]] unsigned long index, [[maybe_unused]] unsigned long size) noexcept {
+                assert(index < size && "Index is out of range");
+            }
+
+            static constexpr void check_not_empty([[maybe_unused]] unsigned long size) noexcept {
+                assert(size > 0 && "Dynamic array is empty");
+            }
+        };
+
+        struct throw_checked {
+            static constexpr void check_index(unsigned long index, unsigned long size) {
+                if(index < size) [[likely]] {
+                    return;
+                }
+                detail::throw_out_of_range(index, size);
+            }
+
+            static constexpr void check_not_empty(unsigned long size) {
+                if(size > 0) [[likely]] {
+                    return;
+                }
+                detail::throw_empty_container();
+            }
+        };
+
+        struct abort_checked {
+            static constexpr void check_index(unsigned long index, unsigned long size) noexcept {
+                if(index < size) [[likely]] {
+                    return;
+                }
+                detail::abort_out_of_range(index, size);
+            }
+
+            static constexpr void check_not_empty(unsigned long size) noexcept {
+                if(size > 0) [[likely]] {
+                    return;
+                }
+                detail::abort_empty_container();
+            }
+        };
+
+#if DATA_STRUCTURES_BOUNDS_CHECK == DATA_STRUCTURES_BOUNDS_CHECK_NONE
+        using default_bounds_check = unchecked;
+#elif DATA_STRUCTURES_BOUNDS_CHECK == DATA_STRUCTURES_BOUNDS_CHECK_ASSERT
+        using default_bounds_check = assert_checked;
+#elif DATA_STRUCTURES_BOUNDS_CHECK == DATA_STRUCTURES_BOUNDS_CHECK_ABORT
+        using default_bounds_check = abort_checked;
+#else
+        using default_bounds_check = throw_checked;
+#endif
+    }
+}
+
+#endif
@@ -0,0 +1,236 @@
+#ifndef DATA_STRUCTURES_LINEAR_COW_ARRAY_HPP
+#define DATA_STRUCTURES_LINEAR_COW_ARRAY_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "data_structures/src/linear/dynamic_array.hpp"
+
+namespace data_structures {
+    namespace linear {
+
+        // A dynamic_array behind an atomically reference counted buffer. Copies share the
+        // buffer, so passing one by value costs a counter increment; the first mutation
+        // through a copy that is not the only user of its buffer copies the values first.
+        // Reads never copy. Copies may be handed to other threads, but a single cow_array
+        // object is no more thread safe than a dynamic_array. References and iterators
+        // obtained from a shared array stay valid until this array is next mutated.
+        template<class T, class Allocator = std::allocator<T>>
+        class cow_array {
+            public:
+                using array_type = dynamic_array<T, Allocator>;
+                using value_type = T;
+                using size_type = unsigned long;
+                using reference = T&;
+                using const_reference = const T&;
+                using const_pointer = const T*;
+                using const_iterator = typename array_type::const_iterator;
+
+            private:
+                struct shared_buffer {
+                    std::atomic<size_type> references{1};
+                    array_type values;
+
+                    explicit shared_buffer(array_type&& initial) : values(std::move(initial)) {}
+                };
+
+                shared_buffer* buffer_ = nullptr;
+
+                static const array_type& empty_array() {
+                    static const array_type empty;
+                    return empty;
+                }
+
+                void release() noexcept {
+                    if(buffer_ != nullptr && buffer_->references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                        delete buffer_;
+                    }
+                    buffer_ = nullptr;
+                }
+
+                // Makes this the only user of its buffer with room for at least capacity values.
+                // An unshared copy gets exactly that many slots, or the current size if larger,
+                // from the shared buffer's allocator.
+                array_type& unique_values(size_type capacity) {
+                    if(buffer_ == nullptr) {
+                        buffer_ = new shared_buffer(array_type());
+                    }
+                    else if(buffer_->references.load(std::memory_order_acquire) != 1) {
+                        array_type copy(buffer_->values.get_allocator());
+                        copy.reserve_exact(std::max(capacity, buffer_->values.size()));
+                        for(const T& value : buffer_->values) {
+                            copy.push_back(value);
+                        }
+                        shared_buffer* fresh = new shared_buffer(std::move(copy));
+                        release();
+                        buffer_ = fresh;
+                    }
+                    return buffer_->values;
+                }
+
+                void check_index(size_type index) const {
+                    if(index >= size()) {
+                        throw std::out_of_range("Index " + std::to_string(index) + " is out of range for a cow array of size " + std::to_string(size()) + ".");
+                    }
+                }
+
+            public:
+                cow_array() noexcept = default;
+
+                explicit cow_array(array_type values) : buffer_(new shared_buffer(std::move(values))) {}
+
+                cow_array(size_type n, const T& value) : cow_array(array_type(n, value)) {}
+
+                template<class InputIt>
+                cow_array(InputIt first, InputIt last) : cow_array(array_type(first, last)) {}
+
+                cow_array(std::initializer_list<T> values) : cow_array(values.begin(), values.end()) {}
+
+                cow_array(const cow_array& other) noexcept : buffer_(other.buffer_) {
+                    if(buffer_ != nullptr) {
+                        buffer_->references.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+
+                cow_array(cow_array&& other) noexcept : buffer_(std::exchange(other.buffer_, nullptr)) {}
+
+                cow_array& operator=(cow_array other) noexcept {
+                    swap(other);
+                    return *this;
+                }
+
+                ~cow_array() {
+                    release();
+                }
+
+                void swap(cow_array& other) noexcept {
+                    std::swap(buffer_, other.buffer_);
+                }
+
+                // Number of cow_arrays sharing this buffer, or zero for an array that never held values.
+                size_type use_count() const noexcept {
+                    return buffer_ == nullptr ? 0 : buffer_->references.load(std::memory_order_acquire);
+                }
+
+                bool is_shared() const noexcept {
+                    return use_count() > 1;
+                }
+
+                // Copies the values now if they are shared, so later mutations do not.
+                void unshare() {
+                    if(buffer_ != nullptr) {
+                        unique_values(buffer_->values.size());
+                    }
+                }
+
+                const array_type& values() const noexcept {
+                    return buffer_ == nullptr ? empty_array() : buffer_->values;
+                }
+
+                // Unshares and returns the underlying array for bulk changes.
+                array_type& mutable_values() {
+                    return unique_values(size());
+                }
+
+                size_type size() const noexcept {
+                    return buffer_ == nullptr ? 0 : buffer_->values.size();
+                }
+
+                [[nodiscard]] bool empty() const noexcept {
+                    return size() == 0;
+                }
+
+                size_type capacity() const noexcept {
+                    return buffer_ == nullptr ? 0 : buffer_->values.capacity();
+                }
+
+                const_pointer data() const noexcept {
+                    return values().data();
+                }
+
+                const_reference operator[](size_type index) const noexcept {
+                    return data()[index];
+                }
+
+                const_reference at(size_type index) const {
+                    check_index(index);
+                    return data()[index];
+                }
+
+                const_reference front() const noexcept {
+                    return data()[0];
+                }
+
+                const_reference back() const noexcept {
+                    return data()[size() - 1];
+                }
+
+                const_iterator begin() const noexcept {
+                    return values().cbegin();
+                }
+
+                const_iterator end() const noexcept {
+                    return values().cend();
+                }
+
+                // Unshares and returns a mutable reference to the value at index.
+                reference mutable_at(size_type index) {
+                    check_index(index);
+                    return unique_values(size()).data()[index];
+                }
+
+                void set(size_type index, T value) {
+                    mutable_at(index) = std::move(value);
+                }
+
+                void push_back(const T& value) {
+                    unique_values(size() + 1).push_back(value);
+                }
+
+                void push_back(T&& value) {
+                    unique_values(size() + 1).push_back(std::move(value));
+                }
+
+                template<class... Args>
+                void emplace_back(Args&&... args) {
+                    unique_values(size() + 1).emplace_back(std::forward<Args>(args)...);
+                }
+
+                void pop_back() {
+                    if(empty()) {
+                        throw std::out_of_range("Cannot pop from an empty cow array.");
+                    }
+                    unique_values(size()).pop_back();
+                }
+
+                void reserve(size_type n) {
+                    unique_values(n).reserve(n);
+                }
+
+                void resize(size_type n, const T& fill_value = T()) {
+                    unique_values(n).resize(n, fill_value);
+                }
+
+                // Drops a shared buffer instead of copying it only to empty the copy.
+                void clear() {
+                    if(is_shared()) {
+                        release();
+                    }
+                    else if(buffer_ != nullptr) {
+                        buffer_->values.clear();
+                    }
+                }
+
+                bool operator==(const cow_array& other) const {
+                    return buffer_ == other.buffer_ || std::equal(begin(), end(), other.begin(), other.end());
+                }
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,461 @@
+#ifndef DATA_STRUCTURES_LINEAR_DEQUE_HPP
+#define DATA_STRUCTURES_LINEAR_DEQUE_HPP
+
+#include <algorithm>
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "data_structures/src/linear/dynamic_array.hpp"
+
+namespace data_structures {
+    namespace linear {
+
+        namespace detail {
+            // The largest power of two that keeps a block within 4KB, so positions split into
+            // block and offset with a shift and a mask.
+            template<class T>
+            constexpr unsigned long default_deque_block_size() {
+                return std::max(16ul, std::bit_floor(4096 / sizeof(T)));
+            }
+        }
+
+        // A double ended queue over fixed size blocks. A map of block pointers covers a range
+        // of absolute positions and the elements occupy [start, start + size) of it, so element
+        // i sits at block (start + i) / BlockSize. Pushing at either end constructs in place and
+        // allocates a block only when it crosses a block boundary; growing the map moves block
+        // pointers, never elements, so references stay valid until their element is popped.
+        // One freed block is kept back so a queue hovering around a boundary does not allocate
+        // on every push.
+        template<class T, unsigned long BlockSize = detail::default_deque_block_size<T>(), class Allocator = std::allocator<T>>
+        class deque {
+            static_assert(std::has_single_bit(BlockSize), "Deque blocks must hold a power of two elements.");
+
+            public:
+                using value_type = T;
+                using reference = value_type&;
+                using const_reference = const value_type&;
+                using pointer = value_type*;
+                using const_pointer = const value_type*;
+                using size_type = unsigned long;
+                using allocator_type = Allocator;
+
+                static constexpr size_type block_size = BlockSize;
+
+            private:
+                static constexpr unsigned int block_shift = std::countr_zero(BlockSize);
+                static constexpr size_type offset_mask = BlockSize - 1;
+
+                using map_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<T*>;
+                using block_map = dynamic_array<T*, map_allocator, no_instrumentation, unchecked>;
+
+                template<bool Const>
+                class basic_iterator {
+                    public:
+                        using iterator_category = std::random_access_iterator_tag;
+                        using value_type = T;
+                        using difference_type = std::ptrdiff_t;
+                        using pointer = std::conditional_t<Const, const T*, T*>;
+                        using reference = std::conditional_t<Const, const T&, T&>;
+
+                        basic_iterator() = default;
+
+                        basic_iterator(T* const* blocks, size_type position) : blocks_(blocks), position_(position) {}
+
+                        template<bool OtherConst> requires (Const && !OtherConst)
+                        basic_iterator(const basic_iterator<OtherConst>& other) : blocks_(other.blocks_), position_(other.position_) {}
+
+                        reference operator*() const {
+                            return blocks_[position_ >> block_shift][position_ & offset_mask];
+                        }
+
+                        pointer operator->() const {
+                            return &**this;
+                        }
+
+                        reference operator[](difference_type n) const {
+                            return *(*this + n);
+                        }
+
+                        basic_iterator& operator++() {
+                            ++position_;
+                            return *this;
+                        }
+
+                        basic_iterator operator++(int) {
+                            basic_iterator temp = *this;
+                            ++position_;
+                            return temp;
+                        }
+
+                        basic_iterator& operator--() {
+                            --position_;
+                            return *this;
+                        }
+
+                        basic_iterator operator--(int) {
+                            basic_iterator temp = *this;
+                            --position_;
+                            return temp;
+                        }
+
+                        basic_iterator& operator+=(difference_type n) {
+                            position_ += n;
+                            return *this;
+                        }
+
+                        basic_iterator& operator-=(difference_type n) {
+                            position_ -= n;
+                            return *this;
+                        }
+
+                        basic_iterator operator+(difference_type n) const {
+                            return basic_iterator(blocks_, position_ + n);
+                        }
+
+                        basic_iterator operator-(difference_type n) const {
+                            return basic_iterator(blocks_, position_ - n);
+                        }
+
+                        friend basic_iterator operator+(difference_type n, const basic_iterator& other) {
+                            return other + n;
+                        }
+
+                        difference_type operator-(const basic_iterator& other) const {
+                            return static_cast<difference_type>(position_) - static_cast<difference_type>(other.position_);
+                        }
+
+                        bool operator==(const basic_iterator& other) const {
+                            return position_ == other.position_;
+                        }
+
+                        std::strong_ordering operator<=>(const basic_iterator& other) const {
+                            return position_ <=> other.position_;
+                        }
+
+                    private:
+                        template<bool>
+                        friend class basic_iterator;
+
+                        T* const* blocks_ = nullptr;
+                        size_type position_ = 0;
+                };
+
+            public:
+                using iterator = basic_iterator<false>;
+                using const_iterator = basic_iterator<true>;
+                using reverse_iterator = std::reverse_iterator<iterator>;
+                using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+            private:
+                block_map map_;
+                size_type start_ = 0;
+                size_type size_ = 0;
+                T* spare_ = nullptr;
+                Allocator alloc_;
+
+                T* allocate_block() {
+                    if(spare_ != nullptr) {
+                        return std::exchange(spare_, nullptr);
+                    }
+                    return std::allocator_traits<Allocator>::allocate(alloc_, BlockSize);
+                }
+
+                void free_block(size_type block) noexcept {
+                    T* freed = std::exchange(map_[block], nullptr);
+                    if(spare_ == nullptr) {
+                        spare_ = freed;
+                    }
+                    else {
+                        std::allocator_traits<Allocator>::deallocate(alloc_, freed, BlockSize);
+                    }
+                }
+
+                T& slot(size_type position) noexcept {
+                    return map_[position >> block_shift][position & offset_mask];
+                }
+
+                const T& slot(size_type position) const noexcept {
+                    return map_[position >> block_shift][position & offset_mask];
+                }
+
+                // Recentres the blocks in use so at least one free map entry remains on each side,
+                // doubling the map when they would fill more than half of it.
+                void grow_map() {
+                    size_type first_block = start_ >> block_shift;
+                    size_type used_blocks = size_ == 0 ? 0 : ((start_ + size_ - 1) >> block_shift) - first_block + 1;
+                    size_type map_size = map_.size();
+                    if(map_size < 2 * used_blocks + 2) {
+                        map_size = std::max<size_type>(8, 2 * used_blocks + 2);
+                    }
+                    size_type new_first = (map_size - used_blocks) / 2;
+                    block_map map;
+                    map.resize(map_size, nullptr);
+                    for(size_type block = 0; block < used_blocks; ++block) {
+                        map[new_first + block] = map_[first_block + block];
+                    }
+                    map_.swap(map);
+                    start_ = (new_first << block_shift) | (start_ & offset_mask);
+                }
+
+                void check_index(size_type index) const {
+                    if(index >= size_) {
+                        throw std::out_of_range("Index " + std::to_string(index) + " is out of range for a deque of size " + std::to_string(size_) + ".");
+                    }
+                }
+
+                void check_not_empty(const char* operation) const {
+                    if(size_ == 0) {
+                        throw std::out_of_range(std::string("Cannot ") + operation + " an empty deque.");
+                    }
+                }
+
+            public:
+                deque() : deque(Allocator()) {}
+
+                explicit deque(const Allocator& alloc) : alloc_(alloc) {}
+
+                template<class InputIt>
+                deque(InputIt first, InputIt last, const Allocator& alloc = Allocator()) : deque(alloc) {
+                    for(; first != last; ++first) {
+                        emplace_back(*first);
+                    }
+                }
+
+                deque(std::initializer_list<T> values, const Allocator& alloc = Allocator()) : deque(values.begin(), values.end(), alloc) {}
+
+                deque(const deque& other) : deque(other.begin(), other.end(), std::allocator_traits<Allocator>::select_on_container_copy_construction(other.alloc_)) {}
+
+                deque(deque&& other) noexcept : deque(other.alloc_) {
+                    swap(other);
+                }
+
+                deque& operator=(const deque& other) {
+                    if(this != &other) {
+                        deque copy(other);
+                        swap(copy);
+                    }
+                    return *this;
+                }
+
+                deque& operator=(deque&& other) noexcept {
+                    if(this != &other) {
+                        clear();
+                        swap(other);
+                    }
+                    return *this;
+                }
+
+                ~deque() {
+                    clear();
+                    if(spare_ != nullptr) {
+                        std::allocator_traits<Allocator>::deallocate(alloc_, spare_, BlockSize);
+                    }
+                }
+
+                void swap(deque& other) noexcept {
+                    map_.swap(other.map_);
+                    std::swap(start_, other.start_);
+                    std::swap(size_, other.size_);
+                    std::swap(spare_, other.spare_);
+                    std::swap(alloc_, other.alloc_);
+                }
+
+                [[nodiscard]] size_type size() const noexcept {
+                    return size_;
+                }
+
+                [[nodiscard]] bool empty() const noexcept {
+                    return size_ == 0;
+                }
+
+                allocator_type get_allocator() const noexcept {
+                    return alloc_;
+                }
+
+                reference operator[](size_type index) noexcept {
+                    return slot(start_ + index);
+                }
+
+                const_reference operator[](size_type index) const noexcept {
+                    return slot(start_ + index);
+                }
+
+                reference at(size_type index) {
+                    check_index(index);
+                    return slot(start_ + index);
+                }
+
+                const_reference at(size_type index) const {
+                    check_index(index);
+                    return slot(start_ + index);
+                }
+
+                reference front() noexcept {
+                    return slot(start_);
+                }
+
+                const_reference front() const noexcept {
+                    return slot(start_);
+                }
+
+                reference back() noexcept {
+                    return slot(start_ + size_ - 1);
+                }
+
+                const_reference back() const noexcept {
+                    return slot(start_ + size_ - 1);
+                }
+
+                template<class... Args>
+                reference emplace_back(Args&&... args) {
+                    if(((start_ + size_) >> block_shift) >= map_.size()) {
+                        grow_map();
+                    }
+                    size_type position = start_ + size_;
+                    size_type block = position >> block_shift;
+                    bool fresh_block = size_ == 0 || (position & offset_mask) == 0;
+                    if(fresh_block) {
+                        map_[block] = allocate_block();
+                    }
+                    try {
+                        std::allocator_traits<Allocator>::construct(alloc_, &slot(position), std::forward<Args>(args)...);
+                    }
+                    catch(...) {
+                        if(fresh_block) {
+                            free_block(block);
+                        }
+                        throw;
+                    }
+                    ++size_;
+                    return slot(position);
+                }
+
+                template<class... Args>
+                reference emplace_front(Args&&... args) {
+                    if(start_ == 0) {
+                        grow_map();
+                    }
+                    size_type position = start_ - 1;
+                    size_type block = position >> block_shift;
+                    bool fresh_block = size_ == 0 || (position & offset_mask) == offset_mask;
+                    if(fresh_block) {
+                        map_[block] = allocate_block();
+                    }
+                    try {
+                        std::allocator_traits<Allocator>::construct(alloc_, &slot(position), std::forward<Args>(args)...);
+                    }
+                    catch(...) {
+                        if(fresh_block) {
+                            free_block(block);
+                        }
+                        throw;
+                    }
+                    start_ = position;
+                    ++size_;
+                    return slot(position);
+                }
+
+                void push_back(const T& value) {
+                    emplace_back(value);
+                }
+
+                void push_back(T&& value) {
+                    emplace_back(std::move(value));
+                }
+
+                void push_front(const T& value) {
+                    emplace_front(value);
+                }
+
+                void push_front(T&& value) {
+                    emplace_front(std::move(value));
+                }
+
+                void pop_back() {
+                    check_not_empty("pop_back from");
+                    size_type position = start_ + size_ - 1;
+                    std::allocator_traits<Allocator>::destroy(alloc_, &slot(position));
+                    --size_;
+                    if(size_ == 0 || (position & offset_mask) == 0) {
+                        free_block(position >> block_shift);
+                    }
+                }
+
+                void pop_front() {
+                    check_not_empty("pop_front from");
+                    size_type position = start_;
+                    std::allocator_traits<Allocator>::destroy(alloc_, &slot(position));
+                    ++start_;
+                    --size_;
+                    if(size_ == 0 || (position & offset_mask) == offset_mask) {
+                        free_block(position >> block_shift);
+                    }
+                }
+
+                void clear() noexcept {
+                    while(size_ > 0) {
+                        size_type position = start_ + size_ - 1;
+                        std::allocator_traits<Allocator>::destroy(alloc_, &slot(position));
+                        --size_;
+                        if(size_ == 0 || (position & offset_mask) == 0) {
+                            free_block(position >> block_shift);
+                        }
+                    }
+                }
+
+                [[nodiscard]] iterator begin() noexcept {
+                    return iterator(map_.data(), start_);
+                }
+
+                [[nodiscard]] iterator end() noexcept {
+                    return iterator(map_.data(), start_ + size_);
+                }
+
+                [[nodiscard]] const_iterator begin() const noexcept {
+                    return const_iterator(map_.data(), start_);
+                }
+
+                [[nodiscard]] const_iterator end() const noexcept {
+                    return const_iterator(map_.data(), start_ + size_);
+                }
+
+                [[nodiscard]] const_iterator cbegin() const noexcept {
+                    return begin();
+                }
+
+                [[nodiscard]] const_iterator cend() const noexcept {
+                    return end();
+                }
+
+                [[nodiscard]] reverse_iterator rbegin() noexcept {
+                    return reverse_iterator(end());
+                }
+
+                [[nodiscard]] reverse_iterator rend() noexcept {
+                    return reverse_iterator(begin());
+                }
+
+                [[nodiscard]] const_reverse_iterator crbegin() const noexcept {
+                    return const_reverse_iterator(cend());
+                }
+
+                [[nodiscard]] const_reverse_iterator crend() const noexcept {
+                    return const_reverse_iterator(cbegin());
+                }
+
+                bool operator==(const deque& other) const {
+                    return std::equal(begin(), end(), other.begin(), other.end());
+                }
+        };
+    }
+}
+
+#endif
@@ -1,12 +1,25 @@
+#ifndef DATA_STRUCTURES_LINEAR_DYNAMIC_ARRAY_HPP
+#define DATA_STRUCTURES_LINEAR_DYNAMIC_ARRAY_HPP
 
+#include <algorithm>
+#include <array>
 #include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
 #include <initializer_list>
 #include <iterator>
 #include <memory>
+#include <new>
 #include <pthread.h>
+#include <span>
 #include <string>
 #include <stdexcept>
 #include <type_traits>
+#include <utility>
+
+#include "data_structures/src/linear/bounds_check.hpp"
+#include "data_structures/src/linear/dynamic_array_instrumentation.hpp"
 
 namespace data_structures {
     namespace linear {
@@ -24,87 +37,87 @@ namespace data_structures {
              private:
                 pointer curr_ptr_;
              public:
-                dynamic_array_iterator(): curr_ptr_(nullptr) {};
-                dynamic_array_iterator(pointer start_ptr) : curr_ptr_(start_ptr) {};
-                dynamic_array_iterator(const dynamic_array_iterator& other) : curr_ptr_(other.get_pointer()) {};
+                constexpr dynamic_array_iterator(): curr_ptr_(nullptr) {};
+                constexpr dynamic_array_iterator(pointer start_ptr) : curr_ptr_(start_ptr) {};
+                constexpr dynamic_array_iterator(const dynamic_array_iterator& other) : curr_ptr_(other.get_pointer()) {};
                 ~dynamic_array_iterator() = default;
 
-                inline dynamic_array_iterator& operator=(const dynamic_array_iterator& other) = default;
+                constexpr dynamic_array_iterator& operator=(const dynamic_array_iterator& other) = default;
 
-                inline dynamic_array_iterator& operator=(const pointer other_ptr) {
+                constexpr dynamic_array_iterator& operator=(const pointer other_ptr) {
                     curr_ptr_ = other_ptr;
                     return *this;
                 }
 
-                inline dynamic_array_iterator& operator++() {
+                constexpr dynamic_array_iterator& operator++() {
                     ++curr_ptr_;
                     return *this;
                 }
 
-                inline dynamic_array_iterator operator++(int) {
+                constexpr dynamic_array_iterator operator++(int) {
                     dynamic_array_iterator temp = dynamic_array_iterator(*this);
                     ++curr_ptr_;
                     return temp;
                 }
 
-                inline dynamic_array_iterator& operator--() {
+                constexpr dynamic_array_iterator& operator--() {
                     --curr_ptr_;
                     return *this;
                 }
 
-                inline dynamic_array_iterator operator--(int) {
+                constexpr dynamic_array_iterator operator--(int) {
                     dynamic_array_iterator temp = dynamic_array_iterator(*this);
                     --curr_ptr_;
                     return temp;
                 }
 
-                inline reference operator*() const {
+                constexpr reference operator*() const {
                     return *curr_ptr_;
                 }
 
-                inline pointer operator->() const {
+                constexpr pointer operator->() const {
                     return curr_ptr_;
                 }
 
-                inline pointer operator[](const difference_type n) const {
+                constexpr pointer operator[](const difference_type n) const {
                     return curr_ptr_ + n;
                 }
                 
-                inline dynamic_array_iterator& operator+=(const difference_type n) {
+                constexpr dynamic_array_iterator& operator+=(const difference_type n) {
                     curr_ptr_ += n;
                     return *this;
                 }
 
-                inline dynamic_array_iterator& operator-=(const difference_type n) {
+                constexpr dynamic_array_iterator& operator-=(const difference_type n) {
                     curr_ptr_ -= n;
                     return *this;
                 }
 
-                inline difference_type operator-(dynamic_array_iterator& other) const {
+                constexpr difference_type operator-(dynamic_array_iterator& other) const {
                     return curr_ptr_ - other.get_pointer();
                 }
 
-                inline dynamic_array_iterator operator-(const difference_type n) const {
+                constexpr dynamic_array_iterator operator-(const difference_type n) const {
                     return dynamic_array_iterator(get_pointer() - n);
                 }
 
-                inline dynamic_array_iterator operator+(const difference_type n) const {
+                constexpr dynamic_array_iterator operator+(const difference_type n) const {
                     return dynamic_array_iterator(get_pointer() + n);
                 }
 
-                friend inline dynamic_array_iterator operator+(const difference_type n, const dynamic_array_iterator other) {
+                friend constexpr dynamic_array_iterator operator+(const difference_type n, const dynamic_array_iterator other) {
                     return dynamic_array_iterator(n + other.get_pointer());
                 }
 
-                friend inline dynamic_array_iterator operator-(const difference_type n, const dynamic_array_iterator other) {
+                friend constexpr dynamic_array_iterator operator-(const difference_type n, const dynamic_array_iterator other) {
                     return dynamic_array_iterator(n - other.get_pointer());
                 }
 
-                inline bool operator==(const dynamic_array_iterator& other) const {
+                constexpr bool operator==(const dynamic_array_iterator& other) const {
                     return curr_ptr_ == other.get_pointer();
                 }
 
-                inline std::strong_ordering operator<=>(const dynamic_array_iterator& other) const {
+                constexpr std::strong_ordering operator<=>(const dynamic_array_iterator& other) const {
                     if(curr_ptr_ > other.get_pointer()) {
                         return std::strong_ordering::greater;
                     }
@@ -114,7 +127,7 @@ namespace data_structures {
                     return std::strong_ordering::equivalent;
                 }
 
-                inline pointer get_pointer() const {
+                constexpr pointer get_pointer() const {
                     return curr_ptr_;
                 }
         };
@@ -132,89 +145,89 @@ namespace data_structures {
              private:
                 pointer curr_ptr_;
             public:
-                dynamic_array_const_iterator(): curr_ptr_(nullptr) {};
-                dynamic_array_const_iterator(pointer start_ptr) : curr_ptr_(start_ptr) {};
-                dynamic_array_const_iterator(const dynamic_array_const_iterator& other) : curr_ptr_(other.get_pointer()) {};
-                dynamic_array_const_iterator(const dynamic_array_iterator<T>& other) : 
+                constexpr dynamic_array_const_iterator(): curr_ptr_(nullptr) {};
+                constexpr dynamic_array_const_iterator(pointer start_ptr) : curr_ptr_(start_ptr) {};
+                constexpr dynamic_array_const_iterator(const dynamic_array_const_iterator& other) : curr_ptr_(other.get_pointer()) {};
+                constexpr dynamic_array_const_iterator(const dynamic_array_iterator<T>& other) : 
                     curr_ptr_(const_cast<pointer>(other.get_pointer())) {};
                 ~dynamic_array_const_iterator() = default;
 
-                inline dynamic_array_const_iterator& operator=(const dynamic_array_const_iterator& other) = default;
+                constexpr dynamic_array_const_iterator& operator=(const dynamic_array_const_iterator& other) = default;
 
-                inline dynamic_array_const_iterator& operator=(const pointer other_ptr) {
+                constexpr dynamic_array_const_iterator& operator=(const pointer other_ptr) {
                     curr_ptr_ = other_ptr;
                     return *this;
                 }
 
-                inline dynamic_array_const_iterator& operator++() {
+                constexpr dynamic_array_const_iterator& operator++() {
                     ++curr_ptr_;
                     return *this;
                 }
 
-                inline dynamic_array_const_iterator operator++(int) {
+                constexpr dynamic_array_const_iterator operator++(int) {
                     dynamic_array_const_iterator temp = dynamic_array_const_iterator(*this);
                     ++curr_ptr_;
                     return temp;
                 }
 
-                inline dynamic_array_const_iterator& operator--() {
+                constexpr dynamic_array_const_iterator& operator--() {
                     --curr_ptr_;
                     return *this;
                 }
 
-                inline dynamic_array_const_iterator operator--(int) {
+                constexpr dynamic_array_const_iterator operator--(int) {
                     dynamic_array_const_iterator temp = dynamic_array_const_iterator(*this);
                     --curr_ptr_;
                     return temp;
                 }
 
-                inline reference operator*() const {
+                constexpr reference operator*() const {
                     return *curr_ptr_;
                 }
 
-                inline pointer operator->() const {
+                constexpr pointer operator->() const {
                     return curr_ptr_;
                 }
 
-                inline pointer operator[](const difference_type n) const {
+                constexpr pointer operator[](const difference_type n) const {
                     return curr_ptr_ + n;
                 }
                 
-                inline dynamic_array_const_iterator& operator+=(const difference_type n) {
+                constexpr dynamic_array_const_iterator& operator+=(const difference_type n) {
                     curr_ptr_ += n;
                     return *this;
                 }
 
-                inline dynamic_array_const_iterator& operator-=(const difference_type n) {
+                constexpr dynamic_array_const_iterator& operator-=(const difference_type n) {
                     curr_ptr_ -= n;
                     return *this;
                 }
 
-                inline difference_type operator-(dynamic_array_const_iterator& other) const {
+                constexpr difference_type operator-(dynamic_array_const_iterator& other) const {
                     return curr_ptr_ - other.get_pointer();
                 }
 
-                inline dynamic_array_const_iterator operator-(const difference_type n) const {
+                constexpr dynamic_array_const_iterator operator-(const difference_type n) const {
                     return dynamic_array_const_iterator(get_pointer() - n);
                 }
 
-                inline dynamic_array_const_iterator operator+(const difference_type n) const {
+                constexpr dynamic_array_const_iterator operator+(const difference_type n) const {
                     return dynamic_array_const_iterator(get_pointer() + n);
                 }
 
-                friend inline dynamic_array_const_iterator operator+(const difference_type n, const dynamic_array_const_iterator other) {
+                friend constexpr dynamic_array_const_iterator operator+(const difference_type n, const dynamic_array_const_iterator other) {
                     return dynamic_array_const_iterator(n + other.get_pointer());
                 }
 
-                friend inline dynamic_array_const_iterator operator-(const difference_type n, const dynamic_array_const_iterator other) {
+                friend constexpr dynamic_array_const_iterator operator-(const difference_type n, const dynamic_array_const_iterator other) {
                     return dynamic_array_const_iterator(n - other.get_pointer());
                 }
 
-                inline bool operator==(const dynamic_array_const_iterator& other) const {
+                constexpr bool operator==(const dynamic_array_const_iterator& other) const {
                     return curr_ptr_ == other.get_pointer();
                 }
 
-                inline std::strong_ordering operator<=>(const dynamic_array_const_iterator& other) const {
+                constexpr std::strong_ordering operator<=>(const dynamic_array_const_iterator& other) const {
                     if(curr_ptr_ > other.get_pointer()) {
                         return std::strong_ordering::greater;
                     }
@@ -226,7 +239,7 @@ namespace data_structures {
                     }
                 }
 
-                inline pointer get_pointer() const {
+                constexpr pointer get_pointer() const {
                     return curr_ptr_;
                 }
         };
@@ -244,87 +257,87 @@ namespace data_structures {
             private:
                 pointer base_ptr = nullptr;
             public:
-                dynamic_array_reverse_iterator() = default;
-                dynamic_array_reverse_iterator(pointer start_ptr): base_ptr(start_ptr) {};
+                constexpr dynamic_array_reverse_iterator() = default;
+                constexpr dynamic_array_reverse_iterator(pointer start_ptr): base_ptr(start_ptr) {};
 
-                dynamic_array_reverse_iterator(const dynamic_array_reverse_iterator& other) : base_ptr(other.get_pointer()) {};
-                dynamic_array_reverse_iterator(const dynamic_array_iterator<T>& other) : base_ptr(other) {};
+                constexpr dynamic_array_reverse_iterator(const dynamic_array_reverse_iterator& other) : base_ptr(other.get_pointer()) {};
+                constexpr dynamic_array_reverse_iterator(const dynamic_array_iterator<T>& other) : base_ptr(other) {};
 
                 ~dynamic_array_reverse_iterator() = default;
 
-                inline dynamic_array_reverse_iterator& operator++() {
+                constexpr dynamic_array_reverse_iterator& operator++() {
                     --base_ptr;
                     return *this;
                 }
 
-                inline dynamic_array_reverse_iterator operator++(int) {
+                constexpr dynamic_array_reverse_iterator operator++(int) {
                     dynamic_array_reverse_iterator temp = *this;
                     --base_ptr;
                     return temp;
                 }
 
-                inline dynamic_array_reverse_iterator& operator--() {
+                constexpr dynamic_array_reverse_iterator& operator--() {
                     ++base_ptr;
                     return *this;
                 }
 
-                inline dynamic_array_reverse_iterator operator--(int) {
+                constexpr dynamic_array_reverse_iterator operator--(int) {
                     dynamic_array_reverse_iterator temp = *this;
                     ++base_ptr;
                     return temp;
                 }
 
-                inline pointer operator[](const difference_type n) const {
+                constexpr pointer operator[](const difference_type n) const {
                     return base_ptr - n;
                 }
 
-                inline reference operator*() const {
+                constexpr reference operator*() const {
                     return *base_ptr;
                 }
 
-                inline pointer operator->() const {
+                constexpr pointer operator->() const {
                     return base_ptr;
                 } 
 
-                inline dynamic_array_reverse_iterator& operator+=(difference_type n) {
+                constexpr dynamic_array_reverse_iterator& operator+=(difference_type n) {
                     base_ptr -= n;
                     return *this;
                 }
 
-                inline dynamic_array_reverse_iterator& operator-=(difference_type n) {
+                constexpr dynamic_array_reverse_iterator& operator-=(difference_type n) {
                     base_ptr += n;
                     return *this;
                 }
 
-                inline difference_type operator-(dynamic_array_reverse_iterator& other) const {
+                constexpr difference_type operator-(dynamic_array_reverse_iterator& other) const {
                     return other.get_pointer() - base_ptr;
                 }
 
-                inline dynamic_array_reverse_iterator operator-(const difference_type n) const {
+                constexpr dynamic_array_reverse_iterator operator-(const difference_type n) const {
                     return dynamic_array_reverse_iterator(base_ptr + n);
                 }
 
-                inline dynamic_array_reverse_iterator operator+(const difference_type n) const {
+                constexpr dynamic_array_reverse_iterator operator+(const difference_type n) const {
                     return dynamic_array_reverse_iterator(base_ptr - n);
                 }
 
-                friend inline dynamic_array_reverse_iterator operator+(const difference_type n, const dynamic_array_reverse_iterator other) {
+                friend constexpr dynamic_array_reverse_iterator operator+(const difference_type n, const dynamic_array_reverse_iterator other) {
                     return dynamic_array_reverse_iterator(n - other.get_pointer());
                 }
 
-                friend inline dynamic_array_reverse_iterator operator-(const difference_type n, const dynamic_array_reverse_iterator other) {
+                friend constexpr dynamic_array_reverse_iterator operator-(const difference_type n, const dynamic_array_reverse_iterator other) {
                     return dynamic_array_reverse_iterator(n + other.get_pointer());
                 }
 
-                inline pointer get_pointer() const {
+                constexpr pointer get_pointer() const {
                     return base_ptr;
                 }
 
-                inline bool operator==(const dynamic_array_reverse_iterator& other) const {
+                constexpr bool operator==(const dynamic_array_reverse_iterator& other) const {
                     return base_ptr == other.get_pointer();
                 }
 
-                inline std::strong_ordering operator<=>(const dynamic_array_reverse_iterator& other) const {
+                constexpr std::strong_ordering operator<=>(const dynamic_array_reverse_iterator& other) const {
                     pointer other_pointer = other.get_pointer();
                     if(base_ptr > other_pointer) {
                         return std::strong_ordering::less;
@@ -349,87 +362,87 @@ namespace data_structures {
             private:
                 pointer base_ptr = nullptr;
             public:
-                dynamic_array_reverse_const_iterator() = default;
-                dynamic_array_reverse_const_iterator(pointer start_ptr): base_ptr(start_ptr) {};
+                constexpr dynamic_array_reverse_const_iterator() = default;
+                constexpr dynamic_array_reverse_const_iterator(pointer start_ptr): base_ptr(start_ptr) {};
 
-                dynamic_array_reverse_const_iterator(const dynamic_array_reverse_const_iterator& other) : base_ptr(other.get_pointer()) {};
-                dynamic_array_reverse_const_iterator(const dynamic_array_const_iterator<T>& other) : base_ptr(other) {};
+                constexpr dynamic_array_reverse_const_iterator(const dynamic_array_reverse_const_iterator& other) : base_ptr(other.get_pointer()) {};
+                constexpr dynamic_array_reverse_const_iterator(const dynamic_array_const_iterator<T>& other) : base_ptr(other) {};
 
                 ~dynamic_array_reverse_const_iterator() = default;
 
-                inline dynamic_array_reverse_const_iterator& operator++() {
+                constexpr dynamic_array_reverse_const_iterator& operator++() {
                     --base_ptr;
                     return *this;
                 }
 
-                inline dynamic_array_reverse_const_iterator operator++(int) {
+                constexpr dynamic_array_reverse_const_iterator operator++(int) {
                     dynamic_array_reverse_const_iterator temp = *this;
                     --base_ptr;
                     return temp;
                 }
 
-                inline dynamic_array_reverse_const_iterator& operator--() {
+                constexpr dynamic_array_reverse_const_iterator& operator--() {
                     ++base_ptr;
                     return *this;
                 }
 
-                inline dynamic_array_reverse_const_iterator operator--(int) {
+                constexpr dynamic_array_reverse_const_iterator operator--(int) {
                     dynamic_array_reverse_const_iterator temp = *this;
                     ++base_ptr;
                     return temp;
                 }
 
-                inline pointer operator[](const difference_type n) const {
+                constexpr pointer operator[](const difference_type n) const {
                     return base_ptr - n;
                 }
 
-                inline reference operator*() const {
+                constexpr reference operator*() const {
                     return *base_ptr;
                 }
 
-                inline pointer operator->() const {
+                constexpr pointer operator->() const {
                     return base_ptr;
                 } 
 
-                inline dynamic_array_reverse_const_iterator& operator+=(difference_type n) {
+                constexpr dynamic_array_reverse_const_iterator& operator+=(difference_type n) {
                     base_ptr -= n;
                     return *this;
                 }
 
-                inline dynamic_array_reverse_const_iterator& operator-=(difference_type n) {
+                constexpr dynamic_array_reverse_const_iterator& operator-=(difference_type n) {
                     base_ptr += n;
                     return *this;
                 }
 
-                inline difference_type operator-(dynamic_array_reverse_const_iterator& other) const {
+                constexpr difference_type operator-(dynamic_array_reverse_const_iterator& other) const {
                     return other.get_pointer() - base_ptr;
                 }
 
-                inline dynamic_array_reverse_const_iterator operator-(const difference_type n) const {
+                constexpr dynamic_array_reverse_const_iterator operator-(const difference_type n) const {
                     return dynamic_array_reverse_const_iterator(get_pointer() + n);
                 }
 
-                inline dynamic_array_reverse_const_iterator operator+(const difference_type n) const {
+                constexpr dynamic_array_reverse_const_iterator operator+(const difference_type n) const {
                     return dynamic_array_reverse_const_iterator(get_pointer() - n);
                 }
 
-                friend inline dynamic_array_reverse_const_iterator operator+(const difference_type n, const dynamic_array_reverse_const_iterator other) {
+                friend constexpr dynamic_array_reverse_const_iterator operator+(const difference_type n, const dynamic_array_reverse_const_iterator other) {
                     return dynamic_array_reverse_const_iterator(n - other.get_pointer());
                 }
 
-                friend inline dynamic_array_reverse_const_iterator operator-(const difference_type n, const dynamic_array_reverse_const_iterator other) {
+                friend constexpr dynamic_array_reverse_const_iterator operator-(const difference_type n, const dynamic_array_reverse_const_iterator other) {
                     return dynamic_array_reverse_const_iterator(n + other.get_pointer());
                 }
 
-                inline pointer get_pointer() const {
+                constexpr pointer get_pointer() const {
                     return base_ptr;
                 }
 
-                inline bool operator==(const dynamic_array_reverse_const_iterator& other) const {
+                constexpr bool operator==(const dynamic_array_reverse_const_iterator& other) const {
                     return base_ptr == other.get_pointer();
                 }
 
-                inline std::strong_ordering operator<=>(const dynamic_array_reverse_const_iterator& other) const {
+                constexpr std::strong_ordering operator<=>(const dynamic_array_reverse_const_iterator& other) const {
                     pointer other_pointer = other.get_pointer();
                     if(base_ptr > other_pointer) {
                         return std::strong_ordering::less;
@@ -442,7 +455,10 @@ namespace data_structures {
         };
 
 
-        template<class T, class Allocator = std::allocator<T>>
+        template<class T>
+        concept implicit_lifetime_element = std::is_trivially_default_constructible_v<T> && std::is_trivially_destructible_v<T>;
+
+        template<class T, class Allocator = std::allocator<T>, class Instrumentation = no_instrumentation, class BoundsCheck = default_bounds_check>
         class dynamic_array {
             public:
                 using value_type = T;
@@ -456,6 +472,8 @@ namespace data_structures {
                 using reverse_iterator = dynamic_array_reverse_iterator<T>;
                 using const_reverse_iterator = dynamic_array_reverse_const_iterator<T>;
                 using allocator_type = Allocator;
+                using instrumentation_type = Instrumentation;
+                using bounds_check_type = BoundsCheck;
 
             private:
                 size_type size_;
@@ -464,26 +482,23 @@ namespace data_structures {
                 pointer end_;
                 pointer end_of_storage_;
                 Allocator alloc_;
+                [[no_unique_address]] Instrumentation instrumentation_;
 
                 constexpr void check_range(size_type index) const {
-                    if(index < 0 || index >= size_) {
-                        throw std::out_of_range("Index is either less than 0 and greater than " + std::to_string(size_));
-                    }
+                    BoundsCheck::check_index(index, size_);
                 }
 
-                constexpr void check_size() {
-                    if(size_ == 0) {
-                        throw std::runtime_error("Dynamic array is empty. Cannot erase elements.");
-                    }
+                constexpr void check_size() const {
+                    BoundsCheck::check_not_empty(size_);
                 }
 
-                void set_metadata(size_type n, size_type capacity, const Allocator& alloc) {
+                constexpr void set_metadata(size_type n, size_type capacity, const Allocator& alloc) {
                     size_ = n;
                     capacity_ = capacity;
                     alloc_ = alloc;
                 }
 
-                size_type get_new_capacity(size_type threshold) const {
+                constexpr size_type get_new_capacity(size_type threshold) const {
                     size_type new_capacity = 1;
                     while(new_capacity < threshold) {
                         new_capacity <<= 2;
@@ -491,9 +506,9 @@ namespace data_structures {
                     return new_capacity;
                 }
 
-                void reassign_alloc(pointer new_array, size_type new_size, size_type new_capacity) {
+                constexpr void reassign_alloc(pointer new_array, size_type new_size, size_type new_capacity) {
                     destroy_range(begin(), end());
-                    destroy_space(beg_, size_);
+                    destroy_space(beg_, capacity_);
                     size_ = new_size;
                     beg_ = new_array;
                     end_ = new_array + new_size;
@@ -501,187 +516,236 @@ namespace data_structures {
                     end_of_storage_ = beg_ + capacity_;
                 }
 
-                void assign_range(iterator destination, iterator first, iterator last) {
+                constexpr void assign_range(iterator destination, iterator first, iterator last) {
                     for(; first != last; ++destination, ++first) {
                         *destination = *first;
                     }
                 }
 
-                void copy_range(iterator destination, iterator first, iterator last) {
+                constexpr void copy_range(iterator destination, iterator first, iterator last) {
                     for(; first != last; ++destination, ++first) {
                         std::allocator_traits<Allocator>::construct(alloc_, destination, *first);
                     }
                 }
 
-                void copy_range(iterator first, iterator last, value_type value) {
+                constexpr void copy_range(iterator first, iterator last, value_type value) {
                     for(; first != last; ++first) {
                         std::allocator_traits<Allocator>::construct(alloc_, first, value);
                     }
                 }
 
-                void destroy_range(iterator first, iterator last) {
+                // memmove is not usable in constant evaluation, which falls back to the element
+                // wise move every other type takes.
+                constexpr void shift_range(size_type destination, size_type first, size_type last) {
+                    if(destination == first || first == last) {
+                        return;
+                    }
+                    if constexpr(std::is_trivially_copyable_v<T>) {
+                        if(!std::is_constant_evaluated()) {
+                            std::memmove(beg_ + destination, beg_ + first, (last - first) * sizeof(value_type));
+                            instrumentation_.on_move(last - first);
+                            return;
+                        }
+                    }
+                    std::move(beg_ + first, beg_ + last, beg_ + destination);
+                    instrumentation_.on_move(last - first);
+                }
+
+                // Moves [index, size_) n slots to the right within capacity. Slots that land past
+                // the old end are constructed rather than assigned, since only [0, size_) is live.
+                // Returns the old size; gap slots below it are live, the rest are raw.
+                constexpr size_type open_gap(size_type index, size_type n) {
+                    size_type old_size = size_;
+                    for(size_type destination = old_size + n; destination > index + n; --destination) {
+                        if(destination - 1 >= old_size) {
+                            std::allocator_traits<Allocator>::construct(alloc_, beg_ + destination - 1, std::move(beg_[destination - 1 - n]));
+                        }
+                        else {
+                            beg_[destination - 1] = std::move(beg_[destination - 1 - n]);
+                        }
+                    }
+                    return old_size;
+                }
+
+                template<class Value>
+                constexpr void fill_gap_slot(size_type index, size_type old_size, Value&& value) {
+                    if(index < old_size) {
+                        beg_[index] = std::forward<Value>(value);
+                    }
+                    else {
+                        std::allocator_traits<Allocator>::construct(alloc_, beg_ + index, std::forward<Value>(value));
+                    }
+                }
+
+                constexpr void destroy_range(iterator first, iterator last) {
                     for(; first != last; ++first) {
                         std::allocator_traits<Allocator>::destroy(alloc_,  &(*first));
                     }
                 }
 
-                void destroy_space(pointer space_start, size_type space_size) {
-                    std::allocator_traits<Allocator>::deallocate(alloc_, space_start, space_size);
+                constexpr void destroy_space(pointer space_start, size_type space_size) {
+                    if(space_start != nullptr) {
+                        std::allocator_traits<Allocator>::deallocate(alloc_, space_start, space_size);
+                    }
                 }
 
-                pointer create_space(size_type space_size) {
-                    return std::allocator_traits<Allocator>::allocate(alloc_, space_size);
+                constexpr pointer create_space(size_type space_size) {
+                    pointer space = std::allocator_traits<Allocator>::allocate(alloc_, space_size);
+                    instrumentation_.on_allocate(space_size, space_size * sizeof(value_type));
+                    return space;
                 }
 
-                void grow(size_type threshold) {
-                    size_type new_capacity = get_new_capacity(threshold);
-                    pointer new_array = nullptr;
+                // Records count values built from a Source, which copies unless the source
+                // hands out rvalues, as move_iterator and generators returning by value do.
+                template<class Source>
+                constexpr void count_constructions(size_type count) noexcept {
+                    if constexpr(std::is_lvalue_reference_v<Source>) {
+                        instrumentation_.on_copy(count);
+                    }
+                    else {
+                        instrumentation_.on_move(count);
+                    }
+                }
+
+                // Moves every value into new storage of new_capacity, leaving gap_size slots at
+                // gap_index that fill constructs first, so values that alias the old storage are
+                // read before anything moves. The old storage is released only once every value
+                // is in place; a throw unwinds what was built and leaves the array untouched.
+                template<class Fill>
+                constexpr void relocate(size_type new_capacity, size_type gap_index, size_type gap_size, Fill&& fill) {
+                    pointer new_array = create_space(new_capacity);
+                    size_type filled_values = 0;
                     size_type copied_values = 0;
-                    try {  
-                        new_array = std::allocator_traits<Allocator>::allocate(alloc_, new_capacity);
+                    try {
+                        for(; filled_values < gap_size; ++filled_values) {
+                            fill(new_array + gap_index + filled_values);
+                        }
                         for(; copied_values < size_; ++copied_values) {
-                            std::allocator_traits<Allocator>::construct(alloc_, new_array + copied_values, beg_[copied_values]);
+                            size_type destination = copied_values < gap_index ? copied_values : copied_values + gap_size;
+                            std::allocator_traits<Allocator>::construct(alloc_, new_array + destination, std::move_if_noexcept(beg_[copied_values]));
                         }
-                        destroy_range(begin(), end());
-                        destroy_space(beg_, size_);
-                        beg_ = new_array;
-                        end_ = new_array+size_;
-                        end_of_storage_ = new_array + new_capacity;
-                        capacity_ = new_capacity;
                     }
-                    catch(std::exception ex) {
-                        for(; copied_values > 0; --copied_values) {
-                            std::allocator_traits<Allocator>::destroy(alloc_, new_array + copied_values);
+                    catch(...) {
+                        for(size_type index = 0; index < filled_values; ++index) {
+                            std::allocator_traits<Allocator>::destroy(alloc_, new_array + gap_index + index);
+                        }
+                        for(size_type index = 0; index < copied_values; ++index) {
+                            std::allocator_traits<Allocator>::destroy(alloc_, new_array + (index < gap_index ? index : index + gap_size));
                         }
                         destroy_space(new_array, new_capacity);
-                        throw ex;
+                        throw;
+                    }
+                    if constexpr(std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+                        instrumentation_.on_move(size_);
+                    }
+                    else {
+                        instrumentation_.on_copy(size_);
+                    }
+                    if(beg_ != nullptr) {
+                        instrumentation_.on_reallocate();
                     }
+                    reassign_alloc(new_array, size_ + gap_size, new_capacity);
                 }
 
-            public:
+                constexpr void grow(size_type threshold) {
+                    relocate(get_new_capacity(threshold), size_, 0, [](pointer) {});
+                }
 
-                explicit dynamic_array(const Allocator& alloc) : size_(0), capacity_(0), alloc_(alloc), 
-                                                                 beg_(nullptr), end_(nullptr), end_of_storage_(nullptr) { }
-
-                explicit dynamic_array(): dynamic_array(Allocator()) {}
-
-                dynamic_array(size_type n, const T& val, const Allocator& alloc = Allocator()): dynamic_array(alloc) {
-                    this->alloc_ = alloc;
-                    size_type initialized_values = 0;
-                    try {  
-                        capacity_ = get_new_capacity(n);
-                        beg_ = create_space(capacity_);
-                        for(; initialized_values < capacity_; ++initialized_values) {
-                            T value_to_copy;
-                            if(initialized_values < n) {
-                                value_to_copy = val;
-                            }
-                            else {
-                                value_to_copy = value_type();
-                            }
-                            std::allocator_traits<Allocator>::construct(alloc_, beg_ + initialized_values, value_to_copy);
+                // Builds count values from next() in fresh storage sized for them, freeing what
+                // was built if a construction throws.
+                template<class Next>
+                constexpr void construct_storage(size_type count, Next&& next) {
+                    size_type new_capacity = get_new_capacity(count);
+                    pointer new_array = create_space(new_capacity);
+                    size_type constructed_values = 0;
+                    try {
+                        for(; constructed_values < count; ++constructed_values) {
+                            std::allocator_traits<Allocator>::construct(alloc_, new_array + constructed_values, next());
                         }
-                        this->size_ = n;
-                        this->end_ = beg_ + size_;
-                        this->end_of_storage_ = beg_ + capacity_;
-                    } catch(std::exception ex) {
-                        for(; initialized_values > 0; --initialized_values) {
-                            std::allocator_traits<Allocator>::destroy(alloc_, beg_ + initialized_values);
+                    }
+                    catch(...) {
+                        for(size_type index = 0; index < constructed_values; ++index) {
+                            std::allocator_traits<Allocator>::destroy(alloc_, new_array + index);
                         }
-                        destroy_space(beg_, capacity_);
-                        size_ = capacity_ = 0;
-                        beg_ = end_ = end_of_storage_ = nullptr;
-                        throw ex;
+                        destroy_space(new_array, new_capacity);
+                        throw;
                     }
+                    count_constructions<decltype(next())>(count);
+                    reassign_alloc(new_array, count, new_capacity);
+                }
+
+            public:
+
+                constexpr explicit dynamic_array(const Allocator& alloc) : size_(0), capacity_(0), beg_(nullptr), end_(nullptr),
+                                                                           end_of_storage_(nullptr), alloc_(alloc) { }
+
+                constexpr explicit dynamic_array(): dynamic_array(Allocator()) {}
+
+                constexpr dynamic_array(size_type n, const T& val, const Allocator& alloc = Allocator()): dynamic_array(alloc) {
+                    construct_storage(n, [&val]() -> const T& { return val; });
                 }
 
-                explicit dynamic_array(size_type n, const Allocator& alloc = Allocator()): dynamic_array(n, T(), alloc) {}
+                constexpr explicit dynamic_array(size_type n, const Allocator& alloc = Allocator()): dynamic_array(n, T(), alloc) {}
 
+                // Copies only the live values into storage of exactly their size, as std::vector
+                // does; an empty source allocates nothing.
                 constexpr dynamic_array(const dynamic_array& other, const Allocator& alloc): dynamic_array(alloc) {
+                    if(other.size_ == 0) {
+                        return;
+                    }
                     size_type copied_values = 0;
+                    size_type new_capacity = other.size_;
+                    pointer new_array = create_space(new_capacity);
                     try {
-                        set_metadata(other.size(), other.capacity(), alloc);
-                        beg_ = create_space(capacity_);
-                        for(; copied_values < other.capacity(); ++copied_values) {
-                            value_type value_to_copy;
-                            if(copied_values < other.size()) {
-                                value_to_copy = other[copied_values];
-                            }
-                            else {
-                                value_to_copy = value_type();
-                            }
-                            std::allocator_traits<Allocator>::construct(alloc_, beg_ + copied_values, value_to_copy);
+                        for(; copied_values < other.size_; ++copied_values) {
+                            std::allocator_traits<Allocator>::construct(alloc_, new_array + copied_values, other.beg_[copied_values]);
                         }
-                        end_ = beg_ + size_;
-                        end_of_storage_ = beg_+capacity_; 
                     }
-                    catch(std::exception ex) {
-                        for(; copied_values > 0; --copied_values) {
-                            std::allocator_traits<Allocator>::destroy(alloc_, beg_ + copied_values);
+                    catch(...) {
+                        for(size_type i = 0; i < copied_values; ++i) {
+                            std::allocator_traits<Allocator>::destroy(alloc_, new_array + i);
                         }
-                        destroy_space(beg_, other.capacity_);
-                        size_ = capacity_ = 0;
-                        beg_ = end_ = end_of_storage_ = nullptr;
-                        throw ex;
+                        destroy_space(new_array, new_capacity);
+                        throw;
                     }
+                    instrumentation_.on_copy(other.size_);
+                    size_ = other.size_;
+                    capacity_ = new_capacity;
+                    beg_ = new_array;
+                    end_ = beg_ + size_;
+                    end_of_storage_ = beg_ + capacity_;
                 }
 
-                dynamic_array(dynamic_array&& other, const Allocator& alloc) {
+                constexpr dynamic_array(dynamic_array&& other, const Allocator& alloc) {
                     set_metadata(other.size_, other.capacity_, alloc);
                     beg_ = other.beg_;
                     end_ = other.end_;
                     end_of_storage_ = other.end_of_storage_;
 
-                    other.beg_ = other.end_ = nullptr;
+                    other.beg_ = other.end_ = other.end_of_storage_ = nullptr;
                     other.capacity_ = other.size_ = 0;
+                    std::swap(instrumentation_, other.instrumentation_);
                 }
-                
-                dynamic_array(const dynamic_array& other) : dynamic_array(other, Allocator()) {}
 
-                template<class InputIt>
-                dynamic_array(InputIt first, InputIt last, const Allocator& alloc = Allocator()) {
-                    alloc_ = alloc;
-                    size_type initialized_values = 0;
-                    try {
-                        size_ = std::distance(first, last);
-                        capacity_ = get_new_capacity(size_);
-                        beg_ = create_space(capacity_);
-                        for(; initialized_values < capacity_; ++initialized_values) {
-                            value_type value_to_copy;
-                            if(initialized_values < size_) {
-                                value_to_copy = *(first++);
-                            }
-                            else {
-                                value_to_copy = value_type();
-                            }
-                            std::allocator_traits<Allocator>::construct(alloc_, beg_ + initialized_values, value_to_copy);
-                        }
-                        end_ = beg_ + size_;
-                        end_of_storage_ = beg_ + capacity_;
-                    }
-                    catch(std::exception ex) {
-                        for(; initialized_values > 0; --initialized_values) {
-                            std::allocator_traits<Allocator>::destroy(alloc_, beg_ + initialized_values);
-                        }
-                        destroy_space(beg_, capacity_);
-                        beg_ = end_ = end_of_storage_ = nullptr;
-                        size_ = capacity_ = 0;
-                        throw ex;
-                    }
-                    
+                constexpr dynamic_array(const dynamic_array& other) :
+                    dynamic_array(other, std::allocator_traits<Allocator>::select_on_container_copy_construction(other.alloc_)) {}
+
+                template<class InputIt> requires (!std::is_integral_v<InputIt>)
+                constexpr dynamic_array(InputIt first, InputIt last, const Allocator& alloc = Allocator()): dynamic_array(alloc) {
+                    construct_storage(std::distance(first, last), [&first]() -> decltype(auto) { return *(first++); });
                 }
 
-                dynamic_array(std::initializer_list<T> insert_list) : dynamic_array(insert_list.begin(), insert_list.end()) { }
+                constexpr dynamic_array(std::initializer_list<T> insert_list) : dynamic_array(insert_list.begin(), insert_list.end()) { }
+
+                constexpr dynamic_array& operator=(const dynamic_array& other) {
 
-                dynamic_array& operator=(const dynamic_array& other) {
-                
                     if(this != &other) {
                         assign(other.cbegin(), other.cend());
                     }
                     return *this;
                 }
 
-                dynamic_array& operator=(dynamic_array&& other) noexcept {
+                constexpr dynamic_array& operator=(dynamic_array&& other) noexcept {
                     if(this == &other) {
                         return *this;
                     }
@@ -691,494 +755,474 @@ namespace data_structures {
                     return *this;
                 }
 
-                ~dynamic_array() {
+                constexpr ~dynamic_array() {
                    clear();
                     destroy_space(beg_, capacity_);
                     set_metadata(0, 0, alloc_);
                     beg_ = end_ = end_of_storage_ = nullptr;
                 }
 
-                dynamic_array(dynamic_array&& other) : dynamic_array(other, other.alloc_) {}
+                constexpr dynamic_array(dynamic_array&& other) noexcept : dynamic_array(std::move(other), other.alloc_) {}
 
-                void clear() {
+                constexpr void clear() {
                     destroy_range(begin(), end());
                     size_ = 0;
+                    end_ = beg_;
                 }
 
-                [[nodiscard]] iterator begin() noexcept {
+                [[nodiscard]] constexpr iterator begin() noexcept {
                     return dynamic_array_iterator<T>(beg_);
                 }
-                
-                [[nodiscard]] iterator end() noexcept {
+
+                [[nodiscard]] constexpr iterator end() noexcept {
                     return dynamic_array_iterator<T>(end_);
                 }
 
-                [[nodiscard]] const_iterator cbegin() const noexcept {
+                [[nodiscard]] constexpr const_iterator cbegin() const noexcept {
                     return dynamic_array_const_iterator<T>(beg_);
                 }
 
-                [[nodiscard]] const_iterator cend() const noexcept {
+                [[nodiscard]] constexpr const_iterator cend() const noexcept {
                     return dynamic_array_const_iterator<T>(end_);
                 }
 
-                [[nodiscard]] reverse_iterator rbegin() noexcept {
+                [[nodiscard]] constexpr reverse_iterator rbegin() noexcept {
                     return dynamic_array_reverse_iterator<T>(end_);
                 }
 
-                [[nodiscard]] reverse_iterator rend() noexcept {
+                [[nodiscard]] constexpr reverse_iterator rend() noexcept {
                     return dynamic_array_reverse_iterator<T>(beg_-1);
                 }
 
-                [[nodiscard]] const_reverse_iterator crbegin() const noexcept {
+                [[nodiscard]] constexpr const_reverse_iterator crbegin() const noexcept {
                     return dynamic_array_reverse_const_iterator<T>(end_);
                 }
 
-                [[nodiscard]] const_reverse_iterator crend() const noexcept {
+                [[nodiscard]] constexpr const_reverse_iterator crend() const noexcept {
                     return dynamic_array_reverse_const_iterator<T>(beg_-1);
                 }
-                
-                size_type size() const noexcept {
+
+                constexpr size_type size() const noexcept {
                     return size_;
                 }
 
-                size_type capacity() const noexcept {
+                constexpr size_type capacity() const noexcept {
                     return capacity_;
                 }
 
-                reference at(size_type index) {
+                constexpr pointer data() noexcept {
+                    return beg_;
+                }
+
+                constexpr const_pointer data() const noexcept {
+                    return beg_;
+                }
+
+                constexpr reference at(size_type index) {
                     check_range(index);
                     return beg_[index];
                 }
 
-                reference operator[](size_type index) {
+                constexpr reference operator[](size_type index) {
                     return at(index);
                 }
 
-                const_reference at(size_type index) const {
+                constexpr const_reference at(size_type index) const {
                     check_range(index);
                     return const_cast<const_reference>(beg_[index]);
                 }
 
-                const_reference operator[](size_type index) const {
+                constexpr const_reference operator[](size_type index) const {
                     return at(index);
                 }
 
-                reference front() {
+                constexpr reference front() {
                     return at(0);
                 }
 
-                const_reference front() const {
+                constexpr const_reference front() const {
                     return at(0);
                 }
 
-                reference back() {
+                constexpr reference back() {
                     return at(size_-1);
                 }
 
-                const_reference back() const {
+                constexpr const_reference back() const {
                     return at(size_-1);
                 }
 
-                void resize(const size_type n) {
+                constexpr void resize(const size_type n) {
                     resize(n, value_type());
                 }
 
-                void resize(const size_type n, const value_type& fill_value) {
+                constexpr void resize(const size_type n, const value_type& fill_value) {
                     if(n > capacity_) {
                        grow(n);
                     }
-                    if((n > size_ && n < capacity_)) {
+                    if(n > size_) {
                         size_type filled_values = 0;
                         size_type size_to_fill = n-size_;
                         try {
                             for(; filled_values < size_to_fill; ++filled_values) {
-                                std::allocator_traits<Allocator>::construct(alloc_, beg_ + size_ + filled_values);
+                                std::allocator_traits<Allocator>::construct(alloc_, beg_ + size_ + filled_values, fill_value);
                             }
-                            size_ = size_to_fill;
                         }
-                        catch(std::exception ex) {
+                        catch(...) {
                             for(; filled_values > 0; --filled_values) {
-                                std::allocator_traits<Allocator>::destroy(alloc_, beg_ + size_ + filled_values);
+                                std::allocator_traits<Allocator>::destroy(alloc_, beg_ + size_ + (filled_values-1));
                             }
-                            throw ex;
+                            throw;
                         }
                     }
-                    else if(n == size_) {
-                        return;
+                    else if(n < size_) {
+                        destroy_range(begin()+n, end());
+                    }
+                    size_ = n;
+                    end_ = beg_ + size_;
+                }
+
+                // Constant evaluation has no indeterminate values, so there the new slots are
+                // value initialized instead.
+                constexpr void resize_for_overwrite(const size_type n) requires std::default_initializable<T> {
+                    if(n > capacity_) {
+                        grow(n);
+                    }
+                    if(n > size_) {
+                        if(std::is_constant_evaluated()) {
+                            for(size_type index = size_; index < n; ++index) {
+                                std::construct_at(beg_ + index);
+                            }
+                        }
+                        else if constexpr(!std::is_trivially_default_constructible_v<T>) {
+                            size_type filled_values = 0;
+                            try {
+                                for(; filled_values < n - size_; ++filled_values) {
+                                    ::new(static_cast<void*>(beg_ + size_ + filled_values)) value_type;
+                                }
+                            }
+                            catch(...) {
+                                for(; filled_values > 0; --filled_values) {
+                                    std::allocator_traits<Allocator>::destroy(alloc_, beg_ + size_ + (filled_values-1));
+                                }
+                                throw;
+                            }
+                        }
                     }
                     else if(n < size_) {
                         destroy_range(begin()+n, end());
                     }
-                    else if(n == 0) {
-                        clear();
+                    size_ = n;
+                    end_ = beg_ + size_;
+                }
+
+                // As with resize_for_overwrite, constant evaluation value initializes the new slots.
+                constexpr void resize_uninitialized(const size_type n) requires implicit_lifetime_element<T> {
+                    if(n > capacity_) {
+                        grow(n);
+                    }
+                    if(std::is_constant_evaluated()) {
+                        for(size_type index = size_; index < n; ++index) {
+                            std::construct_at(beg_ + index);
+                        }
                     }
+                    size_ = n;
+                    end_ = beg_ + size_;
                 }
-                
-                void reserve(size_type n) {
+
+                constexpr std::span<value_type> append_uninitialized(const size_type n) requires implicit_lifetime_element<T> {
+                    size_type append_index = size_;
+                    resize_uninitialized(size_ + n);
+                    return std::span<value_type>(beg_ + append_index, n);
+                }
+
+                constexpr void reserve(size_type n) {
                     if(capacity_ < n) {
                         grow(n);
                     }
                 }
 
-                allocator_type get_allocator() const noexcept {
+                // Like reserve, but allocates exactly n slots instead of rounding up to the next
+                // growth step, for containers whose size has a fixed bound.
+                constexpr void reserve_exact(size_type n) {
+                    if(capacity_ < n) {
+                        relocate(n, size_, 0, [](pointer) {});
+                    }
+                }
+
+                constexpr allocator_type get_allocator() const noexcept {
                     return alloc_;
                 }
 
-                void push_back(const value_type& val) {
-                    reserve(size_+1);
-                    std::allocator_traits<Allocator>::construct(alloc_, end_, val);
-                    size_ += 1;
-                    end_ = beg_ + size_;
+                constexpr const instrumentation_type& get_instrumentation() const noexcept {
+                    return instrumentation_;
                 }
 
-                void push_back(value_type&& val) {
-                    push_back(val);
-                    val = nullptr;
+                constexpr void push_back(const value_type& val) {
+                    emplace_back(val);
+                    instrumentation_.on_copy(1);
+                }
+
+                constexpr void push_back(value_type&& val) {
+                    emplace_back(std::move(val));
+                    instrumentation_.on_move(1);
                 }
 
                 constexpr void pop_back() noexcept(std::is_nothrow_destructible_v<pointer>) {
                     if(size_ > 0) {
                         std::allocator_traits<Allocator>::destroy(alloc_, beg_ + (size_-1));
                         --size_;
+                        end_ = beg_ + size_;
                     }
                 }
 
-                iterator insert(const_iterator pos, const T& value) {
+                constexpr iterator insert(const_iterator pos, const T& value) {
                     return insert(pos, 1, value);
                 }
 
-                iterator insert(const_iterator pos, T&& value) {
+                constexpr iterator insert(const_iterator pos, T&& value) {
                     iterator return_iter = insert(pos, 1, std::move(value));
                     return return_iter;
                 }
 
-                iterator insert(const_iterator pos, size_type n, const T& value) {
+                constexpr iterator insert(const_iterator pos, size_type n, const T& value) {
                     const_iterator start_pos = cbegin();
                     size_type insert_index = pos-start_pos;
                     size_type new_size = size_ + n;
-                    size_type copied_values = 0;
-                    if(new_size >= capacity_) {
-                        size_type new_capacity = get_new_capacity(new_size);
-                        pointer new_array = nullptr;
-                        try {
-                            new_array = create_space(new_capacity);
-                            for(; copied_values < new_capacity; ++copied_values) {
-                                value_type value_to_copy;
-                                if(copied_values < insert_index) {
-                                    value_to_copy = beg_[copied_values];
-                                } else if(copied_values >= insert_index && copied_values < insert_index+n){
-                                    value_to_copy = value;
-                                }
-                                else if (copied_values >= insert_index+n && copied_values < new_size){
-                                    value_to_copy = beg_[copied_values-n];
-                                }
-                                else {
-                                    value_to_copy = value_type();
-                                }
-                                std::allocator_traits<Allocator>::construct(alloc_, new_array + copied_values, value_to_copy);
-                            }
-
-                            destroy_range(begin(), end());
-                            destroy_space(beg_, capacity_);
-                            capacity_ = new_capacity;
-                            beg_ = new_array;
-                            end_ = new_array + new_size;
-                            end_of_storage_ = new_array + capacity_;
-                        }
-                        catch(std::exception ex) {
-                            for(; copied_values > 0; --copied_values) {
-                                std::allocator_traits<Allocator>::destroy(alloc_, new_array + copied_values);
-                            }
-                            destroy_space(new_array, new_size);
-                            throw ex;
-                        }
-                        
+                    if(new_size > capacity_) {
+                        relocate(get_new_capacity(new_size), insert_index, n, [this, &value](pointer slot) {
+                            std::allocator_traits<Allocator>::construct(alloc_, slot, value);
+                        });
+                        instrumentation_.on_copy(n);
                     }
                     else {
-                        size_type i = size_ + n;
-                        for(; i > insert_index+n; --i) {
-                            beg_[i] = std::move(beg_[i-n]);
-                        }
-                        for(; i > insert_index; --i) {
-                            std::allocator_traits<Allocator>::construct(alloc_, beg_ + i, value);
+                        size_type old_size = open_gap(insert_index, n);
+                        for(size_type i = insert_index; i < insert_index + n; ++i) {
+                            fill_gap_slot(i, old_size, value);
                         }
+                        end_ = beg_ + new_size;
+                        instrumentation_.on_move(size_ - insert_index);
+                        instrumentation_.on_copy(n);
+                        size_ = new_size;
                     }
-
-                    size_ = new_size;
                     return iterator(beg_+insert_index);
                 }
 
-                template<class InputIt>
-                iterator insert(const_iterator pos, InputIt first, InputIt last) {
+                template<class InputIt> requires (!std::is_integral_v<InputIt>)
+                constexpr iterator insert(const_iterator pos, InputIt first, InputIt last) {
                     size_type input_size = 0;
                     const_iterator start_pos = cbegin();
                     size_type insert_index = pos-start_pos;
                     for(InputIt find_range = first; find_range != last; ++find_range, ++input_size);
 
                     size_type new_size = size_ + input_size;
-                    if(new_size >= capacity_) {
-                        size_type new_capacity = get_new_capacity(size_+input_size);
-                        pointer new_array = nullptr;
-                        size_type copied_values = 0;
-
-                        try{
-                            new_array = create_space(new_capacity);
-                            for(; copied_values < new_capacity; ++copied_values) {
-                                value_type value_to_copy;
-                                if(copied_values < insert_index) {
-                                    value_to_copy = beg_[copied_values];
-                                }
-                                else if (copied_values >= insert_index && copied_values < insert_index+input_size && first != last){
-                                    value_to_copy = *(first++);
-                                }
-                                else if (copied_values >= insert_index+input_size && copied_values < new_size) {
-                                    value_to_copy = beg_[copied_values-input_size];
-                                }
-                                else {
-                                    value_to_copy = value_type();
-                                }
-                                std::allocator_traits<Allocator>::construct(alloc_, new_array + copied_values, value_to_copy);
-                            }
-                        }
-                        catch(std::exception e) {
-                            for(; copied_values > 0; --copied_values) {
-                                std::allocator_traits<Allocator>::destroy(alloc_, new_array + copied_values);
-                            }
-                            destroy_space(new_array, new_capacity);
-                            throw e;
-                        }
-                        destroy_range(begin(), end());
-                        destroy_space(beg_, capacity_);
-                        capacity_ = new_capacity;
-                        beg_ = new_array;
-                        end_ = new_array + new_size;
-                        end_of_storage_ = new_array + capacity_;
+                    if(new_size > capacity_) {
+                        relocate(get_new_capacity(new_size), insert_index, input_size, [this, &first](pointer slot) {
+                            std::allocator_traits<Allocator>::construct(alloc_, slot, *(first++));
+                        });
                     }
                     else {
-                        size_type i = size_ + input_size;
-                        for(; i > insert_index + input_size; --i) {
-                            beg_[i] = std::move(beg_[i-input_size]);
-                        }
-                        for(i = insert_index; i < insert_index+input_size && first != last; ++i) {
-                            beg_[i] = *(first++);
+                        size_type old_size = open_gap(insert_index, input_size);
+                        for(size_type i = insert_index; i < insert_index + input_size && first != last; ++i) {
+                            fill_gap_slot(i, old_size, *(first++));
                         }
+                        end_ = beg_ + new_size;
+                        instrumentation_.on_move(old_size - insert_index);
+                        size_ = new_size;
                     }
-                    
-                    size_ = new_size;
-                    return iterator(beg_ + insert_index + input_size);
+                    count_constructions<decltype(*first)>(input_size);
+                    return iterator(beg_ + insert_index);
                 }
 
-                iterator insert(const_iterator pos, std::initializer_list<T> insert_list) {
-                    return insert(pos, insert_list.start(), insert_list.end());
+                constexpr iterator insert(const_iterator pos, std::initializer_list<T> insert_list) {
+                    return insert(pos, insert_list.begin(), insert_list.end());
                 }
 
-                iterator erase(iterator pos) {
+                constexpr iterator erase(iterator pos) {
                     return erase(pos, pos+1);
                 }
 
-                iterator erase(iterator start, iterator end) {
-                    check_size();
-                    iterator start_pos = begin();
-                    size_type erase_start_index = start-start_pos;
-                    size_type erase_range = end-start;
-                    size_type new_size = size_-erase_range;
-                    
-                    destroy_range(start, end);
-                    for(size_type i = erase_start_index; i < new_size; ++i) {
-                        beg_[i] = std::move(beg_[i+erase_range]);
-                    }
-                    
-                    size_ = new_size;
-                    return iterator(beg_+erase_start_index-erase_range);
+                constexpr iterator erase(iterator start, iterator end) {
+                    return erase(const_iterator(start), const_iterator(end));
                 }
 
                 constexpr iterator erase(const_iterator pos) {
                     return erase(pos, pos+1);
                 }
 
+                // Moves the tail down over the erased values and then destroys the leftover
+                // slots at the end, so every slot is assigned only while it is live.
                 constexpr iterator erase(const_iterator start, const_iterator end) {
                     check_size();
                     const_iterator start_pos = cbegin();
                     size_type erase_start_index = start-start_pos;
                     size_type erase_range = end-start;
                     size_type new_size = size_-erase_range;
-                    
-                    for(; start != end; ++start) {
-                        std::allocator_traits<Allocator>::destroy(alloc_, &(*start));
-                    }
+
                     for(size_type i = erase_start_index; i < new_size; ++i) {
                         beg_[i] = std::move(beg_[i+erase_range]);
                     }
+                    instrumentation_.on_move(new_size - erase_start_index);
+                    destroy_range(iterator(beg_ + new_size), iterator(end_));
 
                     size_ = new_size;
-                    return iterator(beg_+erase_start_index-erase_range);
+                    end_ = beg_ + size_;
+                    return iterator(beg_+erase_start_index);
                 }
 
+                template<class Predicate>
+                constexpr size_type erase_if(Predicate pred) {
+                    size_type kept_values = 0;
+                    if constexpr(std::is_trivially_copyable_v<T>) {
+                        for(size_type index = 0; index < size_; ++index) {
+                            value_type value = beg_[index];
+                            beg_[kept_values] = value;
+                            kept_values += !static_cast<bool>(pred(value));
+                        }
+                        instrumentation_.on_move(kept_values);
+                    }
+                    else {
+                        size_type moved_values = 0;
+                        for(size_type index = 0; index < size_; ++index) {
+                            if(!pred(beg_[index])) {
+                                if(kept_values != index) {
+                                    beg_[kept_values] = std::move(beg_[index]);
+                                    ++moved_values;
+                                }
+                                ++kept_values;
+                            }
+                        }
+                        instrumentation_.on_move(moved_values);
+                    }
+                    size_type erased_values = size_ - kept_values;
+                    destroy_range(begin() + kept_values, end());
+                    size_ = kept_values;
+                    end_ = beg_ + size_;
+                    return erased_values;
+                }
+
+                constexpr size_type erase_indices(std::span<const size_type> sorted_indices) {
+                    size_type write_index = 0;
+                    size_type read_index = 0;
+                    for(size_type erase_index : sorted_indices) {
+                        if(erase_index < read_index) {
+                            continue;
+                        }
+                        check_range(erase_index);
+                        shift_range(write_index, read_index, erase_index);
+                        write_index += erase_index - read_index;
+                        read_index = erase_index + 1;
+                    }
+                    if(read_index == 0) {
+                        return 0;
+                    }
+                    shift_range(write_index, read_index, size_);
+                    write_index += size_ - read_index;
+
+                    size_type erased_values = size_ - write_index;
+                    destroy_range(begin() + write_index, end());
+                    size_ = write_index;
+                    end_ = beg_ + size_;
+                    return erased_values;
+                }
+
+                constexpr iterator unstable_erase(const_iterator pos) {
+                    check_size();
+                    const_iterator start_pos = cbegin();
+                    size_type erase_index = pos - start_pos;
+                    check_range(erase_index);
+                    if(erase_index != size_ - 1) {
+                        beg_[erase_index] = std::move(beg_[size_ - 1]);
+                        instrumentation_.on_move(1);
+                    }
+                    pop_back();
+                    return iterator(beg_ + erase_index);
+                }
+
+                // A full array builds the new value straight into the grown storage, before the
+                // old values move, so arguments that refer into the array stay valid.
                 template<class... Args>
-                void emplace_back(Args&&... args) {
-                    try {
-                        reserve(size_+1);
-                        std::allocator_traits<Allocator>::construct(alloc_, beg_+size_, std::forward<Args>(args)...);
-                        size_++;
-                        end_ = beg_ + size_;
-                    } catch(std::exception e) {
-                        throw e;
+                constexpr void emplace_back(Args&&... args) {
+                    if(size_ == capacity_) {
+                        relocate(get_new_capacity(size_+1), size_, 1, [&](pointer slot) {
+                            std::allocator_traits<Allocator>::construct(alloc_, slot, std::forward<Args>(args)...);
+                        });
+                        return;
                     }
+                    std::allocator_traits<Allocator>::construct(alloc_, end_, std::forward<Args>(args)...);
+                    size_++;
+                    end_ = beg_ + size_;
                 }
 
                 template<class... Args>
-                iterator emplace(const_iterator pos, Args&&... args) {
+                constexpr iterator emplace(const_iterator pos, Args&&... args) {
                     const_iterator start = cbegin();
                     size_type insert_index = pos-start;
                     if(size_+1 > capacity_) {
-                        pointer new_array = nullptr;
-                        size_type new_capacity = get_new_capacity(size_+1);
-                        size_type copied_values = 0;
-                        try {
-                            new_array = create_space(new_capacity);
-                            for(; copied_values < size_ + 1; ++copied_values) {
-                                value_type value_to_copy;
-                                if(copied_values < insert_index) {
-                                    value_to_copy = beg_[copied_values];
-                                }
-                                else if(copied_values > insert_index && copied_values < insert_index + 1) {
-                                    value_to_copy = value_type(std::forward<Args>(args)...);
-                                }
-                                else {
-                                    value_to_copy = beg_[copied_values-1];
-                                }
-                                std::allocator_traits<Allocator>::construct(alloc_, new_array + copied_values, value_to_copy);
-                            }
-                            destroy_range(begin(), end());
-                            destroy_space(beg_, capacity_);
-                            capacity_ = new_capacity;
-                            beg_ = new_array;
-                            end_ = new_array + size_;
-                            end_of_storage_ = new_array + capacity_;
-                        }
-                        catch(std::exception ex) {
-                            for(; copied_values > 0; --copied_values) {
-                                std::allocator_traits<Allocator>::destroy(alloc_, new_array + copied_values);
-                            }
-                            destroy_space(new_array, new_capacity);
-                            throw ex;
-                        }
+                        relocate(get_new_capacity(size_+1), insert_index, 1, [&](pointer slot) {
+                            std::allocator_traits<Allocator>::construct(alloc_, slot, std::forward<Args>(args)...);
+                        });
                     }
                     else {
-                        for(size_type i = size_; i > insert_index; --i) {
-                            beg_[i] = beg_[i-1];
-                        }
-                        std::allocator_traits<Allocator>::construct(alloc_, beg_ + insert_index, std::forward<Args>(args)...);
+                        value_type value(std::forward<Args>(args)...);
+                        size_type old_size = open_gap(insert_index, 1);
+                        fill_gap_slot(insert_index, old_size, std::move(value));
+                        size_++;
+                        end_ = beg_ + size_;
                     }
-                    size_++;
-                    return iterator(beg_+insert_index+1);
+                    return iterator(beg_+insert_index);
                 }
 
+            // Both assigns write over the live prefix, construct past it one slot at a time so a
+            // throw leaves a valid shorter array, and destroy whatever is left over.
             constexpr void assign(size_type count, const T& value) {
-                size_type copied_values = 0;
                 if(count > capacity_) {
-                    pointer new_array = nullptr;
-                    size_type new_capacity = get_new_capacity(count);
-                    try {
-                        new_array = create_space(new_capacity);
-                        for(; copied_values < count; ++copied_values) {
-                            std::allocator_traits<Allocator>::construct(alloc_, new_array+copied_values, value);
-                        }
-                       
-                    } catch(std::exception ex) {
-                        for(; copied_values > 0; --copied_values) {
-                            std::allocator_traits<Allocator>::destroy(alloc_, new_array+copied_values);
-                        }
-                        destroy_space(new_array, new_capacity);
-                        throw ex;
-                    }
-                    destroy_range(begin(), end());
-                    destroy_space(beg_, capacity_);
-                    capacity_ = new_capacity;
-                    size_ = count;
-                    beg_ = new_array;
-                    end_ = beg_ + size_;
-                    end_of_storage_ = beg_ + capacity_;
+                    construct_storage(count, [&value]() -> const T& { return value; });
+                    return;
                 }
-                else {
-                    try {
-                        for(; (copied_values < count) && (copied_values < size_); ++copied_values) {
-                            *(beg_ + copied_values) = value;
-                        }
-                        for(; copied_values < count; ++copied_values) {
-                            std::allocator_traits<Allocator>::construct(alloc_, beg_ + copied_values, value);
-                        }
-                        for(size_type index = size_; index > count; --index) {
-                            std::allocator_traits<Allocator>::destroy(alloc_, beg_ + index);
-                        }
-                    }
-                    catch(std::exception ex) {
-                        for(; copied_values > 0; --copied_values) {
-                            std::allocator_traits<Allocator>::destroy(alloc_, beg_ + (copied_values-1));
-                        }
-                        throw ex;
-                    }
-
-                    size_ = count;
+                size_type copied_values = 0;
+                for(; (copied_values < count) && (copied_values < size_); ++copied_values) {
+                    *(beg_ + copied_values) = value;
+                }
+                for(; copied_values < count; ++copied_values) {
+                    std::allocator_traits<Allocator>::construct(alloc_, beg_ + copied_values, value);
+                    size_ = copied_values + 1;
+                    end_ = beg_ + size_;
                 }
+                destroy_range(iterator(beg_ + count), end());
+                size_ = count;
+                end_ = beg_ + size_;
+                instrumentation_.on_copy(count);
             }
 
-            template<class InputIt>
+            template<class InputIt> requires (!std::is_integral_v<InputIt>)
             constexpr void assign(InputIt start, InputIt last) {
                 size_type insert_size = std::distance(start, last);
-                size_type copied_values = 0;
 
                 if(insert_size > capacity_) {
-                    pointer new_array = nullptr;
-                    size_type new_capacity = get_new_capacity(insert_size);
-                    try {
-                        new_array = create_space(new_capacity);
-                        for(;copied_values < insert_size && start != last; ++copied_values) {
-                            std::allocator_traits<Allocator>::construct(alloc_, new_array+copied_values, *(start++));
-                        }
-                        destroy_range(begin(), end());
-                        destroy_space(beg_, capacity_);
-                        size_ = insert_size;
-                        capacity_ = new_capacity;
-                        beg_ = new_array;
-                        end_ = beg_ + size_;
-                        end_of_storage_ = beg_ + capacity_;
-
-                    } catch(std::exception ex) {
-                        for(; copied_values > 0; ++copied_values) {
-                            std::allocator_traits<Allocator>::destroy(alloc_, new_array + copied_values);
-                        }
-                        destroy_space(new_array, new_capacity);
-                        throw ex;
-                    }
+                    construct_storage(insert_size, [&start]() -> decltype(auto) { return *(start++); });
+                    return;
                 }
-                else {
-                    try {
-                        for(; (copied_values < size_) && (copied_values < insert_size); ++copied_values) {
-                        *(beg_ + copied_values) = *(start++);
-                        }
-                        for(; (copied_values < insert_size) && (start != last); ++copied_values) {
-                            std::allocator_traits<Allocator>::construct(alloc_, beg_+copied_values, *(start++));
-                        }
-                        for(size_type index = size_; index > insert_size; --index) {
-                            std::allocator_traits<Allocator>::destroy(alloc_, beg_ + copied_values);
-                        }
-                        size_ = insert_size;
-                    }
-                    catch(std::exception ex) {
-                        for(; copied_values > 0; --copied_values) {
-                            std::allocator_traits<Allocator>::destroy(alloc_, beg_ + copied_values-1);
-                        }
-                        throw ex;
-                    }
+                size_type copied_values = 0;
+                for(; (copied_values < size_) && (copied_values < insert_size); ++copied_values) {
+                    *(beg_ + copied_values) = *(start++);
+                }
+                for(; (copied_values < insert_size) && (start != last); ++copied_values) {
+                    std::allocator_traits<Allocator>::construct(alloc_, beg_+copied_values, *(start++));
+                    size_ = copied_values + 1;
+                    end_ = beg_ + size_;
                 }
+                destroy_range(iterator(beg_ + insert_size), end());
+                size_ = insert_size;
+                end_ = beg_ + size_;
+                count_constructions<decltype(*start)>(insert_size);
             }
 
             constexpr void assign(std::initializer_list<T> init_list) {
                 assign(init_list.begin(), init_list.end());
             }
 
-            void swap(dynamic_array& other) noexcept(std::is_nothrow_swappable_v<pointer>) {
+            constexpr void swap(dynamic_array& other) noexcept(std::is_nothrow_swappable_v<pointer>) {
                 if(this == &other) {
                     return;
                 }
@@ -1188,21 +1232,27 @@ namespace data_structures {
                 pointer end_of_storage_temp = other.end_of_storage_;
                 size_type size_temp = other.size_;
                 size_type cap_temp = other.capacity_;
-            
+                Allocator alloc_temp = other.alloc_;
+
                 other.beg_ = beg_;
                 other.end_ = end_;
                 other.end_of_storage_ = end_of_storage_;
                 other.size_ = size_;
                 other.capacity_ = capacity_;
+                other.alloc_ = alloc_;
 
                 beg_ = begin_temp;
                 end_ = end_temp;
-                end_of_storage_ = end_of_storage_temp; 
+                end_of_storage_ = end_of_storage_temp;
                 size_ = size_temp;
                 capacity_ = cap_temp;
-            }   
+                alloc_ = alloc_temp;
 
-            constexpr bool operator==(const dynamic_array& other) {
+                // Counters describe the storage they were gathered on, so they travel with it.
+                std::swap(instrumentation_, other.instrumentation_);
+            }
+
+            constexpr bool operator==(const dynamic_array& other) const {
                 if(size_ != other.size()) {
                     return false;
                 }
@@ -1215,7 +1265,7 @@ namespace data_structures {
                 return true;
             }
 
-            constexpr std::weak_ordering operator<=>(const dynamic_array& other) {
+            constexpr std::weak_ordering operator<=>(const dynamic_array& other) const {
                 if(size_ > other.size()) {
                     return std::weak_ordering::greater;
                 }
@@ -1233,5 +1283,38 @@ namespace data_structures {
                 return std::weak_ordering::equivalent;
             }
         };
+
+        namespace detail {
+            [[noreturn, gnu::cold, gnu::noinline]] inline void throw_array_size_mismatch(unsigned long size, unsigned long expected) {
+                throw std::length_error("Dynamic array of size " + std::to_string(size) + " does not fit an array of size " + std::to_string(expected));
+            }
+        }
+
+        // Copies the values into a std::array of exactly N values. Storage allocated during
+        // constant evaluation has to be freed before it ends, so this is how a table built
+        // with a dynamic_array at compile time is kept: the std::array holds its values inline
+        // and can initialize a constexpr variable.
+        template<std::size_t N, class T, class Allocator, class Instrumentation, class BoundsCheck>
+        constexpr std::array<T, N> to_array(const dynamic_array<T, Allocator, Instrumentation, BoundsCheck>& values) {
+            if(values.size() != N) {
+                detail::throw_array_size_mismatch(values.size(), N);
+            }
+            std::array<T, N> result{};
+            for(std::size_t index = 0; index < N; ++index) {
+                result[index] = values.data()[index];
+            }
+            return result;
+        }
+
+        // Calls Generator, a captureless callable returning a dynamic_array, at compile time
+        // and returns its values in a std::array sized to fit. The generator runs twice, once
+        // to learn the size and once for the values.
+        template<class Generator>
+        consteval auto make_array(Generator) {
+            constexpr std::size_t size = Generator{}().size();
+            return to_array<size>(Generator{}());
+        }
     }
 }
+
+#endif
@@ -0,0 +1,221 @@
+#ifndef DATA_STRUCTURES_LINEAR_DYNAMIC_ARRAY_INSTRUMENTATION_HPP
+#define DATA_STRUCTURES_LINEAR_DYNAMIC_ARRAY_INSTRUMENTATION_HPP
+
+#include <atomic>
+#include <mutex>
+
+namespace data_structures {
+    namespace linear {
+
+        struct dynamic_array_stats {
+            unsigned long allocations = 0;
+            unsigned long bytes_allocated = 0;
+            unsigned long reallocations = 0;
+            unsigned long element_copies = 0;
+            unsigned long element_moves = 0;
+            unsigned long max_capacity = 0;
+
+            dynamic_array_stats& operator+=(const dynamic_array_stats& other) {
+                allocations += other.allocations;
+                bytes_allocated += other.bytes_allocated;
+                reallocations += other.reallocations;
+                element_copies += other.element_copies;
+                element_moves += other.element_moves;
+                max_capacity = max_capacity > other.max_capacity ? max_capacity : other.max_capacity;
+                return *this;
+            }
+
+            bool operator==(const dynamic_array_stats& other) const = default;
+        };
+
+        class instrumentation_site;
+
+        // Process wide list of instrumentation sites. Sites have static storage duration and
+        // are linked in on first use, so the registry never allocates or unregisters.
+        class instrumentation_registry {
+            private:
+                mutable std::mutex mutex_;
+                instrumentation_site* head_ = nullptr;
+
+                instrumentation_registry() = default;
+
+            public:
+                instrumentation_registry(const instrumentation_registry&) = delete;
+                instrumentation_registry& operator=(const instrumentation_registry&) = delete;
+
+                static instrumentation_registry& instance() {
+                    static instrumentation_registry registry;
+                    return registry;
+                }
+
+                void add(instrumentation_site* site);
+
+                template<class Function>
+                void for_each(Function&& function) const;
+
+                dynamic_array_stats total() const;
+
+                void reset();
+        };
+
+        class instrumentation_site {
+            private:
+                const char* name_;
+                instrumentation_site* next_ = nullptr;
+                std::atomic<unsigned long> allocations_{0};
+                std::atomic<unsigned long> bytes_allocated_{0};
+                std::atomic<unsigned long> reallocations_{0};
+                std::atomic<unsigned long> element_copies_{0};
+                std::atomic<unsigned long> element_moves_{0};
+                std::atomic<unsigned long> max_capacity_{0};
+
+                friend class instrumentation_registry;
+
+            public:
+                explicit instrumentation_site(const char* name) : name_(name) {
+                    instrumentation_registry::instance().add(this);
+                }
+
+                instrumentation_site(const instrumentation_site&) = delete;
+                instrumentation_site& operator=(const instrumentation_site&) = delete;
+
+                const char* name() const noexcept {
+                    return name_;
+                }
+
+                void on_allocate(unsigned long capacity, unsigned long bytes) noexcept {
+                    allocations_.fetch_add(1, std::memory_order_relaxed);
+                    bytes_allocated_.fetch_add(bytes, std::memory_order_relaxed);
+                    unsigned long current_max = max_capacity_.load(std::memory_order_relaxed);
+                    while(current_max < capacity &&
+                          !max_capacity_.compare_exchange_weak(current_max, capacity, std::memory_order_relaxed));
+                }
+
+                void on_reallocate() noexcept {
+                    reallocations_.fetch_add(1, std::memory_order_relaxed);
+                }
+
+                void on_copy(unsigned long n) noexcept {
+                    element_copies_.fetch_add(n, std::memory_order_relaxed);
+                }
+
+                void on_move(unsigned long n) noexcept {
+                    element_moves_.fetch_add(n, std::memory_order_relaxed);
+                }
+
+                dynamic_array_stats snapshot() const noexcept {
+                    dynamic_array_stats stats;
+                    stats.allocations = allocations_.load(std::memory_order_relaxed);
+                    stats.bytes_allocated = bytes_allocated_.load(std::memory_order_relaxed);
+                    stats.reallocations = reallocations_.load(std::memory_order_relaxed);
+                    stats.element_copies = element_copies_.load(std::memory_order_relaxed);
+                    stats.element_moves = element_moves_.load(std::memory_order_relaxed);
+                    stats.max_capacity = max_capacity_.load(std::memory_order_relaxed);
+                    return stats;
+                }
+
+                void reset() noexcept {
+                    allocations_.store(0, std::memory_order_relaxed);
+                    bytes_allocated_.store(0, std::memory_order_relaxed);
+                    reallocations_.store(0, std::memory_order_relaxed);
+                    element_copies_.store(0, std::memory_order_relaxed);
+                    element_moves_.store(0, std::memory_order_relaxed);
+                    max_capacity_.store(0, std::memory_order_relaxed);
+                }
+        };
+
+        inline void instrumentation_registry::add(instrumentation_site* site) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            site->next_ = head_;
+            head_ = site;
+        }
+
+        template<class Function>
+        void instrumentation_registry::for_each(Function&& function) const {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for(const instrumentation_site* site = head_; site != nullptr; site = site->next_) {
+                function(site->name(), site->snapshot());
+            }
+        }
+
+        inline dynamic_array_stats instrumentation_registry::total() const {
+            dynamic_array_stats total_stats;
+            for_each([&total_stats](const char*, const dynamic_array_stats& stats) {
+                total_stats += stats;
+            });
+            return total_stats;
+        }
+
+        inline void instrumentation_registry::reset() {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for(instrumentation_site* site = head_; site != nullptr; site = site->next_) {
+                site->reset();
+            }
+        }
+
+        struct no_instrumentation {
+            static constexpr bool enabled = false;
+
+            constexpr void on_allocate(unsigned long, unsigned long) noexcept {}
+            constexpr void on_reallocate() noexcept {}
+            constexpr void on_copy(unsigned long) noexcept {}
+            constexpr void on_move(unsigned long) noexcept {}
+        };
+
+        struct default_instrumentation_site {
+            static constexpr const char* name = "dynamic_array";
+        };
+
+        // Site is any type with a static name; every container instrumented with the same Site
+        // reports into one registry entry, which is how hot call sites are told apart.
+        template<class Site = default_instrumentation_site>
+        class counting_instrumentation {
+            private:
+                dynamic_array_stats stats_;
+
+                static instrumentation_site& site() {
+                    static instrumentation_site shared_site(Site::name);
+                    return shared_site;
+                }
+
+            public:
+                static constexpr bool enabled = true;
+
+                counting_instrumentation() {
+                    site();
+                }
+
+                void on_allocate(unsigned long capacity, unsigned long bytes) noexcept {
+                    ++stats_.allocations;
+                    stats_.bytes_allocated += bytes;
+                    stats_.max_capacity = stats_.max_capacity > capacity ? stats_.max_capacity : capacity;
+                    site().on_allocate(capacity, bytes);
+                }
+
+                void on_reallocate() noexcept {
+                    ++stats_.reallocations;
+                    site().on_reallocate();
+                }
+
+                void on_copy(unsigned long n) noexcept {
+                    stats_.element_copies += n;
+                    site().on_copy(n);
+                }
+
+                void on_move(unsigned long n) noexcept {
+                    stats_.element_moves += n;
+                    site().on_move(n);
+                }
+
+                const dynamic_array_stats& stats() const noexcept {
+                    return stats_;
+                }
+
+                static dynamic_array_stats site_stats() noexcept {
+                    return site().snapshot();
+                }
+        };
+    }
+}
+
+#endif
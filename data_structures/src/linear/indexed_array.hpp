@@ -0,0 +1,508 @@
+#ifndef DATA_STRUCTURES_LINEAR_INDEXED_ARRAY_HPP
+#define DATA_STRUCTURES_LINEAR_INDEXED_ARRAY_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "data_structures/src/linear/dynamic_array.hpp"
+
+namespace data_structures {
+    namespace linear {
+
+        namespace detail {
+            // Blocks reserve their full size up front and dynamic_array rounds capacities up to
+            // a power of four, so the default picks the largest power of four that keeps a block
+            // within about 8KB.
+            template<class T>
+            constexpr unsigned long default_indexed_block_size() {
+                unsigned long target = 8192 / sizeof(T);
+                unsigned long block_size = 16;
+                while(block_size * 4 <= target) {
+                    block_size *= 4;
+                }
+                return block_size;
+            }
+        }
+
+        // A tiered vector: elements live in a sequence of blocks holding at most BlockSize
+        // elements each, and a Fenwick tree over the block sizes maps a position to its block
+        // in O(log(n / BlockSize)). Inserting or erasing in the middle shifts at most one block,
+        // splits a block that is full and merges a block into a neighbour once the two fit in
+        // half a block, so every pair of adjacent blocks stays more than half full. Leading
+        // blocks that are completely full are addressed by division without touching the tree,
+        // which keeps an array filled by push_back at O(1) random access.
+        template<class T, unsigned long BlockSize = detail::default_indexed_block_size<T>(), class Allocator = std::allocator<T>>
+        class indexed_array {
+            static_assert(BlockSize >= 4, "Indexed array blocks must hold at least four elements.");
+
+            public:
+                using value_type = T;
+                using reference = value_type&;
+                using const_reference = const value_type&;
+                using size_type = unsigned long;
+                using allocator_type = Allocator;
+                using block_type = dynamic_array<T, Allocator, no_instrumentation, unchecked>;
+
+                static constexpr size_type block_size = BlockSize;
+
+            private:
+                using block_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<block_type>;
+                using block_array = dynamic_array<block_type, block_allocator, no_instrumentation, unchecked>;
+                using index_array = dynamic_array<size_type, std::allocator<size_type>, no_instrumentation, unchecked>;
+
+                template<bool Const>
+                class basic_iterator {
+                    public:
+                        using iterator_category = std::bidirectional_iterator_tag;
+                        using value_type = T;
+                        using difference_type = std::ptrdiff_t;
+                        using pointer = std::conditional_t<Const, const T*, T*>;
+                        using reference = std::conditional_t<Const, const T&, T&>;
+                        using blocks_pointer = std::conditional_t<Const, const block_array*, block_array*>;
+
+                        basic_iterator() = default;
+
+                        basic_iterator(blocks_pointer blocks, size_type block, size_type offset) : blocks_(blocks), block_(block), offset_(offset) {}
+
+                        template<bool OtherConst> requires (Const && !OtherConst)
+                        basic_iterator(const basic_iterator<OtherConst>& other) : blocks_(other.blocks_), block_(other.block_), offset_(other.offset_) {}
+
+                        reference operator*() const {
+                            return (*blocks_)[block_][offset_];
+                        }
+
+                        pointer operator->() const {
+                            return &(*blocks_)[block_][offset_];
+                        }
+
+                        basic_iterator& operator++() {
+                            if(++offset_ == (*blocks_)[block_].size()) {
+                                ++block_;
+                                offset_ = 0;
+                            }
+                            return *this;
+                        }
+
+                        basic_iterator operator++(int) {
+                            basic_iterator temp = *this;
+                            ++*this;
+                            return temp;
+                        }
+
+                        basic_iterator& operator--() {
+                            if(offset_ == 0) {
+                                --block_;
+                                offset_ = (*blocks_)[block_].size();
+                            }
+                            --offset_;
+                            return *this;
+                        }
+
+                        basic_iterator operator--(int) {
+                            basic_iterator temp = *this;
+                            --*this;
+                            return temp;
+                        }
+
+                        bool operator==(const basic_iterator& other) const {
+                            return block_ == other.block_ && offset_ == other.offset_;
+                        }
+
+                    private:
+                        template<bool>
+                        friend class basic_iterator;
+
+                        blocks_pointer blocks_ = nullptr;
+                        size_type block_ = 0;
+                        size_type offset_ = 0;
+                };
+
+            public:
+                using iterator = basic_iterator<false>;
+                using const_iterator = basic_iterator<true>;
+
+            private:
+                block_array blocks_;
+                index_array tree_;
+                size_type size_ = 0;
+                size_type full_prefix_ = 0;
+                Allocator alloc_;
+
+                static size_type lowest_bit(size_type value) noexcept {
+                    return value & (~value + 1);
+                }
+
+                size_type prefix_size(size_type blocks) const noexcept {
+                    size_type total = 0;
+                    for(; blocks > 0; blocks -= lowest_bit(blocks)) {
+                        total += tree_[blocks];
+                    }
+                    return total;
+                }
+
+                void rebuild_index() {
+                    size_type block_count = blocks_.size();
+                    tree_.clear();
+                    tree_.resize(block_count + 1, 0);
+                    for(size_type node = 1; node <= block_count; ++node) {
+                        tree_[node] += blocks_[node - 1].size();
+                        size_type parent = node + lowest_bit(node);
+                        if(parent <= block_count) {
+                            tree_[parent] += tree_[node];
+                        }
+                    }
+                    full_prefix_ = 0;
+                    advance_full_prefix();
+                }
+
+                void increment_index(size_type block) noexcept {
+                    for(size_type node = block + 1; node < tree_.size(); node += lowest_bit(node)) {
+                        ++tree_[node];
+                    }
+                }
+
+                void decrement_index(size_type block) noexcept {
+                    for(size_type node = block + 1; node < tree_.size(); node += lowest_bit(node)) {
+                        --tree_[node];
+                    }
+                }
+
+                void advance_full_prefix() noexcept {
+                    while(full_prefix_ < blocks_.size() && blocks_[full_prefix_].size() == BlockSize) {
+                        ++full_prefix_;
+                    }
+                }
+
+                block_type make_block() {
+                    block_type block(alloc_);
+                    block.reserve(BlockSize);
+                    return block;
+                }
+
+                // A new last block covers a range of earlier blocks in the tree, which two prefix
+                // sums recover without rebuilding the rest of the index.
+                void append_block() {
+                    blocks_.push_back(make_block());
+                    size_type node = blocks_.size();
+                    if(tree_.size() == 0) {
+                        tree_.push_back(0);
+                    }
+                    tree_.push_back(prefix_size(node - 1) - prefix_size(node - lowest_bit(node)));
+                }
+
+                void insert_block(size_type position, block_type&& block) {
+                    blocks_.push_back(std::move(block));
+                    for(size_type current = blocks_.size() - 1; current > position; --current) {
+                        blocks_[current].swap(blocks_[current - 1]);
+                    }
+                }
+
+                void remove_block(size_type position) {
+                    for(size_type current = position; current + 1 < blocks_.size(); ++current) {
+                        blocks_[current].swap(blocks_[current + 1]);
+                    }
+                    blocks_.pop_back();
+                }
+
+                void split_block(size_type position) {
+                    block_type& source = blocks_[position];
+                    block_type upper = make_block();
+                    for(size_type offset = BlockSize / 2; offset < source.size(); ++offset) {
+                        upper.push_back(std::move(source[offset]));
+                    }
+                    while(source.size() > BlockSize / 2) {
+                        source.pop_back();
+                    }
+                    insert_block(position + 1, std::move(upper));
+                    rebuild_index();
+                }
+
+                // Moves the contents of the block after position onto the end of position.
+                void merge_blocks(size_type position) {
+                    block_type& target = blocks_[position];
+                    block_type& source = blocks_[position + 1];
+                    for(size_type offset = 0; offset < source.size(); ++offset) {
+                        target.push_back(std::move(source[offset]));
+                    }
+                    remove_block(position + 1);
+                    rebuild_index();
+                }
+
+                std::pair<size_type, size_type> locate(size_type index) const noexcept {
+                    if(index < full_prefix_ * BlockSize) {
+                        return {index / BlockSize, index % BlockSize};
+                    }
+                    size_type block_count = blocks_.size();
+                    size_type position = 0;
+                    for(size_type step = std::bit_floor(block_count); step > 0; step >>= 1) {
+                        if(position + step <= block_count && tree_[position + step] <= index) {
+                            position += step;
+                            index -= tree_[position];
+                        }
+                    }
+                    return {position, index};
+                }
+
+                void check_index(size_type index) const {
+                    if(index >= size_) {
+                        throw std::out_of_range("Index " + std::to_string(index) + " is out of range for an indexed array of size " + std::to_string(size_) + ".");
+                    }
+                }
+
+                void append_value(T&& value) {
+                    if(blocks_.size() == 0 || blocks_.back().size() == BlockSize) {
+                        append_block();
+                    }
+                    size_type last = blocks_.size() - 1;
+                    blocks_[last].push_back(std::move(value));
+                    increment_index(last);
+                    ++size_;
+                    if(full_prefix_ == last) {
+                        advance_full_prefix();
+                    }
+                }
+
+                void insert_value(size_type index, T&& value) {
+                    if(index > size_) {
+                        throw std::out_of_range("Insert position " + std::to_string(index) + " is past the end of an indexed array of size " + std::to_string(size_) + ".");
+                    }
+                    if(index == size_) {
+                        append_value(std::move(value));
+                        return;
+                    }
+                    auto [block, offset] = locate(index);
+                    if(offset == 0 && block > 0 && blocks_[block - 1].size() < BlockSize) {
+                        --block;
+                        offset = blocks_[block].size();
+                    }
+                    else if(blocks_[block].size() == BlockSize) {
+                        split_block(block);
+                        if(offset > BlockSize / 2) {
+                            ++block;
+                            offset -= BlockSize / 2;
+                        }
+                    }
+                    block_type& target = blocks_[block];
+                    target.push_back(std::move(value));
+                    T* first = target.data() + offset;
+                    T* last = target.data() + target.size();
+                    std::rotate(first, last - 1, last);
+                    increment_index(block);
+                    ++size_;
+                    full_prefix_ = std::min(full_prefix_, block);
+                }
+
+            public:
+                indexed_array() : indexed_array(Allocator()) {}
+
+                explicit indexed_array(const Allocator& alloc) : alloc_(alloc) {}
+
+                template<class InputIt>
+                indexed_array(InputIt first, InputIt last, const Allocator& alloc = Allocator()) : indexed_array(alloc) {
+                    for(; first != last; ++first) {
+                        push_back(*first);
+                    }
+                }
+
+                indexed_array(std::initializer_list<T> values, const Allocator& alloc = Allocator()) : indexed_array(values.begin(), values.end(), alloc) {}
+
+                indexed_array(const indexed_array& other) : indexed_array(other.begin(), other.end(), other.alloc_) {}
+
+                indexed_array(indexed_array&& other) noexcept : indexed_array(other.alloc_) {
+                    swap(other);
+                }
+
+                indexed_array& operator=(const indexed_array& other) {
+                    if(this != &other) {
+                        indexed_array copy(other);
+                        swap(copy);
+                    }
+                    return *this;
+                }
+
+                indexed_array& operator=(indexed_array&& other) noexcept {
+                    if(this != &other) {
+                        clear();
+                        swap(other);
+                    }
+                    return *this;
+                }
+
+                void swap(indexed_array& other) noexcept {
+                    blocks_.swap(other.blocks_);
+                    tree_.swap(other.tree_);
+                    std::swap(size_, other.size_);
+                    std::swap(full_prefix_, other.full_prefix_);
+                    std::swap(alloc_, other.alloc_);
+                }
+
+                [[nodiscard]] size_type size() const noexcept {
+                    return size_;
+                }
+
+                [[nodiscard]] bool empty() const noexcept {
+                    return size_ == 0;
+                }
+
+                [[nodiscard]] size_type block_count() const noexcept {
+                    return blocks_.size();
+                }
+
+                allocator_type get_allocator() const noexcept {
+                    return alloc_;
+                }
+
+                reference operator[](size_type index) {
+                    auto [block, offset] = locate(index);
+                    return blocks_[block][offset];
+                }
+
+                const_reference operator[](size_type index) const {
+                    auto [block, offset] = locate(index);
+                    return blocks_[block][offset];
+                }
+
+                reference at(size_type index) {
+                    check_index(index);
+                    return (*this)[index];
+                }
+
+                const_reference at(size_type index) const {
+                    check_index(index);
+                    return (*this)[index];
+                }
+
+                reference front() {
+                    return blocks_[0][0];
+                }
+
+                const_reference front() const {
+                    return blocks_[0][0];
+                }
+
+                reference back() {
+                    return blocks_.back().back();
+                }
+
+                const_reference back() const {
+                    return blocks_.back().back();
+                }
+
+                void push_back(const T& value) {
+                    append_value(T(value));
+                }
+
+                void push_back(T&& value) {
+                    append_value(std::move(value));
+                }
+
+                template<class... Args>
+                reference emplace_back(Args&&... args) {
+                    append_value(T(std::forward<Args>(args)...));
+                    return back();
+                }
+
+                void insert(size_type index, const T& value) {
+                    insert_value(index, T(value));
+                }
+
+                void insert(size_type index, T&& value) {
+                    insert_value(index, std::move(value));
+                }
+
+                template<class... Args>
+                void emplace(size_type index, Args&&... args) {
+                    insert_value(index, T(std::forward<Args>(args)...));
+                }
+
+                void erase(size_type index) {
+                    check_index(index);
+                    auto [block, offset] = locate(index);
+                    block_type& source = blocks_[block];
+                    T* first = source.data() + offset;
+                    std::move(first + 1, source.data() + source.size(), first);
+                    source.pop_back();
+                    decrement_index(block);
+                    --size_;
+                    full_prefix_ = std::min(full_prefix_, block);
+
+                    if(source.size() == 0) {
+                        remove_block(block);
+                        rebuild_index();
+                    }
+                    else if(block > 0 && blocks_[block - 1].size() + source.size() <= BlockSize / 2) {
+                        merge_blocks(block - 1);
+                    }
+                    else if(block + 1 < blocks_.size() && source.size() + blocks_[block + 1].size() <= BlockSize / 2) {
+                        merge_blocks(block);
+                    }
+                }
+
+                void pop_back() {
+                    erase(size_ - 1);
+                }
+
+                void clear() {
+                    blocks_.clear();
+                    tree_.clear();
+                    size_ = 0;
+                    full_prefix_ = 0;
+                }
+
+                // Visits every element in order one block at a time, which avoids the per element
+                // block checks of the iterators.
+                template<class Function>
+                void for_each(Function function) {
+                    for(size_type block = 0; block < blocks_.size(); ++block) {
+                        for(T& value : std::span<T>(blocks_[block].data(), blocks_[block].size())) {
+                            function(value);
+                        }
+                    }
+                }
+
+                template<class Function>
+                void for_each(Function function) const {
+                    for(size_type block = 0; block < blocks_.size(); ++block) {
+                        for(const T& value : std::span<const T>(blocks_[block].data(), blocks_[block].size())) {
+                            function(value);
+                        }
+                    }
+                }
+
+                [[nodiscard]] iterator begin() noexcept {
+                    return iterator(&blocks_, 0, 0);
+                }
+
+                [[nodiscard]] iterator end() noexcept {
+                    return iterator(&blocks_, blocks_.size(), 0);
+                }
+
+                [[nodiscard]] const_iterator begin() const noexcept {
+                    return const_iterator(&blocks_, 0, 0);
+                }
+
+                [[nodiscard]] const_iterator end() const noexcept {
+                    return const_iterator(&blocks_, blocks_.size(), 0);
+                }
+
+                [[nodiscard]] const_iterator cbegin() const noexcept {
+                    return begin();
+                }
+
+                [[nodiscard]] const_iterator cend() const noexcept {
+                    return end();
+                }
+        };
+    }
+}
+
+#endif
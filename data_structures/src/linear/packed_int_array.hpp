@@ -0,0 +1,396 @@
+#ifndef DATA_STRUCTURES_LINEAR_PACKED_INT_ARRAY_HPP
+#define DATA_STRUCTURES_LINEAR_PACKED_INT_ARRAY_HPP
+
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "data_structures/src/linear/dynamic_array.hpp"
+
+namespace data_structures {
+    namespace linear {
+
+        enum class packing_mode {
+            DIRECT,
+            FRAME_OF_REFERENCE,
+            DELTA
+        };
+
+        // Unsigned integers stored back to back with a fixed bit width, chosen from the largest
+        // code. FRAME_OF_REFERENCE stores value - min; DELTA stores the gap to the previous
+        // value for non-decreasing input, restarting from an absolute anchor every chunk_size
+        // values so random access and chunk decode never walk more than one chunk.
+        class packed_int_array {
+            public:
+                using value_type = std::uint64_t;
+                using size_type = unsigned long;
+                using word_type = std::uint64_t;
+
+                static constexpr size_type chunk_size = 128;
+
+            private:
+                static constexpr unsigned int word_bits = std::numeric_limits<word_type>::digits;
+                static constexpr size_type group_size = 64;
+
+                using word_array = dynamic_array<word_type, std::allocator<word_type>, no_instrumentation, unchecked>;
+
+                // Codes are written with one spare word after the last one in use, so extract
+                // can always read two words without a bounds branch.
+                word_array words_;
+                word_array anchors_;
+                size_type size_ = 0;
+                unsigned int width_ = 0;
+                packing_mode mode_ = packing_mode::DIRECT;
+                value_type reference_ = 0;
+                value_type max_value_ = 0;
+                value_type last_value_ = 0;
+
+                static constexpr word_type width_mask(unsigned int width) {
+                    return width == word_bits ? ~word_type(0) : (word_type(1) << width) - 1;
+                }
+
+                static size_type words_for(size_type count, unsigned int width) {
+                    return (count * width + word_bits - 1) / word_bits + 1;
+                }
+
+                template<unsigned int Width, size_type Index>
+                static word_type extract_fixed(const word_type* words) {
+                    if constexpr(Width == 0) {
+                        return 0;
+                    }
+                    else {
+                        constexpr size_type bit = Index * Width;
+                        constexpr size_type word = bit / word_bits;
+                        constexpr unsigned int shift = bit % word_bits;
+                        if constexpr(shift + Width <= word_bits) {
+                            return (words[word] >> shift) & width_mask(Width);
+                        }
+                        else {
+                            return ((words[word] >> shift) | (words[word + 1] << (word_bits - shift))) & width_mask(Width);
+                        }
+                    }
+                }
+
+                template<unsigned int Width, class U, size_type... Index>
+                static void unpack_group_fixed(const word_type* words, U* out, std::index_sequence<Index...>) {
+                    ((out[Index] = static_cast<U>(extract_fixed<Width, Index>(words))), ...);
+                }
+
+                // A group of 64 codes always starts on a word boundary, so each width gets a
+                // fully unrolled kernel with constant shifts and masks that the compiler can
+                // turn into vector shuffles.
+                template<unsigned int Width, class U>
+                static void unpack_group(const word_type* words, U* out) {
+                    unpack_group_fixed<Width, U>(words, out, std::make_index_sequence<group_size>());
+                }
+
+                template<class U, unsigned int... Width>
+                static constexpr auto make_unpack_table(std::integer_sequence<unsigned int, Width...>) {
+                    return std::array<void (*)(const word_type*, U*), sizeof...(Width)>{&unpack_group<Width, U>...};
+                }
+
+                template<class U>
+                static constexpr auto unpack_table = make_unpack_table<U>(std::make_integer_sequence<unsigned int, word_bits + 1>());
+
+                word_type extract(size_type index) const {
+                    if(width_ == 0) {
+                        return 0;
+                    }
+                    size_type bit = index * width_;
+                    size_type word = bit / word_bits;
+                    unsigned int shift = bit % word_bits;
+                    word_type high = (words_[word + 1] << 1) << (word_bits - 1 - shift);
+                    return ((words_[word] >> shift) | high) & width_mask(width_);
+                }
+
+                void store(size_type index, word_type code) {
+                    if(width_ == 0) {
+                        return;
+                    }
+                    size_type bit = index * width_;
+                    size_type word = bit / word_bits;
+                    unsigned int shift = bit % word_bits;
+                    words_[word] |= code << shift;
+                    if(shift + width_ > word_bits) {
+                        words_[word + 1] |= code >> (word_bits - shift);
+                    }
+                }
+
+                word_type code_for(size_type index, value_type value) const {
+                    switch(mode_) {
+                        case packing_mode::FRAME_OF_REFERENCE:
+                            return value - reference_;
+                        case packing_mode::DELTA:
+                            return index % chunk_size == 0 ? 0 : value - last_value_;
+                        default:
+                            return value;
+                    }
+                }
+
+                void check_index(size_type index) const {
+                    if(index >= size_) {
+                        throw std::out_of_range("Index " + std::to_string(index) + " is out of range for size " + std::to_string(size_));
+                    }
+                }
+
+                // In FRAME_OF_REFERENCE mode a value below the reference moves the reference down
+                // by as much again as the span above it, so a descending stream repacks only when
+                // its span doubles rather than on every append. The reference never moves up on a
+                // repack, which keeps slack from an earlier one.
+                void repack_with(value_type value) {
+                    word_array values;
+                    values.resize_uninitialized(size_ + 1);
+                    decode(0, std::span<value_type>(values.data(), size_));
+                    values[size_] = value;
+                    value_type reference_limit = std::numeric_limits<value_type>::max();
+                    if(mode_ == packing_mode::FRAME_OF_REFERENCE && size_ > 0) {
+                        reference_limit = reference_;
+                        if(value < reference_) {
+                            value_type slack = max_value_ - value;
+                            reference_limit = value > slack ? value - slack : 0;
+                        }
+                    }
+                    encode(std::span<const value_type>(values.data(), values.size()), mode_, reference_limit);
+                }
+
+                // Packs values with the given mode; FRAME_OF_REFERENCE uses the smaller of the
+                // minimum value and reference_limit as its reference.
+                void encode(std::span<const value_type> values, packing_mode mode, value_type reference_limit) {
+                    size_type count = values.size();
+                    value_type min_value = count > 0 ? values[0] : 0;
+                    value_type max_value = min_value;
+                    value_type max_code = 0;
+                    for(size_type index = 0; index < count; ++index) {
+                        min_value = values[index] < min_value ? values[index] : min_value;
+                        max_value = values[index] > max_value ? values[index] : max_value;
+                        if(mode == packing_mode::DELTA && index > 0) {
+                            if(values[index] < values[index - 1]) {
+                                throw std::invalid_argument("Delta packing needs non-decreasing values; index " + std::to_string(index) + " decreases.");
+                            }
+                            value_type delta = values[index] - values[index - 1];
+                            max_code = index % chunk_size != 0 && delta > max_code ? delta : max_code;
+                        }
+                    }
+                    if(mode == packing_mode::FRAME_OF_REFERENCE) {
+                        min_value = reference_limit < min_value ? reference_limit : min_value;
+                        max_code = max_value - min_value;
+                    }
+                    else if(mode == packing_mode::DIRECT) {
+                        max_code = max_value;
+                    }
+
+                    mode_ = mode;
+                    size_ = 0;
+                    width_ = static_cast<unsigned int>(std::bit_width(max_code));
+                    reference_ = mode == packing_mode::FRAME_OF_REFERENCE ? min_value : 0;
+                    max_value_ = max_value;
+                    last_value_ = 0;
+                    words_.clear();
+                    words_.resize(words_for(count, width_), 0);
+                    anchors_.clear();
+                    for(size_type index = 0; index < count; ++index) {
+                        if(mode_ == packing_mode::DELTA && index % chunk_size == 0) {
+                            anchors_.push_back(values[index]);
+                        }
+                        store(index, code_for(index, values[index]));
+                        last_value_ = values[index];
+                    }
+                    size_ = count;
+                }
+
+            public:
+                packed_int_array() = default;
+
+                explicit packed_int_array(packing_mode mode) : mode_(mode) {}
+
+                packed_int_array(std::span<const value_type> values, packing_mode mode = packing_mode::DIRECT) {
+                    assign(values, mode);
+                }
+
+                packed_int_array(std::initializer_list<value_type> values, packing_mode mode = packing_mode::DIRECT) {
+                    assign(std::span<const value_type>(values.begin(), values.size()), mode);
+                }
+
+                template<class InputIt>
+                packed_int_array(InputIt first, InputIt last, packing_mode mode = packing_mode::DIRECT) {
+                    word_array values;
+                    for(; first != last; ++first) {
+                        values.push_back(static_cast<value_type>(*first));
+                    }
+                    assign(std::span<const value_type>(values.data(), values.size()), mode);
+                }
+
+                void assign(std::span<const value_type> values, packing_mode mode) {
+                    encode(values, mode, std::numeric_limits<value_type>::max());
+                }
+
+                // Appends that need a wider code, or a smaller reference in FRAME_OF_REFERENCE
+                // mode, re-encode the whole array. The width can only grow 64 times, and
+                // repack_with leaves room below a lowered reference, so repacks stay amortized
+                // O(1) per append for ascending and descending streams alike.
+                void push_back(value_type value) {
+                    if(mode_ == packing_mode::DELTA && size_ > 0 && value < last_value_) {
+                        throw std::invalid_argument("Delta packing needs non-decreasing values.");
+                    }
+                    if(mode_ == packing_mode::FRAME_OF_REFERENCE && (size_ == 0 || value < reference_)) {
+                        repack_with(value);
+                        return;
+                    }
+                    word_type code = code_for(size_, value);
+                    if(std::bit_width(code) > width_) {
+                        repack_with(value);
+                        return;
+                    }
+                    while(words_.size() < words_for(size_ + 1, width_)) {
+                        words_.push_back(0);
+                    }
+                    if(mode_ == packing_mode::DELTA && size_ % chunk_size == 0) {
+                        anchors_.push_back(value);
+                    }
+                    store(size_, code);
+                    max_value_ = value > max_value_ ? value : max_value_;
+                    last_value_ = value;
+                    ++size_;
+                }
+
+                value_type operator[](size_type index) const {
+                    switch(mode_) {
+                        case packing_mode::FRAME_OF_REFERENCE:
+                            return reference_ + extract(index);
+                        case packing_mode::DELTA: {
+                            size_type chunk = index / chunk_size;
+                            value_type value = anchors_[chunk];
+                            for(size_type position = chunk * chunk_size + 1; position <= index; ++position) {
+                                value += extract(position);
+                            }
+                            return value;
+                        }
+                        default:
+                            return extract(index);
+                    }
+                }
+
+                value_type at(size_type index) const {
+                    check_index(index);
+                    return (*this)[index];
+                }
+
+                value_type back() const {
+                    if(size_ == 0) {
+                        throw std::out_of_range("Array is empty.");
+                    }
+                    return last_value_;
+                }
+
+                template<std::unsigned_integral U>
+                void decode(size_type first, std::span<U> out) const {
+                    if(first > size_ || out.size() > size_ - first) {
+                        throw std::out_of_range("Decode range is out of range for size " + std::to_string(size_));
+                    }
+                    if(out.size() == 0) {
+                        return;
+                    }
+                    if(max_value_ > std::numeric_limits<U>::max()) {
+                        throw std::overflow_error("Stored values do not fit in the output type.");
+                    }
+                    value_type value = (*this)[first];
+                    out[0] = static_cast<U>(value);
+                    for(size_type offset = 1; offset < out.size(); ++offset) {
+                        size_type index = first + offset;
+                        if(mode_ == packing_mode::DELTA) {
+                            value = index % chunk_size == 0 ? anchors_[index / chunk_size] : value + extract(index);
+                        }
+                        else {
+                            value = reference_ + extract(index);
+                        }
+                        out[offset] = static_cast<U>(value);
+                    }
+                }
+
+                size_type chunk_count() const noexcept {
+                    return (size_ + chunk_size - 1) / chunk_size;
+                }
+
+                template<std::unsigned_integral U, class Allocator, class Instrumentation, class BoundsCheck>
+                void decode_chunk(size_type chunk, dynamic_array<U, Allocator, Instrumentation, BoundsCheck>& out) const {
+                    if(chunk >= chunk_count()) {
+                        throw std::out_of_range("Chunk " + std::to_string(chunk) + " is out of range for " + std::to_string(chunk_count()) + " chunks.");
+                    }
+                    if(max_value_ > std::numeric_limits<U>::max()) {
+                        throw std::overflow_error("Stored values do not fit in the output type.");
+                    }
+                    size_type first = chunk * chunk_size;
+                    size_type count = size_ - first < chunk_size ? size_ - first : chunk_size;
+                    out.resize_uninitialized(count);
+                    U* output = out.data();
+
+                    size_type unpacked = 0;
+                    for(; unpacked + group_size <= count; unpacked += group_size) {
+                        size_type word = (first + unpacked) / group_size * width_;
+                        unpack_table<U>[width_](words_.data() + word, output + unpacked);
+                    }
+                    for(; unpacked < count; ++unpacked) {
+                        output[unpacked] = static_cast<U>(extract(first + unpacked));
+                    }
+
+                    if(mode_ == packing_mode::DELTA) {
+                        U running = static_cast<U>(anchors_[chunk]);
+                        for(size_type index = 0; index < count; ++index) {
+                            running += output[index];
+                            output[index] = running;
+                        }
+                    }
+                    else if(reference_ != 0) {
+                        U reference = static_cast<U>(reference_);
+                        for(size_type index = 0; index < count; ++index) {
+                            output[index] += reference;
+                        }
+                    }
+                }
+
+                size_type size() const noexcept {
+                    return size_;
+                }
+
+                [[nodiscard]] bool empty() const noexcept {
+                    return size_ == 0;
+                }
+
+                unsigned int bit_width() const noexcept {
+                    return width_;
+                }
+
+                packing_mode mode() const noexcept {
+                    return mode_;
+                }
+
+                value_type reference() const noexcept {
+                    return reference_;
+                }
+
+                size_type memory_usage() const noexcept {
+                    return (words_.size() + anchors_.size()) * sizeof(word_type);
+                }
+
+                void clear() {
+                    words_.clear();
+                    anchors_.clear();
+                    size_ = 0;
+                    width_ = 0;
+                    reference_ = 0;
+                    max_value_ = 0;
+                    last_value_ = 0;
+                }
+        };
+    }
+}
+
+#endif
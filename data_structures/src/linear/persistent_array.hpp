@@ -0,0 +1,947 @@
+#ifndef DATA_STRUCTURES_LINEAR_PERSISTENT_ARRAY_HPP
+#define DATA_STRUCTURES_LINEAR_PERSISTENT_ARRAY_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace data_structures {
+    namespace linear {
+
+        template<class T>
+        class persistent_array;
+
+        template<class T>
+        class transient_array;
+
+        namespace detail {
+            inline constexpr unsigned int rrb_bits = 5;
+            inline constexpr unsigned int rrb_branching = 1u << rrb_bits;
+
+            // Relaxed radix balanced tree with a separate tail leaf. Leaves and inner nodes hold
+            // up to 32 entries. An inner node whose children are all full except the last one
+            // is strict and is indexed by shifting; any other inner node carries a table of
+            // cumulative child sizes, which concatenation and slicing produce. Nodes are shared
+            // between versions through atomic reference counts, and every mutation first makes
+            // the nodes on its path unique, cloning the ones another version still references.
+            // A copied tree therefore shares everything until it is written, and repeated
+            // writes to an unshared tree happen in place.
+            template<class T>
+            class rrb_tree {
+                public:
+                    using size_type = unsigned long;
+
+                private:
+                    struct node {
+                        std::atomic<std::uint32_t> references{1};
+                        std::uint32_t count = 0;
+                        size_type size = 0;
+                        bool leaf;
+
+                        explicit node(bool is_leaf) : leaf(is_leaf) {}
+                    };
+
+                    struct leaf_node : node {
+                        alignas(T) unsigned char storage[rrb_branching * sizeof(T)];
+
+                        leaf_node() : node(true) {}
+
+                        T* values() noexcept {
+                            return std::launder(reinterpret_cast<T*>(storage));
+                        }
+
+                        const T* values() const noexcept {
+                            return std::launder(reinterpret_cast<const T*>(storage));
+                        }
+                    };
+
+                    struct internal_node : node {
+                        node* children[rrb_branching] = {};
+                        size_type* sizes = nullptr;
+
+                        internal_node() : node(false) {}
+
+                        ~internal_node() {
+                            delete[] sizes;
+                        }
+                    };
+
+                    node* root_ = nullptr;
+                    node* tail_ = nullptr;
+                    unsigned int shift_ = 0;
+                    size_type size_ = 0;
+
+                    static leaf_node* as_leaf(node* value) noexcept {
+                        return static_cast<leaf_node*>(value);
+                    }
+
+                    static const leaf_node* as_leaf(const node* value) noexcept {
+                        return static_cast<const leaf_node*>(value);
+                    }
+
+                    static internal_node* as_internal(node* value) noexcept {
+                        return static_cast<internal_node*>(value);
+                    }
+
+                    static const internal_node* as_internal(const node* value) noexcept {
+                        return static_cast<const internal_node*>(value);
+                    }
+
+                    static void retain(node* value) noexcept {
+                        value->references.fetch_add(1, std::memory_order_relaxed);
+                    }
+
+                    static void release(node* value) noexcept {
+                        if(value == nullptr || value->references.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+                            return;
+                        }
+                        if(value->leaf) {
+                            leaf_node* leaf = as_leaf(value);
+                            std::destroy_n(leaf->values(), leaf->count);
+                            delete leaf;
+                        }
+                        else {
+                            internal_node* internal = as_internal(value);
+                            for(std::uint32_t index = 0; index < internal->count; ++index) {
+                                release(internal->children[index]);
+                            }
+                            delete internal;
+                        }
+                    }
+
+                    // Copies values [first, last) of a leaf into a new leaf.
+                    static leaf_node* copy_leaf(const leaf_node* source, size_type first, size_type last) {
+                        leaf_node* copy = new leaf_node();
+                        try {
+                            std::uninitialized_copy(source->values() + first, source->values() + last, copy->values());
+                        }
+                        catch(...) {
+                            delete copy;
+                            throw;
+                        }
+                        copy->count = static_cast<std::uint32_t>(last - first);
+                        copy->size = last - first;
+                        return copy;
+                    }
+
+                    static node* clone(const node* source) {
+                        if(source->leaf) {
+                            return copy_leaf(as_leaf(source), 0, source->count);
+                        }
+                        const internal_node* internal = as_internal(source);
+                        internal_node* copy = new internal_node();
+                        if(internal->sizes != nullptr) {
+                            copy->sizes = new size_type[rrb_branching];
+                            std::copy_n(internal->sizes, internal->count, copy->sizes);
+                        }
+                        for(std::uint32_t index = 0; index < internal->count; ++index) {
+                            retain(internal->children[index]);
+                            copy->children[index] = internal->children[index];
+                        }
+                        copy->count = internal->count;
+                        copy->size = internal->size;
+                        return copy;
+                    }
+
+                    static void make_unique(node*& slot) {
+                        if(slot->references.load(std::memory_order_acquire) != 1) {
+                            node* copy = clone(slot);
+                            release(slot);
+                            slot = copy;
+                        }
+                    }
+
+                    // Takes ownership of child. A strict node turns relaxed when the child it
+                    // appends after is not full.
+                    static void append_child(internal_node* parent, unsigned int shift, node* child) {
+                        if(parent->sizes == nullptr && parent->count > 0 && parent->children[parent->count - 1]->size != (size_type(1) << shift)) {
+                            parent->sizes = new size_type[rrb_branching];
+                            size_type running = 0;
+                            for(std::uint32_t index = 0; index < parent->count; ++index) {
+                                running += parent->children[index]->size;
+                                parent->sizes[index] = running;
+                            }
+                        }
+                        if(parent->sizes != nullptr) {
+                            parent->sizes[parent->count] = (parent->count > 0 ? parent->sizes[parent->count - 1] : 0) + child->size;
+                        }
+                        parent->children[parent->count++] = child;
+                        parent->size += child->size;
+                    }
+
+                    static internal_node* build_internal(node* const* children, std::uint32_t count, unsigned int shift) {
+                        internal_node* built = new internal_node();
+                        for(std::uint32_t index = 0; index < count; ++index) {
+                            append_child(built, shift, children[index]);
+                        }
+                        return built;
+                    }
+
+                    // Finds the child holding index and makes index relative to it. The shifted
+                    // index never overshoots because no subtree holds more than 32^height values.
+                    static std::uint32_t child_slot(const internal_node* parent, unsigned int shift, size_type& index) noexcept {
+                        std::uint32_t slot = static_cast<std::uint32_t>(index >> shift);
+                        if(parent->sizes == nullptr) {
+                            index -= size_type(slot) << shift;
+                            return slot;
+                        }
+                        while(parent->sizes[slot] <= index) {
+                            ++slot;
+                        }
+                        if(slot > 0) {
+                            index -= parent->sizes[slot - 1];
+                        }
+                        return slot;
+                    }
+
+                    static bool has_room(const node* subtree, unsigned int shift) noexcept {
+                        const internal_node* internal = as_internal(subtree);
+                        return internal->count < rrb_branching || (shift > rrb_bits && has_room(internal->children[internal->count - 1], shift - rrb_bits));
+                    }
+
+                    static node* new_path(unsigned int shift, node* leaf) {
+                        if(shift == 0) {
+                            return leaf;
+                        }
+                        internal_node* parent = new internal_node();
+                        append_child(parent, shift, new_path(shift - rrb_bits, leaf));
+                        return parent;
+                    }
+
+                    static bool push_leaf(internal_node* parent, unsigned int shift, node* leaf) {
+                        if(shift > rrb_bits) {
+                            node*& last = parent->children[parent->count - 1];
+                            if(has_room(last, shift - rrb_bits)) {
+                                make_unique(last);
+                                push_leaf(as_internal(last), shift - rrb_bits, leaf);
+                                if(parent->sizes != nullptr) {
+                                    parent->sizes[parent->count - 1] += leaf->size;
+                                }
+                                parent->size += leaf->size;
+                                return true;
+                            }
+                        }
+                        if(parent->count == rrb_branching) {
+                            return false;
+                        }
+                        append_child(parent, shift, new_path(shift - rrb_bits, leaf));
+                        return true;
+                    }
+
+                    void push_leaf_into_tree(node* leaf) {
+                        if(root_ == nullptr) {
+                            root_ = leaf;
+                            shift_ = 0;
+                            return;
+                        }
+                        if(shift_ > 0) {
+                            make_unique(root_);
+                            if(push_leaf(as_internal(root_), shift_, leaf)) {
+                                return;
+                            }
+                        }
+                        internal_node* top = new internal_node();
+                        append_child(top, shift_ + rrb_bits, root_);
+                        append_child(top, shift_ + rrb_bits, new_path(shift_, leaf));
+                        root_ = top;
+                        shift_ += rrb_bits;
+                    }
+
+                    static node* detach_rightmost(node*& slot, unsigned int shift) {
+                        make_unique(slot);
+                        internal_node* parent = as_internal(slot);
+                        std::uint32_t last = parent->count - 1;
+                        node* leaf;
+                        if(shift == rrb_bits) {
+                            leaf = parent->children[last];
+                            --parent->count;
+                        }
+                        else {
+                            leaf = detach_rightmost(parent->children[last], shift - rrb_bits);
+                            if(parent->children[last] == nullptr) {
+                                --parent->count;
+                            }
+                            else if(parent->sizes != nullptr) {
+                                parent->sizes[last] -= leaf->size;
+                            }
+                        }
+                        parent->size -= leaf->size;
+                        if(parent->count == 0) {
+                            release(slot);
+                            slot = nullptr;
+                        }
+                        return leaf;
+                    }
+
+                    void collapse_root() noexcept {
+                        if(root_ == nullptr) {
+                            shift_ = 0;
+                            return;
+                        }
+                        while(shift_ > 0 && as_internal(root_)->count == 1) {
+                            node* child = as_internal(root_)->children[0];
+                            retain(child);
+                            release(root_);
+                            root_ = child;
+                            shift_ -= rrb_bits;
+                        }
+                    }
+
+                    // The first keep values of a subtree, where keep falls on a leaf boundary.
+                    static node* cut_right(node* subtree, unsigned int shift, size_type keep) {
+                        if(keep == subtree->size) {
+                            retain(subtree);
+                            return subtree;
+                        }
+                        internal_node* parent = as_internal(subtree);
+                        size_type index = keep;
+                        std::uint32_t slot = child_slot(parent, shift, index);
+                        internal_node* kept = new internal_node();
+                        for(std::uint32_t child = 0; child < slot; ++child) {
+                            retain(parent->children[child]);
+                            append_child(kept, shift, parent->children[child]);
+                        }
+                        if(index > 0) {
+                            append_child(kept, shift, cut_right(parent->children[slot], shift - rrb_bits, index));
+                        }
+                        return kept;
+                    }
+
+                    // The values of a subtree from position drop onwards.
+                    static node* cut_left(node* subtree, unsigned int shift, size_type drop) {
+                        if(drop == 0) {
+                            retain(subtree);
+                            return subtree;
+                        }
+                        if(shift == 0) {
+                            return copy_leaf(as_leaf(subtree), drop, subtree->count);
+                        }
+                        internal_node* parent = as_internal(subtree);
+                        size_type index = drop;
+                        std::uint32_t slot = child_slot(parent, shift, index);
+                        internal_node* kept = new internal_node();
+                        append_child(kept, shift, cut_left(parent->children[slot], shift - rrb_bits, index));
+                        for(std::uint32_t child = slot + 1; child < parent->count; ++child) {
+                            retain(parent->children[child]);
+                            append_child(kept, shift, parent->children[child]);
+                        }
+                        return kept;
+                    }
+
+                    // Joins two subtrees of equal height along their seam into one or two nodes of
+                    // that height. The children next to the seam are joined first, and the two
+                    // seam leaves are merged when they fit in one.
+                    static std::uint32_t merge_level(node* left, node* right, unsigned int shift, node** merged) {
+                        if(shift == 0) {
+                            const leaf_node* first = as_leaf(left);
+                            const leaf_node* second = as_leaf(right);
+                            if(first->count + second->count > rrb_branching) {
+                                retain(left);
+                                retain(right);
+                                merged[0] = left;
+                                merged[1] = right;
+                                return 2;
+                            }
+                            leaf_node* joined = copy_leaf(first, 0, first->count);
+                            try {
+                                std::uninitialized_copy_n(second->values(), second->count, joined->values() + joined->count);
+                            }
+                            catch(...) {
+                                release(joined);
+                                throw;
+                            }
+                            joined->count += second->count;
+                            joined->size = joined->count;
+                            merged[0] = joined;
+                            return 1;
+                        }
+                        internal_node* first = as_internal(left);
+                        internal_node* second = as_internal(right);
+                        node* middle[2];
+                        std::uint32_t middle_count = merge_level(first->children[first->count - 1], second->children[0], shift - rrb_bits, middle);
+                        node* children[2 * rrb_branching];
+                        std::uint32_t total = 0;
+                        for(std::uint32_t index = 0; index + 1 < first->count; ++index) {
+                            retain(first->children[index]);
+                            children[total++] = first->children[index];
+                        }
+                        for(std::uint32_t index = 0; index < middle_count; ++index) {
+                            children[total++] = middle[index];
+                        }
+                        for(std::uint32_t index = 1; index < second->count; ++index) {
+                            retain(second->children[index]);
+                            children[total++] = second->children[index];
+                        }
+                        if(total <= rrb_branching) {
+                            merged[0] = build_internal(children, total, shift);
+                            return 1;
+                        }
+                        merged[0] = build_internal(children, rrb_branching, shift);
+                        merged[1] = build_internal(children + rrb_branching, total - rrb_branching, shift);
+                        return 2;
+                    }
+
+                    static node* raise(node* subtree, unsigned int shift, unsigned int target_shift) {
+                        for(; shift < target_shift; shift += rrb_bits) {
+                            internal_node* parent = new internal_node();
+                            append_child(parent, shift + rrb_bits, subtree);
+                            subtree = parent;
+                        }
+                        return subtree;
+                    }
+
+                    std::pair<const leaf_node*, size_type> locate(size_type index) const noexcept {
+                        size_type tail_start = tail_offset();
+                        if(index >= tail_start) {
+                            return {as_leaf(tail_), index - tail_start};
+                        }
+                        const node* current = root_;
+                        for(unsigned int shift = shift_; shift > 0; shift -= rrb_bits) {
+                            const internal_node* parent = as_internal(current);
+                            current = parent->children[child_slot(parent, shift, index)];
+                        }
+                        return {as_leaf(current), index};
+                    }
+
+                    template<class Function>
+                    static void visit_leaves(const node* subtree, Function& function) {
+                        if(subtree->leaf) {
+                            const leaf_node* leaf = as_leaf(subtree);
+                            for(std::uint32_t index = 0; index < leaf->count; ++index) {
+                                function(leaf->values()[index]);
+                            }
+                            return;
+                        }
+                        const internal_node* internal = as_internal(subtree);
+                        for(std::uint32_t index = 0; index < internal->count; ++index) {
+                            visit_leaves(internal->children[index], function);
+                        }
+                    }
+
+                public:
+                    rrb_tree() = default;
+
+                    rrb_tree(const rrb_tree& other) noexcept : root_(other.root_), tail_(other.tail_), shift_(other.shift_), size_(other.size_) {
+                        if(root_ != nullptr) {
+                            retain(root_);
+                        }
+                        if(tail_ != nullptr) {
+                            retain(tail_);
+                        }
+                    }
+
+                    rrb_tree(rrb_tree&& other) noexcept : root_(other.root_), tail_(other.tail_), shift_(other.shift_), size_(other.size_) {
+                        other.root_ = other.tail_ = nullptr;
+                        other.shift_ = 0;
+                        other.size_ = 0;
+                    }
+
+                    rrb_tree& operator=(rrb_tree other) noexcept {
+                        swap(other);
+                        return *this;
+                    }
+
+                    ~rrb_tree() {
+                        release(root_);
+                        release(tail_);
+                    }
+
+                    void swap(rrb_tree& other) noexcept {
+                        std::swap(root_, other.root_);
+                        std::swap(tail_, other.tail_);
+                        std::swap(shift_, other.shift_);
+                        std::swap(size_, other.size_);
+                    }
+
+                    size_type size() const noexcept {
+                        return size_;
+                    }
+
+                    size_type tail_offset() const noexcept {
+                        return size_ - (tail_ != nullptr ? tail_->count : 0);
+                    }
+
+                    unsigned int height() const noexcept {
+                        return root_ == nullptr ? 0 : shift_ / rrb_bits + 1;
+                    }
+
+                    struct leaf_view {
+                        const T* values;
+                        size_type first;
+                        size_type count;
+                    };
+
+                    // The leaf holding index, as its values, the index of its first value and its size.
+                    leaf_view leaf_for(size_type index) const noexcept {
+                        auto [leaf, offset] = locate(index);
+                        return {leaf->values(), index - offset, leaf->count};
+                    }
+
+                    const T& get(size_type index) const noexcept {
+                        auto [leaf, offset] = locate(index);
+                        return leaf->values()[offset];
+                    }
+
+                    void set(size_type index, T value) {
+                        size_type tail_start = tail_offset();
+                        if(index >= tail_start) {
+                            make_unique(tail_);
+                            as_leaf(tail_)->values()[index - tail_start] = std::move(value);
+                            return;
+                        }
+                        node** slot = &root_;
+                        for(unsigned int shift = shift_; shift > 0; shift -= rrb_bits) {
+                            make_unique(*slot);
+                            internal_node* parent = as_internal(*slot);
+                            slot = &parent->children[child_slot(parent, shift, index)];
+                        }
+                        make_unique(*slot);
+                        as_leaf(*slot)->values()[index] = std::move(value);
+                    }
+
+                    void push_back(T value) {
+                        if(tail_ != nullptr && tail_->count < rrb_branching) {
+                            make_unique(tail_);
+                            leaf_node* tail = as_leaf(tail_);
+                            ::new(static_cast<void*>(tail->values() + tail->count)) T(std::move(value));
+                            ++tail->count;
+                            ++tail->size;
+                            ++size_;
+                            return;
+                        }
+                        leaf_node* fresh = new leaf_node();
+                        try {
+                            ::new(static_cast<void*>(fresh->values())) T(std::move(value));
+                        }
+                        catch(...) {
+                            delete fresh;
+                            throw;
+                        }
+                        fresh->count = 1;
+                        fresh->size = 1;
+                        if(tail_ != nullptr) {
+                            push_leaf_into_tree(tail_);
+                        }
+                        tail_ = fresh;
+                        ++size_;
+                    }
+
+                    void pop_back() {
+                        if(tail_->count > 1) {
+                            make_unique(tail_);
+                            leaf_node* tail = as_leaf(tail_);
+                            std::destroy_at(tail->values() + tail->count - 1);
+                            --tail->count;
+                            --tail->size;
+                            --size_;
+                            return;
+                        }
+                        release(tail_);
+                        tail_ = nullptr;
+                        --size_;
+                        if(root_ == nullptr) {
+                            return;
+                        }
+                        if(shift_ == 0) {
+                            tail_ = root_;
+                            root_ = nullptr;
+                            return;
+                        }
+                        tail_ = detach_rightmost(root_, shift_);
+                        collapse_root();
+                    }
+
+                    void clear() noexcept {
+                        release(root_);
+                        release(tail_);
+                        root_ = tail_ = nullptr;
+                        shift_ = 0;
+                        size_ = 0;
+                    }
+
+                    // Keeps the first count values.
+                    void truncate(size_type count) {
+                        if(count >= size_) {
+                            return;
+                        }
+                        if(count == 0) {
+                            clear();
+                            return;
+                        }
+                        size_type tail_start = tail_offset();
+                        if(count > tail_start) {
+                            make_unique(tail_);
+                            leaf_node* tail = as_leaf(tail_);
+                            std::destroy(tail->values() + (count - tail_start), tail->values() + tail->count);
+                            tail->count = static_cast<std::uint32_t>(count - tail_start);
+                            tail->size = tail->count;
+                            size_ = count;
+                            return;
+                        }
+                        auto [source, offset] = locate(count - 1);
+                        size_type leaf_start = count - 1 - offset;
+                        leaf_node* fresh = copy_leaf(source, 0, offset + 1);
+                        node* kept = nullptr;
+                        if(leaf_start > 0) {
+                            try {
+                                kept = cut_right(root_, shift_, leaf_start);
+                            }
+                            catch(...) {
+                                release(fresh);
+                                throw;
+                            }
+                        }
+                        release(root_);
+                        release(tail_);
+                        root_ = kept;
+                        tail_ = fresh;
+                        size_ = count;
+                        collapse_root();
+                    }
+
+                    // Removes the first count values.
+                    void drop_front(size_type count) {
+                        if(count == 0) {
+                            return;
+                        }
+                        if(count >= size_) {
+                            clear();
+                            return;
+                        }
+                        size_type tail_start = tail_offset();
+                        if(count >= tail_start) {
+                            leaf_node* fresh = copy_leaf(as_leaf(tail_), count - tail_start, tail_->count);
+                            clear();
+                            tail_ = fresh;
+                            size_ = fresh->count;
+                            return;
+                        }
+                        node* kept = cut_left(root_, shift_, count);
+                        release(root_);
+                        root_ = kept;
+                        size_ -= count;
+                        collapse_root();
+                    }
+
+                    void append(const rrb_tree& other) {
+                        if(other.size_ == 0) {
+                            return;
+                        }
+                        if(size_ == 0) {
+                            *this = other;
+                            return;
+                        }
+                        if(other.root_ == nullptr) {
+                            const leaf_node* tail = as_leaf(other.tail_);
+                            for(std::uint32_t index = 0; index < tail->count; ++index) {
+                                push_back(tail->values()[index]);
+                            }
+                            return;
+                        }
+                        if(tail_ != nullptr) {
+                            push_leaf_into_tree(tail_);
+                            tail_ = nullptr;
+                        }
+                        unsigned int shift = std::max(shift_, other.shift_);
+                        retain(other.root_);
+                        node* left = raise(root_, shift_, shift);
+                        node* right = raise(other.root_, other.shift_, shift);
+                        node* merged[2];
+                        std::uint32_t merged_count = merge_level(left, right, shift, merged);
+                        release(left);
+                        release(right);
+                        if(merged_count == 1) {
+                            root_ = merged[0];
+                            shift_ = shift;
+                        }
+                        else {
+                            internal_node* top = new internal_node();
+                            append_child(top, shift + rrb_bits, merged[0]);
+                            append_child(top, shift + rrb_bits, merged[1]);
+                            root_ = top;
+                            shift_ = shift + rrb_bits;
+                        }
+                        tail_ = other.tail_;
+                        retain(tail_);
+                        size_ += other.size_;
+                        collapse_root();
+                    }
+
+                    template<class Function>
+                    void for_each(Function& function) const {
+                        if(root_ != nullptr) {
+                            visit_leaves(root_, function);
+                        }
+                        if(tail_ != nullptr) {
+                            visit_leaves(tail_, function);
+                        }
+                    }
+            };
+
+            template<class T>
+            class persistent_array_iterator {
+                public:
+                    using iterator_category = std::forward_iterator_tag;
+                    using value_type = T;
+                    using difference_type = std::ptrdiff_t;
+                    using pointer = const T*;
+                    using reference = const T&;
+                    using size_type = unsigned long;
+
+                    persistent_array_iterator() = default;
+
+                    persistent_array_iterator(const rrb_tree<T>* tree, size_type index) : tree_(tree), index_(index) {
+                        load_leaf();
+                    }
+
+                    reference operator*() const {
+                        return leaf_.values[index_ - leaf_.first];
+                    }
+
+                    pointer operator->() const {
+                        return leaf_.values + (index_ - leaf_.first);
+                    }
+
+                    persistent_array_iterator& operator++() {
+                        if(++index_ == leaf_.first + leaf_.count) {
+                            load_leaf();
+                        }
+                        return *this;
+                    }
+
+                    persistent_array_iterator operator++(int) {
+                        persistent_array_iterator temp = *this;
+                        ++*this;
+                        return temp;
+                    }
+
+                    bool operator==(const persistent_array_iterator& other) const {
+                        return index_ == other.index_;
+                    }
+
+                private:
+                    const rrb_tree<T>* tree_ = nullptr;
+                    size_type index_ = 0;
+                    typename rrb_tree<T>::leaf_view leaf_{};
+
+                    void load_leaf() noexcept {
+                        if(index_ < tree_->size()) {
+                            leaf_ = tree_->leaf_for(index_);
+                        }
+                    }
+            };
+        }
+
+        // Immutable array in which every update returns a new version sharing all untouched
+        // nodes with the old one, so copying a version is O(1) and safe to hand to another
+        // thread. Reads and single updates take O(log32 n); appends go to a tail leaf and
+        // touch the tree once every 32 values. concat and slice rebuild only the nodes along
+        // the seams. Batches of updates are cheaper through transient().
+        template<class T>
+        class persistent_array {
+            public:
+                using value_type = T;
+                using size_type = unsigned long;
+                using const_reference = const T&;
+                using const_iterator = detail::persistent_array_iterator<T>;
+                using transient_type = transient_array<T>;
+
+            private:
+                friend class transient_array<T>;
+
+                detail::rrb_tree<T> tree_;
+
+                explicit persistent_array(detail::rrb_tree<T>&& tree) noexcept : tree_(std::move(tree)) {}
+
+                void check_index(size_type index) const {
+                    if(index >= tree_.size()) {
+                        throw std::out_of_range("Index " + std::to_string(index) + " is out of range for a persistent array of size " + std::to_string(tree_.size()) + ".");
+                    }
+                }
+
+            public:
+                persistent_array() = default;
+
+                template<class InputIt>
+                persistent_array(InputIt first, InputIt last) {
+                    for(; first != last; ++first) {
+                        tree_.push_back(*first);
+                    }
+                }
+
+                persistent_array(std::initializer_list<T> values) : persistent_array(values.begin(), values.end()) {}
+
+                size_type size() const noexcept {
+                    return tree_.size();
+                }
+
+                [[nodiscard]] bool empty() const noexcept {
+                    return tree_.size() == 0;
+                }
+
+                const_reference operator[](size_type index) const noexcept {
+                    return tree_.get(index);
+                }
+
+                const_reference at(size_type index) const {
+                    check_index(index);
+                    return tree_.get(index);
+                }
+
+                const_reference front() const noexcept {
+                    return tree_.get(0);
+                }
+
+                const_reference back() const noexcept {
+                    return tree_.get(tree_.size() - 1);
+                }
+
+                [[nodiscard]] persistent_array set(size_type index, T value) const {
+                    check_index(index);
+                    persistent_array updated(*this);
+                    updated.tree_.set(index, std::move(value));
+                    return updated;
+                }
+
+                [[nodiscard]] persistent_array push_back(T value) const {
+                    persistent_array updated(*this);
+                    updated.tree_.push_back(std::move(value));
+                    return updated;
+                }
+
+                [[nodiscard]] persistent_array pop_back() const {
+                    if(empty()) {
+                        throw std::out_of_range("Cannot pop from an empty persistent array.");
+                    }
+                    persistent_array updated(*this);
+                    updated.tree_.pop_back();
+                    return updated;
+                }
+
+                [[nodiscard]] persistent_array concat(const persistent_array& other) const {
+                    persistent_array joined(*this);
+                    joined.tree_.append(other.tree_);
+                    return joined;
+                }
+
+                // Values [first, last).
+                [[nodiscard]] persistent_array slice(size_type first, size_type last) const {
+                    if(first > last || last > size()) {
+                        throw std::out_of_range("Slice [" + std::to_string(first) + ", " + std::to_string(last) + ") is out of range for a persistent array of size " + std::to_string(size()) + ".");
+                    }
+                    persistent_array sliced(*this);
+                    sliced.tree_.truncate(last);
+                    sliced.tree_.drop_front(first);
+                    return sliced;
+                }
+
+                [[nodiscard]] persistent_array take(size_type count) const {
+                    return slice(0, std::min(count, size()));
+                }
+
+                [[nodiscard]] persistent_array drop(size_type count) const {
+                    return slice(std::min(count, size()), size());
+                }
+
+                transient_type transient() const {
+                    return transient_type(tree_);
+                }
+
+                unsigned int height() const noexcept {
+                    return tree_.height();
+                }
+
+                template<class Function>
+                void for_each(Function&& function) const {
+                    tree_.for_each(function);
+                }
+
+                const_iterator begin() const {
+                    return const_iterator(&tree_, 0);
+                }
+
+                const_iterator end() const {
+                    return const_iterator(&tree_, size());
+                }
+        };
+
+        // Mutable view of a persistent array for batches of updates. The first write to a node
+        // still shared with a persistent version copies it, and later writes to the same node
+        // happen in place. persistent() hands the result over as a new version in O(1).
+        template<class T>
+        class transient_array {
+            public:
+                using value_type = T;
+                using size_type = unsigned long;
+                using const_reference = const T&;
+
+            private:
+                friend class persistent_array<T>;
+
+                detail::rrb_tree<T> tree_;
+
+                explicit transient_array(const detail::rrb_tree<T>& tree) : tree_(tree) {}
+
+                void check_index(size_type index) const {
+                    if(index >= tree_.size()) {
+                        throw std::out_of_range("Index " + std::to_string(index) + " is out of range for a transient array of size " + std::to_string(tree_.size()) + ".");
+                    }
+                }
+
+            public:
+                transient_array() = default;
+
+                size_type size() const noexcept {
+                    return tree_.size();
+                }
+
+                [[nodiscard]] bool empty() const noexcept {
+                    return tree_.size() == 0;
+                }
+
+                const_reference operator[](size_type index) const noexcept {
+                    return tree_.get(index);
+                }
+
+                const_reference at(size_type index) const {
+                    check_index(index);
+                    return tree_.get(index);
+                }
+
+                void set(size_type index, T value) {
+                    check_index(index);
+                    tree_.set(index, std::move(value));
+                }
+
+                void push_back(T value) {
+                    tree_.push_back(std::move(value));
+                }
+
+                void pop_back() {
+                    if(empty()) {
+                        throw std::out_of_range("Cannot pop from an empty transient array.");
+                    }
+                    tree_.pop_back();
+                }
+
+                void append(const persistent_array<T>& other) {
+                    tree_.append(other.tree_);
+                }
+
+                // Leaves this transient empty.
+                persistent_array<T> persistent() {
+                    return persistent_array<T>(std::move(tree_));
+                }
+        };
+    }
+}
+
+#endif
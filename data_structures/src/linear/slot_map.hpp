@@ -0,0 +1,239 @@
+#ifndef DATA_STRUCTURES_LINEAR_SLOT_MAP_HPP
+#define DATA_STRUCTURES_LINEAR_SLOT_MAP_HPP
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "data_structures/src/linear/dynamic_array.hpp"
+
+namespace data_structures {
+    namespace linear {
+
+        struct slot_handle {
+            std::uint32_t index = std::numeric_limits<std::uint32_t>::max();
+            std::uint32_t generation = 0;
+
+            bool operator==(const slot_handle& other) const = default;
+        };
+
+        // Values are kept densely packed for iteration while handles stay valid until their
+        // element is erased. A handle names a slot, and the slot records where its value
+        // currently sits; erase moves the last value into the hole and repoints that value's
+        // slot. Each slot's generation is odd while it is occupied and is bumped on every
+        // insert and erase, so a handle to an erased element never matches a reused slot.
+        template<class T, class Allocator = std::allocator<T>>
+        class slot_map {
+            public:
+                using value_type = T;
+                using reference = value_type&;
+                using const_reference = const value_type&;
+                using size_type = unsigned long;
+                using handle_type = slot_handle;
+                using container_type = dynamic_array<T, Allocator, no_instrumentation, unchecked>;
+                using iterator = typename container_type::iterator;
+                using const_iterator = typename container_type::const_iterator;
+
+            private:
+                static constexpr std::uint32_t null_index = std::numeric_limits<std::uint32_t>::max();
+
+                struct slot {
+                    std::uint32_t target;
+                    std::uint32_t generation;
+                };
+
+                template<class U>
+                using index_array = dynamic_array<U, std::allocator<U>, no_instrumentation, unchecked>;
+
+                container_type values_;
+                index_array<std::uint32_t> value_slots_;
+                index_array<slot> slots_;
+                std::uint32_t free_head_ = null_index;
+
+                bool is_live(const slot_handle& handle) const noexcept {
+                    return handle.index < slots_.size() && slots_[handle.index].generation == handle.generation && (handle.generation & 1) != 0;
+                }
+
+                void check_handle(const slot_handle& handle) const {
+                    if(!is_live(handle)) {
+                        throw std::out_of_range("Handle " + std::to_string(handle.index) + ":" + std::to_string(handle.generation) + " does not refer to a live element.");
+                    }
+                }
+
+                slot_handle acquire_slot() {
+                    if(values_.size() >= null_index) {
+                        throw std::length_error("A slot map holds at most 2^32 - 1 elements.");
+                    }
+                    std::uint32_t index;
+                    if(free_head_ != null_index) {
+                        index = free_head_;
+                        free_head_ = slots_[index].target;
+                    }
+                    else {
+                        index = static_cast<std::uint32_t>(slots_.size());
+                        slots_.push_back(slot{0, 0});
+                    }
+                    slot& acquired = slots_[index];
+                    acquired.target = static_cast<std::uint32_t>(values_.size());
+                    ++acquired.generation;
+                    return slot_handle{index, acquired.generation};
+                }
+
+                void release_slot(std::uint32_t index) noexcept {
+                    ++slots_[index].generation;
+                    slots_[index].target = free_head_;
+                    free_head_ = index;
+                }
+
+            public:
+                slot_map() = default;
+
+                explicit slot_map(const Allocator& alloc) : values_(alloc) {}
+
+                slot_handle insert(const T& value) {
+                    return emplace(value);
+                }
+
+                slot_handle insert(T&& value) {
+                    return emplace(std::move(value));
+                }
+
+                template<class... Args>
+                slot_handle emplace(Args&&... args) {
+                    slot_handle handle = acquire_slot();
+                    try {
+                        value_slots_.push_back(handle.index);
+                        values_.emplace_back(std::forward<Args>(args)...);
+                    }
+                    catch(...) {
+                        if(value_slots_.size() > values_.size()) {
+                            value_slots_.pop_back();
+                        }
+                        release_slot(handle.index);
+                        throw;
+                    }
+                    return handle;
+                }
+
+                bool erase(const slot_handle& handle) {
+                    if(!is_live(handle)) {
+                        return false;
+                    }
+                    std::uint32_t position = slots_[handle.index].target;
+                    std::uint32_t last = static_cast<std::uint32_t>(values_.size() - 1);
+                    if(position != last) {
+                        values_[position] = std::move(values_[last]);
+                        value_slots_[position] = value_slots_[last];
+                        slots_[value_slots_[position]].target = position;
+                    }
+                    values_.pop_back();
+                    value_slots_.pop_back();
+                    release_slot(handle.index);
+                    return true;
+                }
+
+                bool contains(const slot_handle& handle) const noexcept {
+                    return is_live(handle);
+                }
+
+                T* find(const slot_handle& handle) noexcept {
+                    return is_live(handle) ? &values_[slots_[handle.index].target] : nullptr;
+                }
+
+                const T* find(const slot_handle& handle) const noexcept {
+                    return is_live(handle) ? &values_[slots_[handle.index].target] : nullptr;
+                }
+
+                reference at(const slot_handle& handle) {
+                    check_handle(handle);
+                    return values_[slots_[handle.index].target];
+                }
+
+                const_reference at(const slot_handle& handle) const {
+                    check_handle(handle);
+                    return values_[slots_[handle.index].target];
+                }
+
+                reference operator[](const slot_handle& handle) noexcept {
+                    return values_[slots_[handle.index].target];
+                }
+
+                const_reference operator[](const slot_handle& handle) const noexcept {
+                    return values_[slots_[handle.index].target];
+                }
+
+                // Handle of the value at a position in dense iteration order.
+                slot_handle handle_at(size_type position) const {
+                    if(position >= values_.size()) {
+                        throw std::out_of_range("Position " + std::to_string(position) + " is out of range for size " + std::to_string(values_.size()));
+                    }
+                    std::uint32_t index = value_slots_[position];
+                    return slot_handle{index, slots_[index].generation};
+                }
+
+                void reserve(size_type n) {
+                    values_.reserve(n);
+                    value_slots_.reserve(n);
+                    slots_.reserve(n);
+                }
+
+                void clear() {
+                    for(size_type position = 0; position < value_slots_.size(); ++position) {
+                        release_slot(value_slots_[position]);
+                    }
+                    values_.clear();
+                    value_slots_.clear();
+                }
+
+                size_type size() const noexcept {
+                    return values_.size();
+                }
+
+                [[nodiscard]] bool empty() const noexcept {
+                    return values_.size() == 0;
+                }
+
+                size_type slot_count() const noexcept {
+                    return slots_.size();
+                }
+
+                iterator begin() noexcept {
+                    return values_.begin();
+                }
+
+                iterator end() noexcept {
+                    return values_.end();
+                }
+
+                const_iterator begin() const noexcept {
+                    return values_.cbegin();
+                }
+
+                const_iterator end() const noexcept {
+                    return values_.cend();
+                }
+
+                const_iterator cbegin() const noexcept {
+                    return values_.cbegin();
+                }
+
+                const_iterator cend() const noexcept {
+                    return values_.cend();
+                }
+
+                std::span<T> values() noexcept {
+                    return std::span<T>(values_.data(), values_.size());
+                }
+
+                std::span<const T> values() const noexcept {
+                    return std::span<const T>(values_.data(), values_.size());
+                }
+        };
+    }
+}
+
+#endif
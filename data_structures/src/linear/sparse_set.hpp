@@ -0,0 +1,262 @@
+#ifndef DATA_STRUCTURES_LINEAR_SPARSE_SET_HPP
+#define DATA_STRUCTURES_LINEAR_SPARSE_SET_HPP
+
+#include <concepts>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "data_structures/src/linear/dynamic_array.hpp"
+
+namespace data_structures {
+    namespace linear {
+
+        // Set of integers in [0, universe) kept as a dense array of members plus a sparse array
+        // from key to dense position. A key is a member only if its sparse entry points at a
+        // dense slot holding that same key, so stale sparse entries are harmless and clear
+        // just forgets the dense array. Iteration walks the dense array in insertion order,
+        // except that erase moves the last member into the erased position.
+        template<std::unsigned_integral Key = std::uint32_t>
+        class sparse_set {
+            public:
+                using key_type = Key;
+                using value_type = Key;
+                using size_type = unsigned long;
+
+            private:
+                template<class U>
+                using array_type = dynamic_array<U, std::allocator<U>, no_instrumentation, unchecked>;
+
+                array_type<Key> dense_;
+                array_type<Key> sparse_;
+
+                void check_key(Key key) const {
+                    if(key >= sparse_.size()) {
+                        throw std::out_of_range("Key " + std::to_string(key) + " is outside the universe of size " + std::to_string(sparse_.size()));
+                    }
+                }
+
+            public:
+                using const_iterator = typename array_type<Key>::const_iterator;
+
+                explicit sparse_set(size_type universe = 0) {
+                    sparse_.resize(universe, 0);
+                }
+
+                void reserve_universe(size_type universe) {
+                    if(universe > sparse_.size()) {
+                        sparse_.resize(universe, 0);
+                    }
+                }
+
+                size_type universe() const noexcept {
+                    return sparse_.size();
+                }
+
+                bool contains(Key key) const noexcept {
+                    if(key >= sparse_.size()) {
+                        return false;
+                    }
+                    size_type position = sparse_[key];
+                    return position < dense_.size() && dense_[position] == key;
+                }
+
+                bool insert(Key key) {
+                    check_key(key);
+                    if(contains(key)) {
+                        return false;
+                    }
+                    sparse_[key] = static_cast<Key>(dense_.size());
+                    dense_.push_back(key);
+                    return true;
+                }
+
+                bool erase(Key key) noexcept {
+                    if(!contains(key)) {
+                        return false;
+                    }
+                    Key position = sparse_[key];
+                    Key last = dense_[dense_.size() - 1];
+                    dense_[position] = last;
+                    sparse_[last] = position;
+                    dense_.pop_back();
+                    return true;
+                }
+
+                void clear() noexcept {
+                    dense_.clear();
+                }
+
+                size_type size() const noexcept {
+                    return dense_.size();
+                }
+
+                [[nodiscard]] bool empty() const noexcept {
+                    return dense_.size() == 0;
+                }
+
+                // Position of a member in iteration order.
+                size_type index_of(Key key) const {
+                    if(!contains(key)) {
+                        throw std::out_of_range("Key " + std::to_string(key) + " is not in the set.");
+                    }
+                    return sparse_[key];
+                }
+
+                const_iterator begin() const noexcept {
+                    return dense_.cbegin();
+                }
+
+                const_iterator end() const noexcept {
+                    return dense_.cend();
+                }
+
+                std::span<const Key> keys() const noexcept {
+                    return std::span<const Key>(dense_.data(), dense_.size());
+                }
+        };
+
+        // sparse_set with a value stored alongside each member in a second dense array, so
+        // iterating the values is a plain array walk.
+        template<class Value, std::unsigned_integral Key = std::uint32_t>
+        class sparse_map {
+            public:
+                using key_type = Key;
+                using mapped_type = Value;
+                using size_type = unsigned long;
+
+            private:
+                sparse_set<Key> keys_;
+                dynamic_array<Value, std::allocator<Value>, no_instrumentation, unchecked> values_;
+
+            public:
+                explicit sparse_map(size_type universe = 0) : keys_(universe) {}
+
+                void reserve_universe(size_type universe) {
+                    keys_.reserve_universe(universe);
+                }
+
+                size_type universe() const noexcept {
+                    return keys_.universe();
+                }
+
+                bool contains(Key key) const noexcept {
+                    return keys_.contains(key);
+                }
+
+                template<class... Args>
+                bool try_emplace(Key key, Args&&... args) {
+                    if(!keys_.insert(key)) {
+                        return false;
+                    }
+                    try {
+                        values_.emplace_back(std::forward<Args>(args)...);
+                    }
+                    catch(...) {
+                        keys_.erase(key);
+                        throw;
+                    }
+                    return true;
+                }
+
+                bool insert(Key key, const Value& value) {
+                    return try_emplace(key, value);
+                }
+
+                bool insert(Key key, Value&& value) {
+                    return try_emplace(key, std::move(value));
+                }
+
+                template<class V>
+                bool insert_or_assign(Key key, V&& value) {
+                    if(keys_.contains(key)) {
+                        values_[keys_.index_of(key)] = std::forward<V>(value);
+                        return false;
+                    }
+                    return try_emplace(key, std::forward<V>(value));
+                }
+
+                Value& operator[](Key key) {
+                    try_emplace(key);
+                    return values_[keys_.index_of(key)];
+                }
+
+                Value* find(Key key) noexcept {
+                    return keys_.contains(key) ? &values_[keys_.index_of(key)] : nullptr;
+                }
+
+                const Value* find(Key key) const noexcept {
+                    return keys_.contains(key) ? &values_[keys_.index_of(key)] : nullptr;
+                }
+
+                Value& at(Key key) {
+                    return values_[keys_.index_of(key)];
+                }
+
+                const Value& at(Key key) const {
+                    return values_[keys_.index_of(key)];
+                }
+
+                bool erase(Key key) {
+                    if(!keys_.contains(key)) {
+                        return false;
+                    }
+                    size_type position = keys_.index_of(key);
+                    size_type last = values_.size() - 1;
+                    if(position != last) {
+                        values_[position] = std::move(values_[last]);
+                    }
+                    values_.pop_back();
+                    keys_.erase(key);
+                    return true;
+                }
+
+                // Constant time for trivially destructible values.
+                void clear() noexcept {
+                    keys_.clear();
+                    values_.clear();
+                }
+
+                size_type size() const noexcept {
+                    return keys_.size();
+                }
+
+                [[nodiscard]] bool empty() const noexcept {
+                    return keys_.empty();
+                }
+
+                std::span<const Key> keys() const noexcept {
+                    return keys_.keys();
+                }
+
+                std::span<Value> values() noexcept {
+                    return std::span<Value>(values_.data(), values_.size());
+                }
+
+                std::span<const Value> values() const noexcept {
+                    return std::span<const Value>(values_.data(), values_.size());
+                }
+
+                template<class Function>
+                void for_each(Function&& function) {
+                    std::span<const Key> member_keys = keys_.keys();
+                    for(size_type position = 0; position < member_keys.size(); ++position) {
+                        function(member_keys[position], values_[position]);
+                    }
+                }
+
+                template<class Function>
+                void for_each(Function&& function) const {
+                    std::span<const Key> member_keys = keys_.keys();
+                    for(size_type position = 0; position < member_keys.size(); ++position) {
+                        function(member_keys[position], values_[position]);
+                    }
+                }
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,356 @@
+#ifndef DATA_STRUCTURES_LINEAR_STRING_ARRAY_HPP
+#define DATA_STRUCTURES_LINEAR_STRING_ARRAY_HPP
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "data_structures/src/linear/dynamic_array.hpp"
+#include "data_structures/src/sort/pdq_sort.hpp"
+
+namespace data_structures {
+    namespace linear {
+
+        // Many strings stored back to back in one character buffer, with string i occupying
+        // [offsets[i], offsets[i + 1]). Offset bounds the total number of characters and, for
+        // sorting, the number of strings; 32 bit offsets halve the index for data under 4GB.
+        template<std::unsigned_integral Offset = std::uint32_t>
+        class string_array {
+            public:
+                using value_type = std::string_view;
+                using size_type = unsigned long;
+                using offset_type = Offset;
+                using char_buffer = dynamic_array<char, std::allocator<char>, no_instrumentation, unchecked>;
+                using offset_buffer = dynamic_array<Offset, std::allocator<Offset>, no_instrumentation, unchecked>;
+
+                class const_iterator {
+                    public:
+                        using iterator_concept = std::random_access_iterator_tag;
+                        using iterator_category = std::input_iterator_tag;
+                        using value_type = std::string_view;
+                        using difference_type = std::ptrdiff_t;
+                        using reference = std::string_view;
+
+                        const_iterator() = default;
+
+                        const_iterator(const string_array* owner, size_type index) : owner_(owner), index_(index) {}
+
+                        std::string_view operator*() const {
+                            return (*owner_)[index_];
+                        }
+
+                        std::string_view operator[](difference_type offset) const {
+                            return (*owner_)[index_ + offset];
+                        }
+
+                        const_iterator& operator++() {
+                            ++index_;
+                            return *this;
+                        }
+
+                        const_iterator operator++(int) {
+                            const_iterator temp = *this;
+                            ++index_;
+                            return temp;
+                        }
+
+                        const_iterator& operator--() {
+                            --index_;
+                            return *this;
+                        }
+
+                        const_iterator operator--(int) {
+                            const_iterator temp = *this;
+                            --index_;
+                            return temp;
+                        }
+
+                        const_iterator& operator+=(difference_type offset) {
+                            index_ += offset;
+                            return *this;
+                        }
+
+                        const_iterator& operator-=(difference_type offset) {
+                            index_ -= offset;
+                            return *this;
+                        }
+
+                        friend const_iterator operator+(const_iterator iterator, difference_type offset) {
+                            return iterator += offset;
+                        }
+
+                        friend const_iterator operator+(difference_type offset, const_iterator iterator) {
+                            return iterator += offset;
+                        }
+
+                        friend const_iterator operator-(const_iterator iterator, difference_type offset) {
+                            return iterator -= offset;
+                        }
+
+                        friend difference_type operator-(const const_iterator& first, const const_iterator& second) {
+                            return static_cast<difference_type>(first.index_) - static_cast<difference_type>(second.index_);
+                        }
+
+                        bool operator==(const const_iterator& other) const {
+                            return index_ == other.index_;
+                        }
+
+                        auto operator<=>(const const_iterator& other) const {
+                            return index_ <=> other.index_;
+                        }
+
+                    private:
+                        const string_array* owner_ = nullptr;
+                        size_type index_ = 0;
+                };
+
+            private:
+                char_buffer chars_;
+                offset_buffer offsets_;
+
+                static void check_total(size_type current_chars, size_type added_chars) {
+                    if(added_chars > std::numeric_limits<Offset>::max() - current_chars) {
+                        throw std::length_error("A string array with " + std::to_string(sizeof(Offset) * 8) + " bit offsets cannot hold more than " +
+                                                std::to_string(std::numeric_limits<Offset>::max()) + " characters.");
+                    }
+                }
+
+                void check_capacity(size_type added_chars) const {
+                    check_total(chars_.size(), added_chars);
+                }
+
+                void check_index(size_type index) const {
+                    if(index >= size()) {
+                        throw std::out_of_range("Index " + std::to_string(index) + " is out of range for a string array of size " + std::to_string(size()) + ".");
+                    }
+                }
+
+                // The first eight bytes big endian, zero padded, so comparing prefixes as integers
+                // agrees with comparing the strings up to a tie.
+                static std::uint64_t sort_prefix(std::string_view value) noexcept {
+                    std::uint64_t prefix = 0;
+                    size_type length = std::min<size_type>(value.size(), 8);
+                    for(size_type index = 0; index < length; ++index) {
+                        prefix |= std::uint64_t(static_cast<unsigned char>(value[index])) << (56 - 8 * index);
+                    }
+                    return prefix;
+                }
+
+            public:
+                string_array() {
+                    offsets_.push_back(0);
+                }
+
+                string_array(std::initializer_list<std::string_view> values) : string_array() {
+                    append(values.begin(), values.end());
+                }
+
+                void reserve(size_type strings, size_type chars) {
+                    offsets_.reserve(strings + 1);
+                    chars_.reserve(chars);
+                }
+
+                void push_back(std::string_view value) {
+                    check_capacity(value.size());
+                    if(!value.empty()) {
+                        std::memcpy(chars_.append_uninitialized(value.size()).data(), value.data(), value.size());
+                    }
+                    offsets_.push_back(static_cast<Offset>(chars_.size()));
+                }
+
+                // Sizes forward ranges up front so both buffers grow at most once.
+                template<std::input_iterator InputIt>
+                void append(InputIt first, InputIt last) {
+                    if constexpr(std::forward_iterator<InputIt>) {
+                        size_type strings = 0;
+                        size_type chars = 0;
+                        for(InputIt current = first; current != last; ++current) {
+                            ++strings;
+                            chars += std::string_view(*current).size();
+                        }
+                        check_capacity(chars);
+                        reserve(size() + strings, chars_.size() + chars);
+                    }
+                    for(; first != last; ++first) {
+                        push_back(std::string_view(*first));
+                    }
+                }
+
+                // other may be this array, so its spans are only taken once the buffers they
+                // point into have grown; the copied ranges are the ones that existed before.
+                template<std::unsigned_integral OtherOffset>
+                void append(const string_array<OtherOffset>& other) {
+                    size_type other_chars = other.char_count();
+                    size_type other_size = other.size();
+                    check_capacity(other_chars);
+                    Offset base = static_cast<Offset>(chars_.size());
+                    if(other_chars > 0) {
+                        char* destination = chars_.append_uninitialized(other_chars).data();
+                        std::memcpy(destination, other.chars().data(), other_chars);
+                    }
+                    offsets_.reserve(offsets_.size() + other_size);
+                    std::span<const OtherOffset> other_offsets = other.offsets();
+                    for(size_type index = 1; index <= other_size; ++index) {
+                        offsets_.push_back(static_cast<Offset>(base + other_offsets[index]));
+                    }
+                }
+
+                void pop_back() {
+                    offsets_.pop_back();
+                    chars_.resize_uninitialized(offsets_[offsets_.size() - 1]);
+                }
+
+                void clear() {
+                    chars_.clear();
+                    offsets_.clear();
+                    offsets_.push_back(0);
+                }
+
+                std::string_view operator[](size_type index) const noexcept {
+                    return std::string_view(chars_.data() + offsets_[index], offsets_[index + 1] - offsets_[index]);
+                }
+
+                std::string_view at(size_type index) const {
+                    check_index(index);
+                    return (*this)[index];
+                }
+
+                std::string_view front() const noexcept {
+                    return (*this)[0];
+                }
+
+                std::string_view back() const noexcept {
+                    return (*this)[size() - 1];
+                }
+
+                size_type size() const noexcept {
+                    return offsets_.size() - 1;
+                }
+
+                [[nodiscard]] bool empty() const noexcept {
+                    return offsets_.size() == 1;
+                }
+
+                size_type char_count() const noexcept {
+                    return chars_.size();
+                }
+
+                std::span<const char> chars() const noexcept {
+                    return std::span<const char>(chars_.data(), chars_.size());
+                }
+
+                std::span<const Offset> offsets() const noexcept {
+                    return std::span<const Offset>(offsets_.data(), offsets_.size());
+                }
+
+                const_iterator begin() const noexcept {
+                    return const_iterator(this, 0);
+                }
+
+                const_iterator end() const noexcept {
+                    return const_iterator(this, size());
+                }
+
+                // Returns the indices of the strings in ascending order. Sorting (prefix, index)
+                // pairs settles most comparisons on the cached prefix without touching the
+                // character buffer; only strings sharing their first eight bytes are compared
+                // in full. Equal strings keep their relative order.
+                dynamic_array<Offset, std::allocator<Offset>, no_instrumentation, unchecked> sort_permutation() const {
+                    struct entry {
+                        std::uint64_t prefix;
+                        Offset index;
+                    };
+                    if(size() > std::numeric_limits<Offset>::max()) {
+                        throw std::length_error("Too many strings to sort with this offset type.");
+                    }
+                    dynamic_array<entry, std::allocator<entry>, no_instrumentation, unchecked> entries;
+                    entries.resize_uninitialized(size());
+                    for(size_type index = 0; index < size(); ++index) {
+                        entries[index] = entry{sort_prefix((*this)[index]), static_cast<Offset>(index)};
+                    }
+                    sort::pdq_sort(entries, [this](const entry& first, const entry& second) {
+                        if(first.prefix != second.prefix) {
+                            return first.prefix < second.prefix;
+                        }
+                        int order = (*this)[first.index].compare((*this)[second.index]);
+                        return order != 0 ? order < 0 : first.index < second.index;
+                    });
+                    dynamic_array<Offset, std::allocator<Offset>, no_instrumentation, unchecked> permutation;
+                    permutation.resize_uninitialized(size());
+                    for(size_type index = 0; index < size(); ++index) {
+                        permutation[index] = entries[index].index;
+                    }
+                    return permutation;
+                }
+
+                template<class Compare>
+                dynamic_array<Offset, std::allocator<Offset>, no_instrumentation, unchecked> sort_permutation(Compare compare) const {
+                    if(size() > std::numeric_limits<Offset>::max()) {
+                        throw std::length_error("Too many strings to sort with this offset type.");
+                    }
+                    dynamic_array<Offset, std::allocator<Offset>, no_instrumentation, unchecked> permutation;
+                    permutation.resize_uninitialized(size());
+                    for(size_type index = 0; index < size(); ++index) {
+                        permutation[index] = static_cast<Offset>(index);
+                    }
+                    sort::pdq_sort(permutation, [&](Offset first, Offset second) {
+                        return compare((*this)[first], (*this)[second]);
+                    });
+                    return permutation;
+                }
+
+                // Rebuilds the array so that string i is the former string permutation[i]. The
+                // permutation may repeat or drop indices, which selects a subset.
+                void permute(std::span<const Offset> permutation) {
+                    char_buffer chars;
+                    offset_buffer offsets;
+                    size_type total = 0;
+                    for(Offset index : permutation) {
+                        check_index(index);
+                        size_type length = offsets_[index + 1] - offsets_[index];
+                        check_total(total, length);
+                        total += length;
+                    }
+                    chars.reserve(total);
+                    offsets.reserve(permutation.size() + 1);
+                    offsets.push_back(0);
+                    for(Offset index : permutation) {
+                        std::string_view value = (*this)[index];
+                        if(!value.empty()) {
+                            std::memcpy(chars.append_uninitialized(value.size()).data(), value.data(), value.size());
+                        }
+                        offsets.push_back(static_cast<Offset>(chars.size()));
+                    }
+                    chars_.swap(chars);
+                    offsets_.swap(offsets);
+                }
+
+                void sort() {
+                    auto permutation = sort_permutation();
+                    permute(std::span<const Offset>(permutation.data(), permutation.size()));
+                }
+
+                template<class Compare>
+                void sort(Compare compare) {
+                    auto permutation = sort_permutation(compare);
+                    permute(std::span<const Offset>(permutation.data(), permutation.size()));
+                }
+
+                bool operator==(const string_array& other) const {
+                    return std::ranges::equal(chars(), other.chars()) && std::ranges::equal(offsets(), other.offsets());
+                }
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,935 @@
+#ifndef DATA_STRUCTURES_MAP_ADAPTIVE_RADIX_TREE_HPP
+#define DATA_STRUCTURES_MAP_ADAPTIVE_RADIX_TREE_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace data_structures {
+    namespace map {
+
+        // Maps a key to the byte string the tree branches on. Byte strings compare the same
+        // way as their keys, so iteration follows key order.
+        template<class Key>
+        struct art_key_traits;
+
+        template<>
+        struct art_key_traits<std::string> {
+            using lookup_type = std::string_view;
+
+            static std::string_view encode(std::string_view key) noexcept {
+                return key;
+            }
+        };
+
+        // Integers are stored big endian with the sign bit flipped.
+        template<std::integral Key> requires (!std::same_as<Key, bool>)
+        struct art_key_traits<Key> {
+            using lookup_type = Key;
+
+            static std::array<unsigned char, sizeof(Key)> encode(Key key) noexcept {
+                using bits_type = std::make_unsigned_t<Key>;
+                bits_type bits = static_cast<bits_type>(key);
+                if constexpr(std::is_signed_v<Key>) {
+                    bits ^= bits_type(1) << (std::numeric_limits<bits_type>::digits - 1);
+                }
+                std::array<unsigned char, sizeof(Key)> bytes;
+                for(std::size_t index = 0; index < sizeof(Key); ++index) {
+                    bytes[index] = static_cast<unsigned char>(bits >> (8 * (sizeof(Key) - 1 - index)));
+                }
+                return bytes;
+            }
+        };
+
+        // Adaptive radix tree (Leis et al.): inner nodes branch on one key byte and come in
+        // four sizes, Node4 and Node16 with sorted key bytes, Node48 with a 256 entry index
+        // into 48 children and Node256 with a direct child array, so a node grows and shrinks
+        // with its fan-out. Node16 is searched with one SSE2 compare where available. Chains of
+        // single-child nodes are collapsed into a prefix on the node below (path compression),
+        // of which the first stored_prefix_length bytes are kept inline and the rest recovered
+        // from any leaf underneath; lookups skip the unstored bytes and verify the full key at
+        // the leaf. A leaf stays directly under the first node where its key diverges from the
+        // others (lazy expansion). A key that ends where a node branches, such as "ab" next
+        // to "abc", is kept in that node's terminal slot, which orders before its children.
+        template<class Key, class Value>
+        class adaptive_radix_tree {
+            public:
+                using key_type = Key;
+                using mapped_type = Value;
+                using size_type = unsigned long;
+                using traits_type = art_key_traits<Key>;
+                using lookup_type = typename traits_type::lookup_type;
+
+                static constexpr std::uint32_t stored_prefix_length = 8;
+
+            private:
+                using key_bytes = std::span<const unsigned char>;
+                using child_ptr = std::uintptr_t;
+
+                enum class node_kind : std::uint8_t {
+                    node4,
+                    node16,
+                    node48,
+                    node256
+                };
+
+                struct leaf {
+                    Key key;
+                    Value value;
+                };
+
+                struct inner_node {
+                    node_kind kind;
+                    std::uint16_t count = 0;
+                    std::uint32_t prefix_length = 0;
+                    unsigned char prefix[stored_prefix_length] = {};
+                    leaf* terminal = nullptr;
+
+                    explicit inner_node(node_kind node_type) : kind(node_type) {}
+                };
+
+                struct node4 : inner_node {
+                    unsigned char keys[4] = {};
+                    child_ptr children[4] = {};
+
+                    node4() : inner_node(node_kind::node4) {}
+                };
+
+                struct node16 : inner_node {
+                    unsigned char keys[16] = {};
+                    child_ptr children[16] = {};
+
+                    node16() : inner_node(node_kind::node16) {}
+                };
+
+                struct node48 : inner_node {
+                    unsigned char child_index[256] = {};
+                    child_ptr children[48] = {};
+
+                    node48() : inner_node(node_kind::node48) {}
+                };
+
+                struct node256 : inner_node {
+                    child_ptr children[256] = {};
+
+                    node256() : inner_node(node_kind::node256) {}
+                };
+
+                child_ptr root_ = 0;
+                size_type size_ = 0;
+
+                static bool is_leaf(child_ptr child) noexcept {
+                    return (child & 1) != 0;
+                }
+
+                static leaf* as_leaf(child_ptr child) noexcept {
+                    return reinterpret_cast<leaf*>(child & ~child_ptr(1));
+                }
+
+                static inner_node* as_node(child_ptr child) noexcept {
+                    return reinterpret_cast<inner_node*>(child);
+                }
+
+                static child_ptr tag(leaf* value) noexcept {
+                    return reinterpret_cast<child_ptr>(value) | 1;
+                }
+
+                static child_ptr tag(inner_node* node) noexcept {
+                    return reinterpret_cast<child_ptr>(node);
+                }
+
+                template<class Encoded>
+                static key_bytes view_of(const Encoded& encoded) noexcept {
+                    return key_bytes(reinterpret_cast<const unsigned char*>(encoded.data()), encoded.size());
+                }
+
+                static bool leaf_matches(const leaf* candidate, key_bytes key) noexcept {
+                    auto encoded = traits_type::encode(candidate->key);
+                    key_bytes bytes = view_of(encoded);
+                    return bytes.size() == key.size() && std::equal(bytes.begin(), bytes.end(), key.begin());
+                }
+
+                static void delete_node(inner_node* node) noexcept {
+                    switch(node->kind) {
+                        case node_kind::node4:
+                            delete static_cast<node4*>(node);
+                            break;
+                        case node_kind::node16:
+                            delete static_cast<node16*>(node);
+                            break;
+                        case node_kind::node48:
+                            delete static_cast<node48*>(node);
+                            break;
+                        case node_kind::node256:
+                            delete static_cast<node256*>(node);
+                            break;
+                    }
+                }
+
+                // Calls visit(child) for each child in key byte order until it returns false.
+                template<class Visit>
+                static bool visit_children(const inner_node* node, Visit&& visit) {
+                    switch(node->kind) {
+                        case node_kind::node4: {
+                            const node4* small = static_cast<const node4*>(node);
+                            for(std::uint16_t index = 0; index < small->count; ++index) {
+                                if(!visit(small->children[index])) {
+                                    return false;
+                                }
+                            }
+                            return true;
+                        }
+                        case node_kind::node16: {
+                            const node16* medium = static_cast<const node16*>(node);
+                            for(std::uint16_t index = 0; index < medium->count; ++index) {
+                                if(!visit(medium->children[index])) {
+                                    return false;
+                                }
+                            }
+                            return true;
+                        }
+                        case node_kind::node48: {
+                            const node48* large = static_cast<const node48*>(node);
+                            for(unsigned int byte = 0; byte < 256; ++byte) {
+                                if(large->child_index[byte] != 0 && !visit(large->children[large->child_index[byte] - 1])) {
+                                    return false;
+                                }
+                            }
+                            return true;
+                        }
+                        case node_kind::node256: {
+                            const node256* full = static_cast<const node256*>(node);
+                            for(unsigned int byte = 0; byte < 256; ++byte) {
+                                if(full->children[byte] != 0 && !visit(full->children[byte])) {
+                                    return false;
+                                }
+                            }
+                            return true;
+                        }
+                    }
+                    return true;
+                }
+
+                static void destroy(child_ptr child) noexcept {
+                    if(child == 0) {
+                        return;
+                    }
+                    if(is_leaf(child)) {
+                        delete as_leaf(child);
+                        return;
+                    }
+                    inner_node* node = as_node(child);
+                    delete node->terminal;
+                    visit_children(node, [](child_ptr grandchild) {
+                        destroy(grandchild);
+                        return true;
+                    });
+                    delete_node(node);
+                }
+
+                static const leaf* minimum_leaf(child_ptr child) noexcept {
+                    while(!is_leaf(child)) {
+                        const inner_node* node = as_node(child);
+                        if(node->terminal != nullptr) {
+                            return node->terminal;
+                        }
+                        visit_children(node, [&](child_ptr first) {
+                            child = first;
+                            return false;
+                        });
+                    }
+                    return as_leaf(child);
+                }
+
+                static child_ptr* find_child(inner_node* node, unsigned char byte) noexcept {
+                    switch(node->kind) {
+                        case node_kind::node4: {
+                            node4* small = static_cast<node4*>(node);
+                            for(std::uint16_t index = 0; index < small->count; ++index) {
+                                if(small->keys[index] == byte) {
+                                    return &small->children[index];
+                                }
+                            }
+                            return nullptr;
+                        }
+                        case node_kind::node16: {
+                            node16* medium = static_cast<node16*>(node);
+#if defined(__SSE2__)
+                            __m128i matches = _mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(byte)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(medium->keys)));
+                            unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(matches)) & ((1u << medium->count) - 1);
+                            return mask != 0 ? &medium->children[std::countr_zero(mask)] : nullptr;
+#else
+                            for(std::uint16_t index = 0; index < medium->count; ++index) {
+                                if(medium->keys[index] == byte) {
+                                    return &medium->children[index];
+                                }
+                            }
+                            return nullptr;
+#endif
+                        }
+                        case node_kind::node48: {
+                            node48* large = static_cast<node48*>(node);
+                            return large->child_index[byte] != 0 ? &large->children[large->child_index[byte] - 1] : nullptr;
+                        }
+                        case node_kind::node256: {
+                            node256* full = static_cast<node256*>(node);
+                            return full->children[byte] != 0 ? &full->children[byte] : nullptr;
+                        }
+                    }
+                    return nullptr;
+                }
+
+                static void copy_header(inner_node* target, const inner_node* source) noexcept {
+                    target->count = source->count;
+                    target->prefix_length = source->prefix_length;
+                    std::memcpy(target->prefix, source->prefix, stored_prefix_length);
+                    target->terminal = source->terminal;
+                }
+
+                template<class Small>
+                static void insert_sorted(Small* node, unsigned char byte, child_ptr child) noexcept {
+                    std::uint16_t position = 0;
+                    while(position < node->count && node->keys[position] < byte) {
+                        ++position;
+                    }
+                    for(std::uint16_t index = node->count; index > position; --index) {
+                        node->keys[index] = node->keys[index - 1];
+                        node->children[index] = node->children[index - 1];
+                    }
+                    node->keys[position] = byte;
+                    node->children[position] = child;
+                    ++node->count;
+                }
+
+                template<class Small>
+                static void remove_sorted(Small* node, unsigned char byte) noexcept {
+                    std::uint16_t position = 0;
+                    while(node->keys[position] != byte) {
+                        ++position;
+                    }
+                    for(std::uint16_t index = position + 1; index < node->count; ++index) {
+                        node->keys[index - 1] = node->keys[index];
+                        node->children[index - 1] = node->children[index];
+                    }
+                    --node->count;
+                }
+
+                // Adds a child under a byte that is not present yet, growing the node that ref
+                // points to when it is full.
+                static void add_child(child_ptr& ref, unsigned char byte, child_ptr child) {
+                    inner_node* node = as_node(ref);
+                    switch(node->kind) {
+                        case node_kind::node4: {
+                            node4* small = static_cast<node4*>(node);
+                            if(small->count < 4) {
+                                insert_sorted(small, byte, child);
+                                return;
+                            }
+                            node16* grown = new node16();
+                            copy_header(grown, small);
+                            std::memcpy(grown->keys, small->keys, sizeof(small->keys));
+                            std::memcpy(grown->children, small->children, sizeof(small->children));
+                            delete small;
+                            ref = tag(grown);
+                            insert_sorted(grown, byte, child);
+                            return;
+                        }
+                        case node_kind::node16: {
+                            node16* medium = static_cast<node16*>(node);
+                            if(medium->count < 16) {
+                                insert_sorted(medium, byte, child);
+                                return;
+                            }
+                            node48* grown = new node48();
+                            copy_header(grown, medium);
+                            for(std::uint16_t index = 0; index < 16; ++index) {
+                                grown->child_index[medium->keys[index]] = static_cast<unsigned char>(index + 1);
+                                grown->children[index] = medium->children[index];
+                            }
+                            delete medium;
+                            ref = tag(grown);
+                            grown->child_index[byte] = 17;
+                            grown->children[16] = child;
+                            ++grown->count;
+                            return;
+                        }
+                        case node_kind::node48: {
+                            node48* large = static_cast<node48*>(node);
+                            if(large->count < 48) {
+                                unsigned int slot = 0;
+                                while(large->children[slot] != 0) {
+                                    ++slot;
+                                }
+                                large->children[slot] = child;
+                                large->child_index[byte] = static_cast<unsigned char>(slot + 1);
+                                ++large->count;
+                                return;
+                            }
+                            node256* grown = new node256();
+                            copy_header(grown, large);
+                            for(unsigned int key = 0; key < 256; ++key) {
+                                if(large->child_index[key] != 0) {
+                                    grown->children[key] = large->children[large->child_index[key] - 1];
+                                }
+                            }
+                            delete large;
+                            ref = tag(grown);
+                            grown->children[byte] = child;
+                            ++grown->count;
+                            return;
+                        }
+                        case node_kind::node256: {
+                            node256* full = static_cast<node256*>(node);
+                            full->children[byte] = child;
+                            ++full->count;
+                            return;
+                        }
+                    }
+                }
+
+                // Replaces a node4 left with a single entry by that entry, folding the node's
+                // prefix and branch byte into the prefix of an inner child.
+                static void collapse(child_ptr& ref) noexcept {
+                    node4* node = static_cast<node4*>(as_node(ref));
+                    if(node->count == 0) {
+                        ref = tag(node->terminal);
+                        delete node;
+                        return;
+                    }
+                    child_ptr child = node->children[0];
+                    if(!is_leaf(child)) {
+                        inner_node* below = as_node(child);
+                        unsigned char merged[stored_prefix_length];
+                        std::uint32_t length = std::min(node->prefix_length, stored_prefix_length);
+                        std::memcpy(merged, node->prefix, length);
+                        if(length < stored_prefix_length) {
+                            merged[length++] = node->keys[0];
+                        }
+                        std::uint32_t below_length = std::min(below->prefix_length, stored_prefix_length - length);
+                        std::memcpy(merged + length, below->prefix, below_length);
+                        below->prefix_length += node->prefix_length + 1;
+                        std::memcpy(below->prefix, merged, std::min(below->prefix_length, stored_prefix_length));
+                    }
+                    ref = child;
+                    delete node;
+                }
+
+                // Shrinks the node ref points to once it has lost enough entries, with some slack
+                // below each growth threshold so alternating inserts and erases do not thrash.
+                static void shrink(child_ptr& ref) {
+                    inner_node* node = as_node(ref);
+                    switch(node->kind) {
+                        case node_kind::node4:
+                            if(node->count + (node->terminal != nullptr ? 1 : 0) == 1) {
+                                collapse(ref);
+                            }
+                            return;
+                        case node_kind::node16: {
+                            node16* medium = static_cast<node16*>(node);
+                            if(medium->count > 3) {
+                                return;
+                            }
+                            node4* shrunk = new node4();
+                            copy_header(shrunk, medium);
+                            std::memcpy(shrunk->keys, medium->keys, medium->count);
+                            std::memcpy(shrunk->children, medium->children, medium->count * sizeof(child_ptr));
+                            delete medium;
+                            ref = tag(shrunk);
+                            return;
+                        }
+                        case node_kind::node48: {
+                            node48* large = static_cast<node48*>(node);
+                            if(large->count > 12) {
+                                return;
+                            }
+                            node16* shrunk = new node16();
+                            copy_header(shrunk, large);
+                            std::uint16_t position = 0;
+                            for(unsigned int byte = 0; byte < 256; ++byte) {
+                                if(large->child_index[byte] != 0) {
+                                    shrunk->keys[position] = static_cast<unsigned char>(byte);
+                                    shrunk->children[position++] = large->children[large->child_index[byte] - 1];
+                                }
+                            }
+                            delete large;
+                            ref = tag(shrunk);
+                            return;
+                        }
+                        case node_kind::node256: {
+                            node256* full = static_cast<node256*>(node);
+                            if(full->count > 37) {
+                                return;
+                            }
+                            node48* shrunk = new node48();
+                            copy_header(shrunk, full);
+                            unsigned char slot = 0;
+                            for(unsigned int byte = 0; byte < 256; ++byte) {
+                                if(full->children[byte] != 0) {
+                                    shrunk->children[slot] = full->children[byte];
+                                    shrunk->child_index[byte] = ++slot;
+                                }
+                            }
+                            delete full;
+                            ref = tag(shrunk);
+                            return;
+                        }
+                    }
+                }
+
+                static void remove_child(child_ptr& ref, unsigned char byte) {
+                    inner_node* node = as_node(ref);
+                    switch(node->kind) {
+                        case node_kind::node4:
+                            remove_sorted(static_cast<node4*>(node), byte);
+                            break;
+                        case node_kind::node16:
+                            remove_sorted(static_cast<node16*>(node), byte);
+                            break;
+                        case node_kind::node48: {
+                            node48* large = static_cast<node48*>(node);
+                            large->children[large->child_index[byte] - 1] = 0;
+                            large->child_index[byte] = 0;
+                            --large->count;
+                            break;
+                        }
+                        case node_kind::node256: {
+                            node256* full = static_cast<node256*>(node);
+                            full->children[byte] = 0;
+                            --full->count;
+                            break;
+                        }
+                    }
+                    shrink(ref);
+                }
+
+                // Compares only the inline prefix bytes; callers verify the full key at the leaf.
+                static bool stored_prefix_matches(const inner_node* node, key_bytes key, std::size_t depth) noexcept {
+                    std::uint32_t stored = std::min(node->prefix_length, stored_prefix_length);
+                    if(depth + stored > key.size()) {
+                        return false;
+                    }
+                    return std::memcmp(node->prefix, key.data() + depth, stored) == 0;
+                }
+
+                // Returns how many prefix bytes the key matches, reading the bytes past the inline
+                // ones from a leaf below. The result is short of prefix_length on a mismatch or when
+                // the key ends inside the prefix.
+                static std::uint32_t prefix_mismatch(const inner_node* node, key_bytes key, std::size_t depth) noexcept {
+                    std::uint32_t limit = static_cast<std::uint32_t>(std::min<std::size_t>(node->prefix_length, key.size() - depth));
+                    std::uint32_t stored = std::min(limit, stored_prefix_length);
+                    std::uint32_t index = 0;
+                    for(; index < stored; ++index) {
+                        if(node->prefix[index] != key[depth + index]) {
+                            return index;
+                        }
+                    }
+                    if(index < limit) {
+                        auto encoded = traits_type::encode(minimum_leaf(tag(const_cast<inner_node*>(node)))->key);
+                        key_bytes full = view_of(encoded);
+                        for(; index < limit; ++index) {
+                            if(full[depth + index] != key[depth + index]) {
+                                return index;
+                            }
+                        }
+                    }
+                    return index;
+                }
+
+                static void attach(child_ptr& ref, key_bytes key, std::size_t depth, leaf* value) {
+                    if(depth == key.size()) {
+                        as_node(ref)->terminal = value;
+                    }
+                    else {
+                        add_child(ref, key[depth], tag(value));
+                    }
+                }
+
+                leaf* find_leaf(key_bytes key) const noexcept {
+                    child_ptr child = root_;
+                    std::size_t depth = 0;
+                    while(child != 0) {
+                        if(is_leaf(child)) {
+                            leaf* candidate = as_leaf(child);
+                            return leaf_matches(candidate, key) ? candidate : nullptr;
+                        }
+                        inner_node* node = as_node(child);
+                        if(!stored_prefix_matches(node, key, depth)) {
+                            return nullptr;
+                        }
+                        depth += node->prefix_length;
+                        if(depth >= key.size()) {
+                            leaf* candidate = depth == key.size() ? node->terminal : nullptr;
+                            return candidate != nullptr && leaf_matches(candidate, key) ? candidate : nullptr;
+                        }
+                        child_ptr* next = find_child(node, key[depth]);
+                        child = next != nullptr ? *next : 0;
+                        ++depth;
+                    }
+                    return nullptr;
+                }
+
+                template<class MakeLeaf>
+                std::pair<leaf*, bool> insert_at(child_ptr& ref, key_bytes key, std::size_t depth, MakeLeaf& make_leaf) {
+                    if(ref == 0) {
+                        leaf* created = make_leaf();
+                        ref = tag(created);
+                        return {created, true};
+                    }
+                    if(is_leaf(ref)) {
+                        leaf* existing = as_leaf(ref);
+                        auto encoded = traits_type::encode(existing->key);
+                        key_bytes existing_key = view_of(encoded);
+                        std::size_t common = depth;
+                        std::size_t limit = std::min(existing_key.size(), key.size());
+                        while(common < limit && existing_key[common] == key[common]) {
+                            ++common;
+                        }
+                        if(common == existing_key.size() && common == key.size()) {
+                            return {existing, false};
+                        }
+                        leaf* created = make_leaf();
+                        node4* split = new node4();
+                        split->prefix_length = static_cast<std::uint32_t>(common - depth);
+                        std::memcpy(split->prefix, key.data() + depth, std::min(split->prefix_length, stored_prefix_length));
+                        child_ptr split_ref = tag(split);
+                        attach(split_ref, existing_key, common, existing);
+                        attach(split_ref, key, common, created);
+                        ref = split_ref;
+                        return {created, true};
+                    }
+
+                    inner_node* node = as_node(ref);
+                    if(node->prefix_length != 0) {
+                        std::uint32_t matched = prefix_mismatch(node, key, depth);
+                        if(matched < node->prefix_length) {
+                            leaf* created = make_leaf();
+                            node4* split = new node4();
+                            split->prefix_length = matched;
+                            std::memcpy(split->prefix, key.data() + depth, std::min(matched, stored_prefix_length));
+                            unsigned char branch;
+                            std::uint32_t remaining = node->prefix_length - matched - 1;
+                            if(node->prefix_length <= stored_prefix_length) {
+                                branch = node->prefix[matched];
+                                std::memmove(node->prefix, node->prefix + matched + 1, remaining);
+                            }
+                            else {
+                                auto encoded = traits_type::encode(minimum_leaf(ref)->key);
+                                key_bytes full = view_of(encoded);
+                                branch = full[depth + matched];
+                                std::memcpy(node->prefix, full.data() + depth + matched + 1, std::min(remaining, stored_prefix_length));
+                            }
+                            node->prefix_length = remaining;
+                            child_ptr split_ref = tag(split);
+                            add_child(split_ref, branch, ref);
+                            attach(split_ref, key, depth + matched, created);
+                            ref = split_ref;
+                            return {created, true};
+                        }
+                        depth += node->prefix_length;
+                    }
+
+                    if(depth == key.size()) {
+                        if(node->terminal != nullptr) {
+                            return {node->terminal, false};
+                        }
+                        node->terminal = make_leaf();
+                        return {node->terminal, true};
+                    }
+                    child_ptr* next = find_child(node, key[depth]);
+                    if(next != nullptr) {
+                        return insert_at(*next, key, depth + 1, make_leaf);
+                    }
+                    leaf* created = make_leaf();
+                    add_child(ref, key[depth], tag(created));
+                    return {created, true};
+                }
+
+                bool erase_at(child_ptr& ref, key_bytes key, std::size_t depth) {
+                    if(ref == 0) {
+                        return false;
+                    }
+                    if(is_leaf(ref)) {
+                        if(!leaf_matches(as_leaf(ref), key)) {
+                            return false;
+                        }
+                        delete as_leaf(ref);
+                        ref = 0;
+                        return true;
+                    }
+                    inner_node* node = as_node(ref);
+                    if(!stored_prefix_matches(node, key, depth)) {
+                        return false;
+                    }
+                    depth += node->prefix_length;
+                    if(depth > key.size()) {
+                        return false;
+                    }
+                    if(depth == key.size()) {
+                        if(node->terminal == nullptr || !leaf_matches(node->terminal, key)) {
+                            return false;
+                        }
+                        delete node->terminal;
+                        node->terminal = nullptr;
+                        shrink(ref);
+                        return true;
+                    }
+                    child_ptr* next = find_child(node, key[depth]);
+                    if(next == nullptr) {
+                        return false;
+                    }
+                    if(is_leaf(*next)) {
+                        if(!leaf_matches(as_leaf(*next), key)) {
+                            return false;
+                        }
+                        delete as_leaf(*next);
+                        remove_child(ref, key[depth]);
+                        return true;
+                    }
+                    return erase_at(*next, key, depth + 1);
+                }
+
+                template<class Function>
+                static bool call(Function& function, leaf* value) {
+                    if constexpr(std::is_same_v<std::invoke_result_t<Function&, const Key&, Value&>, bool>) {
+                        return function(static_cast<const Key&>(value->key), value->value);
+                    }
+                    else {
+                        function(static_cast<const Key&>(value->key), value->value);
+                        return true;
+                    }
+                }
+
+                template<class Function>
+                static bool visit(child_ptr child, Function& function) {
+                    if(is_leaf(child)) {
+                        return call(function, as_leaf(child));
+                    }
+                    const inner_node* node = as_node(child);
+                    if(node->terminal != nullptr && !call(function, node->terminal)) {
+                        return false;
+                    }
+                    return visit_children(node, [&](child_ptr next) {
+                        return visit(next, function);
+                    });
+                }
+
+                template<class Function>
+                void visit_prefix(key_bytes prefix, Function& function) const {
+                    child_ptr child = root_;
+                    std::size_t depth = 0;
+                    while(child != 0) {
+                        if(is_leaf(child)) {
+                            auto encoded = traits_type::encode(as_leaf(child)->key);
+                            key_bytes bytes = view_of(encoded);
+                            if(bytes.size() >= prefix.size() && std::equal(prefix.begin(), prefix.end(), bytes.begin())) {
+                                call(function, as_leaf(child));
+                            }
+                            return;
+                        }
+                        inner_node* node = as_node(child);
+                        if(prefix_mismatch(node, prefix, depth) < std::min<std::size_t>(node->prefix_length, prefix.size() - depth)) {
+                            return;
+                        }
+                        depth += node->prefix_length;
+                        if(depth >= prefix.size()) {
+                            visit(child, function);
+                            return;
+                        }
+                        child_ptr* next = find_child(node, prefix[depth]);
+                        child = next != nullptr ? *next : 0;
+                        ++depth;
+                    }
+                }
+
+                template<class Function>
+                static auto as_const_visitor(Function& function) {
+                    return [&function](const Key& key, Value& value) {
+                        return function(key, static_cast<const Value&>(value));
+                    };
+                }
+
+            public:
+                adaptive_radix_tree() = default;
+
+                adaptive_radix_tree(const adaptive_radix_tree& other) {
+                    other.for_each([this](const Key& key, const Value& value) {
+                        try_emplace(key, value);
+                    });
+                }
+
+                adaptive_radix_tree(adaptive_radix_tree&& other) noexcept : root_(other.root_), size_(other.size_) {
+                    other.root_ = 0;
+                    other.size_ = 0;
+                }
+
+                adaptive_radix_tree& operator=(const adaptive_radix_tree& other) {
+                    if(this != &other) {
+                        adaptive_radix_tree copy(other);
+                        swap(copy);
+                    }
+                    return *this;
+                }
+
+                adaptive_radix_tree& operator=(adaptive_radix_tree&& other) noexcept {
+                    if(this != &other) {
+                        clear();
+                        swap(other);
+                    }
+                    return *this;
+                }
+
+                ~adaptive_radix_tree() {
+                    destroy(root_);
+                }
+
+                void swap(adaptive_radix_tree& other) noexcept {
+                    std::swap(root_, other.root_);
+                    std::swap(size_, other.size_);
+                }
+
+                template<class... Args>
+                bool try_emplace(lookup_type key, Args&&... args) {
+                    auto encoded = traits_type::encode(key);
+                    auto make_leaf = [&]() {
+                        return new leaf{Key(key), Value(std::forward<Args>(args)...)};
+                    };
+                    bool inserted = insert_at(root_, view_of(encoded), 0, make_leaf).second;
+                    size_ += inserted ? 1 : 0;
+                    return inserted;
+                }
+
+                bool insert(lookup_type key, const Value& value) {
+                    return try_emplace(key, value);
+                }
+
+                bool insert(lookup_type key, Value&& value) {
+                    return try_emplace(key, std::move(value));
+                }
+
+                template<class V>
+                bool insert_or_assign(lookup_type key, V&& value) {
+                    auto encoded = traits_type::encode(key);
+                    auto make_leaf = [&]() {
+                        return new leaf{Key(key), Value(std::forward<V>(value))};
+                    };
+                    auto [target, inserted] = insert_at(root_, view_of(encoded), 0, make_leaf);
+                    if(inserted) {
+                        ++size_;
+                    }
+                    else {
+                        target->value = std::forward<V>(value);
+                    }
+                    return inserted;
+                }
+
+                Value& operator[](lookup_type key) {
+                    auto encoded = traits_type::encode(key);
+                    auto make_leaf = [&]() {
+                        return new leaf{Key(key), Value()};
+                    };
+                    auto [target, inserted] = insert_at(root_, view_of(encoded), 0, make_leaf);
+                    size_ += inserted ? 1 : 0;
+                    return target->value;
+                }
+
+                Value* find(lookup_type key) noexcept {
+                    auto encoded = traits_type::encode(key);
+                    leaf* found = find_leaf(view_of(encoded));
+                    return found != nullptr ? &found->value : nullptr;
+                }
+
+                const Value* find(lookup_type key) const noexcept {
+                    auto encoded = traits_type::encode(key);
+                    const leaf* found = find_leaf(view_of(encoded));
+                    return found != nullptr ? &found->value : nullptr;
+                }
+
+                bool contains(lookup_type key) const noexcept {
+                    return find(key) != nullptr;
+                }
+
+                Value& at(lookup_type key) {
+                    Value* found = find(key);
+                    if(found == nullptr) {
+                        throw std::out_of_range("Key is not present in the radix tree.");
+                    }
+                    return *found;
+                }
+
+                const Value& at(lookup_type key) const {
+                    const Value* found = find(key);
+                    if(found == nullptr) {
+                        throw std::out_of_range("Key is not present in the radix tree.");
+                    }
+                    return *found;
+                }
+
+                bool erase(lookup_type key) {
+                    auto encoded = traits_type::encode(key);
+                    bool erased = erase_at(root_, view_of(encoded), 0);
+                    size_ -= erased ? 1 : 0;
+                    return erased;
+                }
+
+                void clear() noexcept {
+                    destroy(root_);
+                    root_ = 0;
+                    size_ = 0;
+                }
+
+                size_type size() const noexcept {
+                    return size_;
+                }
+
+                [[nodiscard]] bool empty() const noexcept {
+                    return size_ == 0;
+                }
+
+                // Visits entries in ascending key order. A function returning bool stops the
+                // walk by returning false.
+                template<class Function>
+                void for_each(Function&& function) {
+                    if(root_ != 0) {
+                        visit(root_, function);
+                    }
+                }
+
+                template<class Function>
+                void for_each(Function&& function) const {
+                    auto visitor = as_const_visitor(function);
+                    if(root_ != 0) {
+                        visit(root_, visitor);
+                    }
+                }
+
+                // Visits, in ascending order, every entry whose key starts with the given bytes.
+                template<class Function>
+                void for_each_prefix(std::string_view prefix, Function&& function) requires std::same_as<Key, std::string> {
+                    visit_prefix(view_of(prefix), function);
+                }
+
+                template<class Function>
+                void for_each_prefix(std::string_view prefix, Function&& function) const requires std::same_as<Key, std::string> {
+                    auto visitor = as_const_visitor(function);
+                    visit_prefix(view_of(prefix), visitor);
+                }
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,221 @@
+#ifndef DATA_STRUCTURES_MAP_HASH_INDEX_HPP
+#define DATA_STRUCTURES_MAP_HASH_INDEX_HPP
+
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include "data_structures/src/linear/dynamic_array.hpp"
+
+namespace data_structures {
+    namespace map {
+
+        // Open addressing index from keys to 32 bit slot numbers in a container owned by the
+        // caller, which passes a key_at(slot) callback wherever keys must be compared. Each
+        // bucket is one word holding the slot and the top 32 bits of the hash; the home bucket
+        // comes from the top bits as well, so growing never needs the keys, and most probe
+        // mismatches are rejected on the stored hash bits without touching the container.
+        // Linear probing with backward shift deletion keeps probe sequences short without
+        // tombstones.
+        template<class Key, class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>>
+        class hash_index {
+            public:
+                using key_type = Key;
+                using size_type = unsigned long;
+                using slot_type = std::uint32_t;
+                using hasher = Hash;
+                using key_equal = KeyEqual;
+
+                static constexpr slot_type npos = std::numeric_limits<slot_type>::max();
+
+            private:
+                using bucket_type = std::uint64_t;
+
+                static constexpr size_type min_bucket_count = 8;
+                // Home buckets come from the 32 stored hash bits, so the table cannot address
+                // more buckets than that.
+                static constexpr size_type max_bucket_count = size_type(1) << 32;
+
+                linear::dynamic_array<bucket_type, std::allocator<bucket_type>, linear::no_instrumentation, linear::unchecked> buckets_;
+                size_type size_ = 0;
+                unsigned int bucket_bits_ = 0;
+                Hash hash_;
+                KeyEqual equal_;
+
+                static bucket_type make_bucket(std::uint64_t hash, slot_type slot) noexcept {
+                    return (hash & 0xFFFFFFFF00000000ULL) | (bucket_type(slot) + 1);
+                }
+
+                static slot_type slot_of(bucket_type bucket) noexcept {
+                    return static_cast<slot_type>(bucket) - 1;
+                }
+
+                static bool same_tag(bucket_type bucket, std::uint64_t hash) noexcept {
+                    return ((bucket ^ hash) >> 32) == 0;
+                }
+
+                size_type home_of(bucket_type bucket) const noexcept {
+                    return static_cast<size_type>((bucket >> 32) >> (32 - bucket_bits_));
+                }
+
+                size_type mask() const noexcept {
+                    return buckets_.size() - 1;
+                }
+
+                void place(bucket_type bucket) noexcept {
+                    size_type position = home_of(bucket);
+                    while(buckets_[position] != 0) {
+                        position = (position + 1) & mask();
+                    }
+                    buckets_[position] = bucket;
+                }
+
+                void rehash(size_type bucket_count) {
+                    if(bucket_count > max_bucket_count) {
+                        throw std::length_error("Hash index cannot grow past " + std::to_string(max_bucket_count) + " buckets.");
+                    }
+                    decltype(buckets_) old_buckets;
+                    old_buckets.swap(buckets_);
+                    buckets_.resize(bucket_count, 0);
+                    bucket_bits_ = static_cast<unsigned int>(std::countr_zero(bucket_count));
+                    for(size_type index = 0; index < old_buckets.size(); ++index) {
+                        if(old_buckets[index] != 0) {
+                            place(old_buckets[index]);
+                        }
+                    }
+                }
+
+                template<class KeyAt>
+                size_type find_position(const Key& key, std::uint64_t hash, KeyAt& key_at) const {
+                    if(size_ == 0) {
+                        return buckets_.size();
+                    }
+                    size_type position = static_cast<size_type>(hash >> (64 - bucket_bits_));
+                    while(buckets_[position] != 0) {
+                        if(same_tag(buckets_[position], hash) && equal_(key_at(slot_of(buckets_[position])), key)) {
+                            return position;
+                        }
+                        position = (position + 1) & mask();
+                    }
+                    return buckets_.size();
+                }
+
+                void erase_position(size_type hole) noexcept {
+                    size_type position = hole;
+                    while(true) {
+                        position = (position + 1) & mask();
+                        if(buckets_[position] == 0) {
+                            break;
+                        }
+                        size_type home = home_of(buckets_[position]);
+                        bool movable = position > hole ? (home <= hole || home > position) : (home <= hole && home > position);
+                        if(movable) {
+                            buckets_[hole] = buckets_[position];
+                            hole = position;
+                        }
+                    }
+                    buckets_[hole] = 0;
+                    --size_;
+                }
+
+            public:
+                explicit hash_index(const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual()) : hash_(hash), equal_(equal) {}
+
+                // Fibonacci hashing spreads the identity std::hash of integers into the top bits.
+                std::uint64_t hash(const Key& key) const {
+                    return static_cast<std::uint64_t>(hash_(key)) * 0x9E3779B97F4A7C15ULL;
+                }
+
+                template<class KeyAt>
+                slot_type find(const Key& key, std::uint64_t hash, KeyAt&& key_at) const {
+                    size_type position = find_position(key, hash, key_at);
+                    return position == buckets_.size() ? npos : slot_of(buckets_[position]);
+                }
+
+                template<class KeyAt>
+                slot_type find(const Key& key, KeyAt&& key_at) const {
+                    return find(key, hash(key), key_at);
+                }
+
+                // The caller guarantees the key is not already indexed.
+                void insert(std::uint64_t hash, slot_type slot) {
+                    if(slot == npos) {
+                        throw std::length_error("Slot numbers must be below 2^32 - 1.");
+                    }
+                    if((size_ + 1) * 8 > buckets_.size() * 7) {
+                        rehash(buckets_.size() == 0 ? min_bucket_count : buckets_.size() * 2);
+                    }
+                    place(make_bucket(hash, slot));
+                    ++size_;
+                }
+
+                template<class KeyAt>
+                slot_type erase(const Key& key, std::uint64_t hash, KeyAt&& key_at) {
+                    size_type position = find_position(key, hash, key_at);
+                    if(position == buckets_.size()) {
+                        return npos;
+                    }
+                    slot_type slot = slot_of(buckets_[position]);
+                    erase_position(position);
+                    return slot;
+                }
+
+                template<class KeyAt>
+                slot_type erase(const Key& key, KeyAt&& key_at) {
+                    return erase(key, hash(key), key_at);
+                }
+
+                // Points the entry for a key at a new slot after the owner moved it.
+                void relocate(std::uint64_t hash, slot_type from, slot_type to) noexcept {
+                    if(size_ == 0) {
+                        return;
+                    }
+                    bucket_type old_bucket = make_bucket(hash, from);
+                    size_type position = static_cast<size_type>(hash >> (64 - bucket_bits_));
+                    while(buckets_[position] != 0) {
+                        if(buckets_[position] == old_bucket) {
+                            buckets_[position] = make_bucket(hash, to);
+                            return;
+                        }
+                        position = (position + 1) & mask();
+                    }
+                }
+
+                void reserve(size_type count) {
+                    if(count > max_bucket_count / 8 * 7) {
+                        throw std::length_error("Cannot reserve " + std::to_string(count) + " entries in a hash index.");
+                    }
+                    size_type bucket_count = std::bit_ceil(count * 8 / 7 + 1);
+                    bucket_count = bucket_count < min_bucket_count ? min_bucket_count : bucket_count;
+                    if(bucket_count > buckets_.size()) {
+                        rehash(bucket_count);
+                    }
+                }
+
+                void clear() {
+                    for(size_type index = 0; index < buckets_.size(); ++index) {
+                        buckets_[index] = 0;
+                    }
+                    size_ = 0;
+                }
+
+                size_type size() const noexcept {
+                    return size_;
+                }
+
+                [[nodiscard]] bool empty() const noexcept {
+                    return size_ == 0;
+                }
+
+                size_type bucket_count() const noexcept {
+                    return buckets_.size();
+                }
+        };
+    }
+}
+
+#endif
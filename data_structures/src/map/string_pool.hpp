@@ -0,0 +1,235 @@
+#ifndef DATA_STRUCTURES_MAP_STRING_POOL_HPP
+#define DATA_STRUCTURES_MAP_STRING_POOL_HPP
+
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "data_structures/src/linear/string_array.hpp"
+#include "data_structures/src/map/hash_index.hpp"
+
+namespace data_structures {
+    namespace map {
+
+        // Interns strings as dense 32 bit ids in first-seen order. Characters are kept in a
+        // string_array and looked up through a hash_index over the ids, so each distinct string
+        // costs its characters, one offset and one index word. Views returned by the pool point
+        // into the character buffer and, like vector references, are invalidated by the next
+        // intern of a new string or by clear; the ids themselves never change.
+        template<std::unsigned_integral Offset = std::uint32_t>
+        class string_pool {
+            public:
+                using id_type = std::uint32_t;
+                using size_type = unsigned long;
+
+                static constexpr id_type npos = std::numeric_limits<id_type>::max();
+
+            private:
+                linear::string_array<Offset> strings_;
+                hash_index<std::string_view> index_;
+
+                auto key_at() const {
+                    return [this](id_type id) { return strings_[id]; };
+                }
+
+                void check_id(id_type id) const {
+                    if(id >= strings_.size()) {
+                        throw std::out_of_range("Id " + std::to_string(id) + " was not issued by this string pool.");
+                    }
+                }
+
+            public:
+                string_pool() = default;
+
+                void reserve(size_type strings, size_type chars) {
+                    strings_.reserve(strings, chars);
+                    index_.reserve(strings);
+                }
+
+                std::uint64_t hash(std::string_view value) const {
+                    return index_.hash(value);
+                }
+
+                // Takes the result of hash(value) so callers that already hashed the string, such
+                // as the sharded pool, do not hash it again.
+                id_type intern(std::string_view value, std::uint64_t hash) {
+                    id_type id = index_.find(value, hash, key_at());
+                    if(id != npos) {
+                        return id;
+                    }
+                    if(strings_.size() >= npos) {
+                        throw std::length_error("A string pool holds at most 2^32 - 1 strings.");
+                    }
+                    id = static_cast<id_type>(strings_.size());
+                    strings_.push_back(value);
+                    index_.insert(hash, id);
+                    return id;
+                }
+
+                id_type intern(std::string_view value) {
+                    return intern(value, hash(value));
+                }
+
+                // Returns npos for strings that were never interned.
+                id_type find(std::string_view value, std::uint64_t hash) const {
+                    return index_.find(value, hash, key_at());
+                }
+
+                id_type find(std::string_view value) const {
+                    return find(value, hash(value));
+                }
+
+                bool contains(std::string_view value) const {
+                    return find(value) != npos;
+                }
+
+                std::string_view operator[](id_type id) const noexcept {
+                    return strings_[id];
+                }
+
+                std::string_view at(id_type id) const {
+                    check_id(id);
+                    return strings_[id];
+                }
+
+                size_type size() const noexcept {
+                    return strings_.size();
+                }
+
+                [[nodiscard]] bool empty() const noexcept {
+                    return strings_.empty();
+                }
+
+                size_type char_count() const noexcept {
+                    return strings_.char_count();
+                }
+
+                const linear::string_array<Offset>& strings() const noexcept {
+                    return strings_;
+                }
+
+                void clear() {
+                    strings_.clear();
+                    index_.clear();
+                }
+        };
+
+        // A string_pool split into ShardCount independently locked shards chosen by hash bits
+        // the shard's own index does not use. Interning a string that is already present only
+        // takes its shard's shared lock. Ids carry the shard in their low bits, so they stay
+        // unique across shards but are not dense. Strings are returned by value because another
+        // thread may grow the shard's buffer as soon as the lock is released.
+        template<unsigned int ShardCount = 16, std::unsigned_integral Offset = std::uint32_t>
+        class sharded_string_pool {
+            static_assert(std::has_single_bit(ShardCount) && ShardCount <= 256, "The shard count must be a power of two no larger than 256.");
+
+            public:
+                using id_type = std::uint32_t;
+                using size_type = unsigned long;
+
+                static constexpr id_type npos = std::numeric_limits<id_type>::max();
+                static constexpr unsigned int shard_count = ShardCount;
+
+            private:
+                static constexpr unsigned int shard_bits = std::countr_zero(ShardCount);
+
+                struct alignas(64) shard {
+                    mutable std::shared_mutex mutex;
+                    string_pool<Offset> pool;
+                };
+
+                std::array<shard, ShardCount> shards_;
+
+                static unsigned int shard_of(std::uint64_t hash) noexcept {
+                    return static_cast<unsigned int>(hash >> 16) & (ShardCount - 1);
+                }
+
+                static id_type make_id(id_type local, unsigned int shard) noexcept {
+                    return (local << shard_bits) | shard;
+                }
+
+                const shard& owner_of(id_type id) const noexcept {
+                    return shards_[id & (ShardCount - 1)];
+                }
+
+            public:
+                sharded_string_pool() = default;
+
+                id_type intern(std::string_view value) {
+                    std::uint64_t hash = shards_[0].pool.hash(value);
+                    unsigned int index = shard_of(hash);
+                    shard& owner = shards_[index];
+                    {
+                        std::shared_lock lock(owner.mutex);
+                        id_type local = owner.pool.find(value, hash);
+                        if(local != npos) {
+                            return make_id(local, index);
+                        }
+                    }
+                    std::unique_lock lock(owner.mutex);
+                    if(owner.pool.size() >= (npos >> shard_bits)) {
+                        id_type local = owner.pool.find(value, hash);
+                        if(local != npos) {
+                            return make_id(local, index);
+                        }
+                        throw std::length_error("String pool shard " + std::to_string(index) + " is out of ids.");
+                    }
+                    return make_id(owner.pool.intern(value, hash), index);
+                }
+
+                id_type find(std::string_view value) const {
+                    std::uint64_t hash = shards_[0].pool.hash(value);
+                    unsigned int index = shard_of(hash);
+                    const shard& owner = shards_[index];
+                    std::shared_lock lock(owner.mutex);
+                    id_type local = owner.pool.find(value, hash);
+                    return local == npos ? npos : make_id(local, index);
+                }
+
+                bool contains(std::string_view value) const {
+                    return find(value) != npos;
+                }
+
+                std::string at(id_type id) const {
+                    const shard& owner = owner_of(id);
+                    std::shared_lock lock(owner.mutex);
+                    return std::string(owner.pool.at(id >> shard_bits));
+                }
+
+                // Calls function(view) with the shard locked, which avoids the copy made by at.
+                // The function must not intern into this pool.
+                template<class Function>
+                decltype(auto) visit(id_type id, Function&& function) const {
+                    const shard& owner = owner_of(id);
+                    std::shared_lock lock(owner.mutex);
+                    return function(owner.pool.at(id >> shard_bits));
+                }
+
+                size_type size() const {
+                    size_type total = 0;
+                    for(const shard& current : shards_) {
+                        std::shared_lock lock(current.mutex);
+                        total += current.pool.size();
+                    }
+                    return total;
+                }
+
+                void clear() {
+                    for(shard& current : shards_) {
+                        std::unique_lock lock(current.mutex);
+                        current.pool.clear();
+                    }
+                }
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,170 @@
+#ifndef DATA_STRUCTURES_MEMORY_HUGE_PAGE_ALLOCATOR_HPP
+#define DATA_STRUCTURES_MEMORY_HUGE_PAGE_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <linux/mempolicy.h>
+#include <new>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <type_traits>
+#include <unistd.h>
+
+namespace data_structures {
+    namespace memory {
+
+        inline constexpr std::size_t huge_page_size = std::size_t(2) << 20;
+
+        enum class huge_page_mode {
+            NONE,
+            TRANSPARENT,
+            EXPLICIT,
+        };
+
+        enum class numa_policy {
+            LOCAL,
+            BIND,
+            INTERLEAVE,
+        };
+
+        // Buffers smaller than mmap_threshold come from the global heap; everything larger is
+        // mapped directly so it can be aligned to huge page boundaries and placed on NUMA nodes.
+        // EXPLICIT mode uses the preallocated hugetlbfs pool and falls back to TRANSPARENT when
+        // the pool is exhausted. NUMA placement is advisory: hosts without NUMA support, or
+        // sandboxes that reject mbind, keep the kernel's default first touch placement.
+        struct huge_page_options {
+            huge_page_mode mode = huge_page_mode::TRANSPARENT;
+            numa_policy policy = numa_policy::LOCAL;
+            std::uint64_t node_mask = 0;
+            std::size_t mmap_threshold = huge_page_size;
+
+            bool operator==(const huge_page_options& other) const = default;
+        };
+
+        namespace detail {
+            inline std::size_t round_to_huge_pages(std::size_t bytes) {
+                return (bytes + huge_page_size - 1) & ~(huge_page_size - 1);
+            }
+
+            inline void apply_numa_policy(void* region, std::size_t bytes, const huge_page_options& options) {
+                if(options.policy == numa_policy::LOCAL || options.node_mask == 0) {
+                    return;
+                }
+                int mode = options.policy == numa_policy::BIND ? MPOL_BIND : MPOL_INTERLEAVE;
+                unsigned long node_mask = static_cast<unsigned long>(options.node_mask);
+                ::syscall(SYS_mbind, region, bytes, mode, &node_mask, std::numeric_limits<std::uint64_t>::digits + 1, 0);
+            }
+
+            inline void* map_aligned_region(std::size_t bytes) {
+                std::size_t padded_bytes = bytes + huge_page_size;
+                void* mapping = ::mmap(nullptr, padded_bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                if(mapping == MAP_FAILED) {
+                    return nullptr;
+                }
+                std::uintptr_t mapping_start = reinterpret_cast<std::uintptr_t>(mapping);
+                std::uintptr_t aligned_start = (mapping_start + huge_page_size - 1) & ~(huge_page_size - 1);
+                std::size_t head_bytes = aligned_start - mapping_start;
+                std::size_t tail_bytes = padded_bytes - head_bytes - bytes;
+                if(head_bytes > 0) {
+                    ::munmap(mapping, head_bytes);
+                }
+                if(tail_bytes > 0) {
+                    ::munmap(reinterpret_cast<void*>(aligned_start + bytes), tail_bytes);
+                }
+                return reinterpret_cast<void*>(aligned_start);
+            }
+
+            inline void* map_huge_region(std::size_t bytes, const huge_page_options& options) {
+                void* region = nullptr;
+                if(options.mode == huge_page_mode::EXPLICIT) {
+                    region = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+                    if(region == MAP_FAILED) {
+                        region = nullptr;
+                    }
+                }
+                if(region == nullptr) {
+                    region = options.mode == huge_page_mode::NONE ?
+                        ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0) :
+                        map_aligned_region(bytes);
+                    if(region == MAP_FAILED || region == nullptr) {
+                        throw std::bad_alloc();
+                    }
+                    if(options.mode != huge_page_mode::NONE) {
+                        ::madvise(region, bytes, MADV_HUGEPAGE);
+                    }
+                }
+                apply_numa_policy(region, bytes, options);
+                return region;
+            }
+        }
+
+        template<class T>
+        class huge_page_allocator {
+            public:
+                using value_type = T;
+                using pointer = value_type*;
+                using size_type = std::size_t;
+                using difference_type = std::ptrdiff_t;
+                using propagate_on_container_move_assignment = std::true_type;
+                using propagate_on_container_swap = std::true_type;
+                using is_always_equal = std::false_type;
+
+                template<class U>
+                struct rebind {
+                    using other = huge_page_allocator<U>;
+                };
+
+            private:
+                huge_page_options options_;
+
+                std::size_t mapped_size(size_type n) const {
+                    return detail::round_to_huge_pages(n * sizeof(T));
+                }
+
+                bool uses_mapping(size_type n) const {
+                    return n * sizeof(T) >= options_.mmap_threshold;
+                }
+
+            public:
+                huge_page_allocator() noexcept = default;
+
+                explicit huge_page_allocator(const huge_page_options& options) noexcept : options_(options) {}
+
+                template<class U>
+                huge_page_allocator(const huge_page_allocator<U>& other) noexcept : options_(other.options()) {}
+
+                [[nodiscard]] pointer allocate(size_type n) {
+                    if(n > std::numeric_limits<size_type>::max() / sizeof(T)) {
+                        throw std::bad_array_new_length();
+                    }
+                    if(!uses_mapping(n)) {
+                        return static_cast<pointer>(::operator new(n * sizeof(T), std::align_val_t(alignof(T))));
+                    }
+                    return static_cast<pointer>(detail::map_huge_region(mapped_size(n), options_));
+                }
+
+                void deallocate(pointer p, size_type n) noexcept {
+                    if(p == nullptr) {
+                        return;
+                    }
+                    if(!uses_mapping(n)) {
+                        ::operator delete(p, std::align_val_t(alignof(T)));
+                        return;
+                    }
+                    ::munmap(p, mapped_size(n));
+                }
+
+                const huge_page_options& options() const noexcept {
+                    return options_;
+                }
+
+                template<class U>
+                bool operator==(const huge_page_allocator<U>& other) const noexcept {
+                    return options_ == other.options();
+                }
+        };
+    }
+}
+
+#endif
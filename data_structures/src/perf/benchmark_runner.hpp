@@ -0,0 +1,125 @@
+#ifndef DATA_STRUCTURES_PERF_BENCHMARK_RUNNER_HPP
+#define DATA_STRUCTURES_PERF_BENCHMARK_RUNNER_HPP
+
+#include <cstdint>
+#include <cstdio>
+#include <ostream>
+#include <string>
+#include <utility>
+
+#include "data_structures/src/linear/dynamic_array.hpp"
+#include "data_structures/src/perf/perf_counters.hpp"
+
+namespace data_structures {
+    namespace perf {
+
+        // Keeps the compiler from discarding a computation whose result a benchmark never uses.
+        template<class T>
+        inline void do_not_optimize(const T& value) {
+            asm volatile("" : : "r,m"(value) : "memory");
+        }
+
+        struct benchmark_options {
+            unsigned int repetitions = 5;
+            std::string filter;
+        };
+
+        struct benchmark_result {
+            std::string name;
+            unsigned long operations;
+            counter_values totals;
+
+            // Nanoseconds or counter events per operation.
+            double nanoseconds_per_operation() const noexcept {
+                return operations == 0 ? 0.0 : static_cast<double>(totals.nanoseconds) / static_cast<double>(operations);
+            }
+
+            double per_operation(counter which) const noexcept {
+                return operations == 0 ? 0.0 : static_cast<double>(totals[which]) / static_cast<double>(operations);
+            }
+        };
+
+        // Runs named benchmarks under one set of perf_counters and reports counter deltas per
+        // operation. A benchmark is a callable performing a stated number of operations; it is
+        // called once unmeasured to warm caches and the allocator, then repetitions more times,
+        // and the fastest repetition is kept since noise only ever adds time. Setup that should
+        // not be counted belongs outside the callable, or in a fresh container the callable
+        // builds from a copy.
+        class benchmark_runner {
+            private:
+                benchmark_options options_;
+                perf_counters counters_;
+                linear::dynamic_array<benchmark_result, std::allocator<benchmark_result>, linear::no_instrumentation, linear::unchecked> results_;
+
+            public:
+                explicit benchmark_runner(benchmark_options options = benchmark_options()) : options_(std::move(options)) {}
+
+                const perf_counters& counters() const noexcept {
+                    return counters_;
+                }
+
+                // Returns false, without running anything, when name does not contain the filter.
+                template<class Body>
+                bool run(const std::string& name, unsigned long operations, Body&& body) {
+                    if(name.find(options_.filter) == std::string::npos) {
+                        return false;
+                    }
+                    body();
+                    counter_values best;
+                    for(unsigned int repetition = 0; repetition < options_.repetitions; ++repetition) {
+                        counter_values sample;
+                        {
+                            perf_scope scope(counters_, sample);
+                            body();
+                        }
+                        if(repetition == 0 || sample.nanoseconds < best.nanoseconds) {
+                            best = sample;
+                        }
+                    }
+                    results_.push_back(benchmark_result{name, operations, best});
+                    return true;
+                }
+
+                unsigned long result_count() const noexcept {
+                    return results_.size();
+                }
+
+                const benchmark_result& result(unsigned long index) const {
+                    return results_.at(index);
+                }
+
+                // One row per benchmark; counters the host could not provide print as n/a.
+                void report(std::ostream& output) const {
+                    char line[256];
+                    std::snprintf(line, sizeof(line), "%-40s %12s %10s", "benchmark", "operations", "ns/op");
+                    output << line;
+                    for(const char* counter_name : counter_names) {
+                        std::snprintf(line, sizeof(line), " %14s", counter_name);
+                        output << line;
+                    }
+                    output << '\n';
+                    for(unsigned long index = 0; index < results_.size(); ++index) {
+                        const benchmark_result& result = results_.at(index);
+                        std::snprintf(line, sizeof(line), "%-40s %12lu %10.2f", result.name.c_str(), result.operations, result.nanoseconds_per_operation());
+                        output << line;
+                        for(unsigned int counter_index = 0; counter_index < counter_count; ++counter_index) {
+                            counter which = static_cast<counter>(counter_index);
+                            if(result.totals.has(which)) {
+                                std::snprintf(line, sizeof(line), " %14.3f", result.per_operation(which));
+                            }
+                            else {
+                                std::snprintf(line, sizeof(line), " %14s", "n/a");
+                            }
+                            output << line;
+                        }
+                        output << '\n';
+                    }
+                    if(!counters_.any_available()) {
+                        output << "Hardware counters are unavailable on this host; only wall clock time was measured.\n";
+                    }
+                }
+        };
+    }
+}
+
+#endif
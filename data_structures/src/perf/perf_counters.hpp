@@ -0,0 +1,192 @@
+#ifndef DATA_STRUCTURES_PERF_PERF_COUNTERS_HPP
+#define DATA_STRUCTURES_PERF_PERF_COUNTERS_HPP
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace data_structures {
+    namespace perf {
+
+        enum class counter {
+            CYCLES,
+            INSTRUCTIONS,
+            L1D_MISSES,
+            LLC_MISSES,
+            BRANCH_MISSES,
+            DTLB_MISSES,
+        };
+
+        inline constexpr unsigned int counter_count = 6;
+
+        inline constexpr std::array<const char*, counter_count> counter_names = {
+            "cycles", "instructions", "L1d misses", "LLC misses", "branch misses", "dTLB misses",
+        };
+
+        // One reading of every counter plus wall clock time. Counters the host could not open
+        // are marked unavailable and read as zero, so differences and sums stay well defined.
+        struct counter_values {
+            std::array<std::uint64_t, counter_count> counts{};
+            std::array<bool, counter_count> available{};
+            std::uint64_t nanoseconds = 0;
+
+            std::uint64_t operator[](counter which) const noexcept {
+                return counts[static_cast<unsigned int>(which)];
+            }
+
+            bool has(counter which) const noexcept {
+                return available[static_cast<unsigned int>(which)];
+            }
+
+            // The change from an earlier reading. Multiplexed counters are scaled estimates and
+            // may step backwards slightly, so differences clamp at zero.
+            counter_values operator-(const counter_values& earlier) const noexcept {
+                counter_values delta;
+                for(unsigned int index = 0; index < counter_count; ++index) {
+                    delta.available[index] = available[index] && earlier.available[index];
+                    delta.counts[index] = counts[index] > earlier.counts[index] ? counts[index] - earlier.counts[index] : 0;
+                }
+                delta.nanoseconds = nanoseconds > earlier.nanoseconds ? nanoseconds - earlier.nanoseconds : 0;
+                return delta;
+            }
+
+            counter_values& operator+=(const counter_values& other) noexcept {
+                for(unsigned int index = 0; index < counter_count; ++index) {
+                    available[index] = available[index] && other.available[index];
+                    counts[index] += other.counts[index];
+                }
+                nanoseconds += other.nanoseconds;
+                return *this;
+            }
+        };
+
+        namespace detail {
+            struct counter_config {
+                std::uint32_t type;
+                std::uint64_t config;
+            };
+
+            constexpr std::uint64_t cache_config(std::uint64_t cache, std::uint64_t operation, std::uint64_t result) {
+                return cache | (operation << 8) | (result << 16);
+            }
+
+            inline constexpr std::array<counter_config, counter_count> counter_configs = {{
+                {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+                {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+                {PERF_TYPE_HW_CACHE, cache_config(PERF_COUNT_HW_CACHE_L1D, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS)},
+                {PERF_TYPE_HW_CACHE, cache_config(PERF_COUNT_HW_CACHE_LL, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS)},
+                {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+                {PERF_TYPE_HW_CACHE, cache_config(PERF_COUNT_HW_CACHE_DTLB, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS)},
+            }};
+
+            inline int open_counter(const counter_config& config) {
+                perf_event_attr attributes;
+                std::memset(&attributes, 0, sizeof(attributes));
+                attributes.size = sizeof(attributes);
+                attributes.type = config.type;
+                attributes.config = config.config;
+                attributes.exclude_kernel = 1;
+                attributes.exclude_hv = 1;
+                attributes.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+                return static_cast<int>(::syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0));
+            }
+        }
+
+        // Hardware counters for the calling thread, user space only. Each counter is opened on
+        // its own rather than as a group, so a host with fewer programmable counters than
+        // requested multiplexes them and readings are scaled by the share of time each was
+        // scheduled. Any counter the kernel refuses, because the host has no PMU, the sandbox
+        // blocks perf_event_open, or perf_event_paranoid is too strict, is left unavailable;
+        // with none available the counters still measure wall clock time.
+        class perf_counters {
+            private:
+                std::array<int, counter_count> descriptors_;
+
+            public:
+                perf_counters() {
+                    for(unsigned int index = 0; index < counter_count; ++index) {
+                        descriptors_[index] = detail::open_counter(detail::counter_configs[index]);
+                    }
+                }
+
+                perf_counters(const perf_counters&) = delete;
+                perf_counters& operator=(const perf_counters&) = delete;
+
+                ~perf_counters() {
+                    for(int descriptor : descriptors_) {
+                        if(descriptor >= 0) {
+                            ::close(descriptor);
+                        }
+                    }
+                }
+
+                bool available(counter which) const noexcept {
+                    return descriptors_[static_cast<unsigned int>(which)] >= 0;
+                }
+
+                bool any_available() const noexcept {
+                    for(int descriptor : descriptors_) {
+                        if(descriptor >= 0) {
+                            return true;
+                        }
+                    }
+                    return false;
+                }
+
+                // Counters run from construction; readings are cumulative and meant to be
+                // subtracted from one another.
+                counter_values read() const noexcept {
+                    counter_values values;
+                    for(unsigned int index = 0; index < counter_count; ++index) {
+                        if(descriptors_[index] < 0) {
+                            continue;
+                        }
+                        std::uint64_t buffer[3] = {0, 0, 0};
+                        if(::read(descriptors_[index], buffer, sizeof(buffer)) != static_cast<ssize_t>(sizeof(buffer))) {
+                            continue;
+                        }
+                        values.available[index] = true;
+                        std::uint64_t enabled = buffer[1];
+                        std::uint64_t running = buffer[2];
+                        if(running == 0) {
+                            values.counts[index] = 0;
+                        }
+                        else if(running < enabled) {
+                            values.counts[index] = static_cast<std::uint64_t>(static_cast<double>(buffer[0]) * static_cast<double>(enabled) / static_cast<double>(running));
+                        }
+                        else {
+                            values.counts[index] = buffer[0];
+                        }
+                    }
+                    values.nanoseconds = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+                    return values;
+                }
+        };
+
+        // Measures the enclosing block: reads the counters on construction and stores the
+        // difference into result on destruction.
+        class perf_scope {
+            private:
+                const perf_counters& counters_;
+                counter_values& result_;
+                counter_values start_;
+
+            public:
+                perf_scope(const perf_counters& counters, counter_values& result) : counters_(counters), result_(result), start_(counters.read()) {}
+
+                perf_scope(const perf_scope&) = delete;
+                perf_scope& operator=(const perf_scope&) = delete;
+
+                ~perf_scope() {
+                    result_ = counters_.read() - start_;
+                }
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,298 @@
+#ifndef DATA_STRUCTURES_SERIALIZATION_BINARY_SERIALIZATION_HPP
+#define DATA_STRUCTURES_SERIALIZATION_BINARY_SERIALIZATION_HPP
+
+#include <bit>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unistd.h>
+
+#include "data_structures/src/linear/dynamic_array.hpp"
+
+namespace data_structures {
+    namespace serialization {
+
+        // On-disk layout: a fixed size snapshot_header, zero padding up to payload_offset
+        // (a multiple of payload_alignment) and then the raw element bytes. Buffers that are
+        // page aligned (mmap) therefore hand out payloads suitably aligned for any element type.
+        inline constexpr std::uint32_t snapshot_magic = 0x52414453; // "SDAR"
+        inline constexpr std::uint16_t snapshot_version = 1;
+        inline constexpr std::size_t payload_alignment = 64;
+
+        struct snapshot_header {
+            std::uint32_t magic;
+            std::uint16_t version;
+            std::uint16_t header_size;
+            std::uint32_t element_size;
+            std::uint32_t element_alignment;
+            std::uint64_t element_count;
+            std::uint64_t payload_offset;
+            std::uint64_t checksum;
+        };
+
+        static_assert(std::is_trivially_copyable_v<snapshot_header>);
+        static_assert(sizeof(snapshot_header) <= payload_alignment);
+
+        class serialization_error : public std::runtime_error {
+            public:
+                using std::runtime_error::runtime_error;
+        };
+
+        template<class T>
+        concept snapshot_element = std::is_trivially_copyable_v<T> && !std::is_pointer_v<T>;
+
+        namespace detail {
+            inline constexpr std::uint64_t prime_1 = 0x9E3779B185EBCA87ULL;
+            inline constexpr std::uint64_t prime_2 = 0xC2B2AE3D27D4EB4FULL;
+            inline constexpr std::uint64_t prime_3 = 0x165667B19E3779F9ULL;
+            inline constexpr std::uint64_t prime_4 = 0x85EBCA77C2B2AE63ULL;
+            inline constexpr std::uint64_t prime_5 = 0x27D4EB2F165667C5ULL;
+
+            inline std::uint64_t load_word(const unsigned char* bytes) {
+                std::uint64_t word;
+                std::memcpy(&word, bytes, sizeof(word));
+                return word;
+            }
+
+            inline std::uint64_t mix_lane(std::uint64_t lane, std::uint64_t word) {
+                return std::rotl(lane + word * prime_2, 31) * prime_1;
+            }
+
+            inline std::size_t padded_offset(std::size_t offset) {
+                return (offset + payload_alignment - 1) & ~(payload_alignment - 1);
+            }
+
+            inline void write_fully(int fd, const void* data, std::size_t size) {
+                const char* bytes = static_cast<const char*>(data);
+                while(size > 0) {
+                    ssize_t written = ::write(fd, bytes, size);
+                    if(written < 0) {
+                        if(errno == EINTR) {
+                            continue;
+                        }
+                        throw serialization_error("Failed to write snapshot: " + std::string(std::strerror(errno)));
+                    }
+                    bytes += written;
+                    size -= static_cast<std::size_t>(written);
+                }
+            }
+
+            inline void read_fully(int fd, void* data, std::size_t size) {
+                char* bytes = static_cast<char*>(data);
+                while(size > 0) {
+                    ssize_t received = ::read(fd, bytes, size);
+                    if(received < 0) {
+                        if(errno == EINTR) {
+                            continue;
+                        }
+                        throw serialization_error("Failed to read snapshot: " + std::string(std::strerror(errno)));
+                    }
+                    if(received == 0) {
+                        throw serialization_error("Snapshot is truncated.");
+                    }
+                    bytes += received;
+                    size -= static_cast<std::size_t>(received);
+                }
+            }
+
+            inline void write_fully(std::ostream& stream, const void* data, std::size_t size) {
+                stream.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+                if(!stream) {
+                    throw serialization_error("Failed to write snapshot to stream.");
+                }
+            }
+
+            inline void read_fully(std::istream& stream, void* data, std::size_t size) {
+                stream.read(static_cast<char*>(data), static_cast<std::streamsize>(size));
+                if(static_cast<std::size_t>(stream.gcount()) != size) {
+                    throw serialization_error("Snapshot is truncated.");
+                }
+            }
+
+            template<class T>
+            void validate_header(const snapshot_header& header) {
+                if(header.magic != snapshot_magic) {
+                    throw serialization_error("Buffer does not contain a snapshot.");
+                }
+                if(header.version != snapshot_version) {
+                    throw serialization_error("Unsupported snapshot version " + std::to_string(header.version));
+                }
+                if(header.header_size != sizeof(snapshot_header) || header.payload_offset != padded_offset(sizeof(snapshot_header))) {
+                    throw serialization_error("Snapshot header is corrupt.");
+                }
+                if(header.element_size != sizeof(T) || header.element_alignment != alignof(T)) {
+                    throw serialization_error("Snapshot element layout does not match the requested type.");
+                }
+                if(header.element_count > (SIZE_MAX - header.payload_offset) / sizeof(T)) {
+                    throw serialization_error("Snapshot element count is corrupt.");
+                }
+            }
+
+            template<class Sink>
+            void write_padding(Sink& sink) {
+                constexpr std::size_t padding_size = payload_alignment - sizeof(snapshot_header);
+                const unsigned char padding[padding_size == 0 ? 1 : padding_size] = {};
+                if constexpr(padding_size > 0) {
+                    write_fully(sink, padding, padding_size);
+                }
+            }
+
+            template<class Source>
+            void skip_padding(Source& source) {
+                constexpr std::size_t padding_size = payload_alignment - sizeof(snapshot_header);
+                unsigned char padding[padding_size == 0 ? 1 : padding_size];
+                if constexpr(padding_size > 0) {
+                    read_fully(source, padding, padding_size);
+                }
+            }
+        }
+
+        inline std::uint64_t payload_checksum(const void* data, std::size_t size) {
+            const unsigned char* bytes = static_cast<const unsigned char*>(data);
+            std::size_t offset = 0;
+            std::uint64_t hash;
+
+            if(size >= 32) {
+                std::uint64_t lanes[4] = {detail::prime_1 + detail::prime_2, detail::prime_2, 0, 0 - detail::prime_1};
+                for(; offset + 32 <= size; offset += 32) {
+                    lanes[0] = detail::mix_lane(lanes[0], detail::load_word(bytes + offset));
+                    lanes[1] = detail::mix_lane(lanes[1], detail::load_word(bytes + offset + 8));
+                    lanes[2] = detail::mix_lane(lanes[2], detail::load_word(bytes + offset + 16));
+                    lanes[3] = detail::mix_lane(lanes[3], detail::load_word(bytes + offset + 24));
+                }
+                hash = std::rotl(lanes[0], 1) + std::rotl(lanes[1], 7) + std::rotl(lanes[2], 12) + std::rotl(lanes[3], 18);
+            }
+            else {
+                hash = detail::prime_5;
+            }
+
+            hash += size;
+            for(; offset + 8 <= size; offset += 8) {
+                hash ^= detail::mix_lane(0, detail::load_word(bytes + offset));
+                hash = std::rotl(hash, 27) * detail::prime_1 + detail::prime_4;
+            }
+            for(; offset < size; ++offset) {
+                hash ^= bytes[offset] * detail::prime_5;
+                hash = std::rotl(hash, 11) * detail::prime_1;
+            }
+
+            hash ^= hash >> 33;
+            hash *= detail::prime_2;
+            hash ^= hash >> 29;
+            hash *= detail::prime_3;
+            hash ^= hash >> 32;
+            return hash;
+        }
+
+        namespace detail {
+            template<class T>
+            snapshot_header make_header(const T* data, std::size_t count) {
+                snapshot_header header{};
+                header.magic = snapshot_magic;
+                header.version = snapshot_version;
+                header.header_size = sizeof(snapshot_header);
+                header.element_size = sizeof(T);
+                header.element_alignment = alignof(T);
+                header.element_count = count;
+                header.payload_offset = padded_offset(sizeof(snapshot_header));
+                header.checksum = payload_checksum(data, count * sizeof(T));
+                return header;
+            }
+
+            template<class T, class Allocator, class Instrumentation, class BoundsCheck, class Sink>
+            void write_snapshot(Sink& sink, const linear::dynamic_array<T, Allocator, Instrumentation, BoundsCheck>& array) {
+                snapshot_header header = make_header(array.data(), array.size());
+                write_fully(sink, &header, sizeof(header));
+                write_padding(sink);
+                write_fully(sink, array.data(), array.size() * sizeof(T));
+            }
+
+            template<class T, class Allocator, class Instrumentation, class BoundsCheck, class Source>
+            void read_snapshot(Source& source, linear::dynamic_array<T, Allocator, Instrumentation, BoundsCheck>& array) {
+                snapshot_header header;
+                read_fully(source, &header, sizeof(header));
+                validate_header<T>(header);
+                skip_padding(source);
+
+                array.clear();
+                if constexpr(linear::implicit_lifetime_element<T>) {
+                    array.resize_uninitialized(header.element_count);
+                }
+                else {
+                    array.resize(header.element_count);
+                }
+                // A payload that fails to arrive or to verify leaves the array empty rather than
+                // holding partially read elements.
+                try {
+                    read_fully(source, array.data(), header.element_count * sizeof(T));
+                    if(payload_checksum(array.data(), header.element_count * sizeof(T)) != header.checksum) {
+                        throw serialization_error("Snapshot checksum mismatch.");
+                    }
+                }
+                catch(...) {
+                    array.clear();
+                    throw;
+                }
+            }
+        }
+
+        template<class T>
+        constexpr std::size_t snapshot_size(std::size_t count) {
+            return detail::padded_offset(sizeof(snapshot_header)) + count * sizeof(T);
+        }
+
+        template<snapshot_element T, class Allocator, class Instrumentation, class BoundsCheck>
+        void write_to(std::ostream& stream, const linear::dynamic_array<T, Allocator, Instrumentation, BoundsCheck>& array) {
+            detail::write_snapshot(stream, array);
+        }
+
+        template<snapshot_element T, class Allocator, class Instrumentation, class BoundsCheck>
+        void write_to(int fd, const linear::dynamic_array<T, Allocator, Instrumentation, BoundsCheck>& array) {
+            detail::write_snapshot(fd, array);
+        }
+
+        template<snapshot_element T, class Allocator, class Instrumentation, class BoundsCheck>
+        void read_from(std::istream& stream, linear::dynamic_array<T, Allocator, Instrumentation, BoundsCheck>& array) {
+            detail::read_snapshot(stream, array);
+        }
+
+        template<snapshot_element T, class Allocator, class Instrumentation, class BoundsCheck>
+        void read_from(int fd, linear::dynamic_array<T, Allocator, Instrumentation, BoundsCheck>& array) {
+            detail::read_snapshot(fd, array);
+        }
+
+        // Validates the snapshot in place and returns a view of its elements without copying.
+        // The view aliases the buffer and is only valid for as long as the buffer is.
+        template<snapshot_element T>
+        std::span<const T> view_from(const void* buffer, std::size_t size, bool verify_checksum = true) {
+            if(buffer == nullptr || size < sizeof(snapshot_header)) {
+                throw serialization_error("Snapshot is truncated.");
+            }
+            snapshot_header header;
+            std::memcpy(&header, buffer, sizeof(header));
+            detail::validate_header<T>(header);
+
+            std::size_t payload_size = header.element_count * sizeof(T);
+            if(size < header.payload_offset || size - header.payload_offset < payload_size) {
+                throw serialization_error("Snapshot is truncated.");
+            }
+            const unsigned char* payload = static_cast<const unsigned char*>(buffer) + header.payload_offset;
+            if(reinterpret_cast<std::uintptr_t>(payload) % alignof(T) != 0) {
+                throw serialization_error("Snapshot payload is not suitably aligned for the element type.");
+            }
+            if(verify_checksum && payload_checksum(payload, payload_size) != header.checksum) {
+                throw serialization_error("Snapshot checksum mismatch.");
+            }
+            return std::span<const T>(reinterpret_cast<const T*>(payload), header.element_count);
+        }
+    }
+}
+
+#endif
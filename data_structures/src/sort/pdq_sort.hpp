@@ -0,0 +1,264 @@
+#ifndef DATA_STRUCTURES_SORT_PDQ_SORT_HPP
+#define DATA_STRUCTURES_SORT_PDQ_SORT_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include "data_structures/src/linear/dynamic_array.hpp"
+#include "data_structures/src/sort/sorting_network.hpp"
+
+namespace data_structures {
+    namespace sort {
+
+        namespace detail {
+            inline constexpr std::ptrdiff_t insertion_sort_threshold = 24;
+            inline constexpr std::ptrdiff_t ninther_threshold = 128;
+            inline constexpr std::ptrdiff_t partial_insertion_sort_limit = 8;
+
+            template<class T>
+            inline constexpr bool use_sorting_network = std::is_trivially_copyable_v<T> && sizeof(T) <= 16;
+
+            template<class T, class Compare>
+            void insertion_sort(T* begin, T* end, Compare& compare) {
+                if(begin == end) {
+                    return;
+                }
+                for(T* current = begin + 1; current != end; ++current) {
+                    T* sift = current;
+                    T* sift_previous = current - 1;
+                    if(compare(*sift, *sift_previous)) {
+                        T value = std::move(*sift);
+                        do {
+                            *sift-- = std::move(*sift_previous);
+                        } while(sift != begin && compare(value, *--sift_previous));
+                        *sift = std::move(value);
+                    }
+                }
+            }
+
+            // Requires an element before begin that is not greater than anything in the range.
+            template<class T, class Compare>
+            void unguarded_insertion_sort(T* begin, T* end, Compare& compare) {
+                if(begin == end) {
+                    return;
+                }
+                for(T* current = begin + 1; current != end; ++current) {
+                    T* sift = current;
+                    T* sift_previous = current - 1;
+                    if(compare(*sift, *sift_previous)) {
+                        T value = std::move(*sift);
+                        do {
+                            *sift-- = std::move(*sift_previous);
+                        } while(compare(value, *--sift_previous));
+                        *sift = std::move(value);
+                    }
+                }
+            }
+
+            // Gives up and returns false once more than a handful of elements had to move.
+            template<class T, class Compare>
+            bool partial_insertion_sort(T* begin, T* end, Compare& compare) {
+                if(begin == end) {
+                    return true;
+                }
+                std::ptrdiff_t moved = 0;
+                for(T* current = begin + 1; current != end; ++current) {
+                    T* sift = current;
+                    T* sift_previous = current - 1;
+                    if(compare(*sift, *sift_previous)) {
+                        T value = std::move(*sift);
+                        do {
+                            *sift-- = std::move(*sift_previous);
+                        } while(sift != begin && compare(value, *--sift_previous));
+                        *sift = std::move(value);
+                        moved += current - sift;
+                    }
+                    if(moved > partial_insertion_sort_limit) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            template<class T, class Compare>
+            void small_sort(T* begin, T* end, Compare& compare, bool leftmost) {
+                if constexpr(use_sorting_network<T>) {
+                    if(end - begin <= static_cast<std::ptrdiff_t>(max_network_size)) {
+                        network_sort_dispatch(begin, static_cast<std::size_t>(end - begin), compare);
+                        return;
+                    }
+                }
+                if(leftmost) {
+                    insertion_sort(begin, end, compare);
+                }
+                else {
+                    unguarded_insertion_sort(begin, end, compare);
+                }
+            }
+
+            template<class T, class Compare>
+            void sort2(T* first, T* second, Compare& compare) {
+                if(compare(*second, *first)) {
+                    std::iter_swap(first, second);
+                }
+            }
+
+            template<class T, class Compare>
+            void sort3(T* first, T* second, T* third, Compare& compare) {
+                sort2(first, second, compare);
+                sort2(second, third, compare);
+                sort2(first, second, compare);
+            }
+
+            // Partitions around the pivot at *begin into [< pivot] pivot [>= pivot] and reports
+            // whether no element had to be swapped.
+            template<class T, class Compare>
+            std::pair<T*, bool> partition_right(T* begin, T* end, Compare& compare) {
+                T pivot = std::move(*begin);
+                T* first = begin;
+                T* last = end;
+                while(compare(*++first, pivot));
+                if(first - 1 == begin) {
+                    while(first < last && !compare(*--last, pivot));
+                }
+                else {
+                    while(!compare(*--last, pivot));
+                }
+                bool already_partitioned = first >= last;
+                while(first < last) {
+                    std::iter_swap(first, last);
+                    while(compare(*++first, pivot));
+                    while(!compare(*--last, pivot));
+                }
+                T* pivot_position = first - 1;
+                *begin = std::move(*pivot_position);
+                *pivot_position = std::move(pivot);
+                return std::pair<T*, bool>(pivot_position, already_partitioned);
+            }
+
+            // Partitions into [<= pivot] pivot [> pivot]; used when the pivot equals the element
+            // before the range, which puts every copy of it in place in one linear pass.
+            template<class T, class Compare>
+            T* partition_left(T* begin, T* end, Compare& compare) {
+                T pivot = std::move(*begin);
+                T* first = begin;
+                T* last = end;
+                while(compare(pivot, *--last));
+                if(last + 1 == end) {
+                    while(first < last && !compare(pivot, *++first));
+                }
+                else {
+                    while(!compare(pivot, *++first));
+                }
+                while(first < last) {
+                    std::iter_swap(first, last);
+                    while(compare(pivot, *--last));
+                    while(!compare(pivot, *++first));
+                }
+                T* pivot_position = last;
+                *begin = std::move(*pivot_position);
+                *pivot_position = std::move(pivot);
+                return pivot_position;
+            }
+
+            template<class T, class Compare>
+            void break_patterns(T* begin, T* pivot_position, T* end) {
+                std::ptrdiff_t left_size = pivot_position - begin;
+                std::ptrdiff_t right_size = end - (pivot_position + 1);
+                if(left_size >= insertion_sort_threshold) {
+                    std::iter_swap(begin, begin + left_size / 4);
+                    std::iter_swap(pivot_position - 1, pivot_position - left_size / 4);
+                    if(left_size > ninther_threshold) {
+                        std::iter_swap(begin + 1, begin + (left_size / 4 + 1));
+                        std::iter_swap(begin + 2, begin + (left_size / 4 + 2));
+                        std::iter_swap(pivot_position - 2, pivot_position - (left_size / 4 + 1));
+                        std::iter_swap(pivot_position - 3, pivot_position - (left_size / 4 + 2));
+                    }
+                }
+                if(right_size >= insertion_sort_threshold) {
+                    std::iter_swap(pivot_position + 1, pivot_position + (1 + right_size / 4));
+                    std::iter_swap(end - 1, end - right_size / 4);
+                    if(right_size > ninther_threshold) {
+                        std::iter_swap(pivot_position + 2, pivot_position + (2 + right_size / 4));
+                        std::iter_swap(pivot_position + 3, pivot_position + (3 + right_size / 4));
+                        std::iter_swap(end - 2, end - (1 + right_size / 4));
+                        std::iter_swap(end - 3, end - (2 + right_size / 4));
+                    }
+                }
+            }
+
+            template<class T, class Compare>
+            void pdq_sort_loop(T* begin, T* end, Compare& compare, int bad_allowed, bool leftmost) {
+                while(true) {
+                    std::ptrdiff_t size = end - begin;
+                    if(size < insertion_sort_threshold) {
+                        small_sort(begin, end, compare, leftmost);
+                        return;
+                    }
+
+                    std::ptrdiff_t half = size / 2;
+                    if(size > ninther_threshold) {
+                        sort3(begin, begin + half, end - 1, compare);
+                        sort3(begin + 1, begin + (half - 1), end - 2, compare);
+                        sort3(begin + 2, begin + (half + 1), end - 3, compare);
+                        sort3(begin + (half - 1), begin + half, begin + (half + 1), compare);
+                        std::iter_swap(begin, begin + half);
+                    }
+                    else {
+                        sort3(begin + half, begin, end - 1, compare);
+                    }
+
+                    if(!leftmost && !compare(*(begin - 1), *begin)) {
+                        begin = partition_left(begin, end, compare) + 1;
+                        continue;
+                    }
+
+                    auto [pivot_position, already_partitioned] = partition_right(begin, end, compare);
+                    std::ptrdiff_t left_size = pivot_position - begin;
+                    std::ptrdiff_t right_size = end - (pivot_position + 1);
+                    if(left_size < size / 8 || right_size < size / 8) {
+                        if(--bad_allowed == 0) {
+                            std::make_heap(begin, end, compare);
+                            std::sort_heap(begin, end, compare);
+                            return;
+                        }
+                        break_patterns<T, Compare>(begin, pivot_position, end);
+                    }
+                    else if(already_partitioned && partial_insertion_sort(begin, pivot_position, compare) &&
+                            partial_insertion_sort(pivot_position + 1, end, compare)) {
+                        return;
+                    }
+
+                    pdq_sort_loop(begin, pivot_position, compare, bad_allowed, leftmost);
+                    begin = pivot_position + 1;
+                    leftmost = false;
+                }
+            }
+        }
+
+        // Pattern-defeating quicksort: quicksort with a median-of-3 or ninther pivot that
+        // finishes already sorted runs with a bounded insertion sort, groups runs of equal
+        // keys in a single pass, shuffles a few elements after unbalanced partitions and
+        // falls back to heapsort if that keeps happening, so the worst case is O(n log n).
+        // Small ranges of trivially copyable elements go through a sorting network.
+        template<class T, class Compare = std::less<T>>
+        void pdq_sort(T* begin, T* end, Compare compare = Compare()) {
+            if(end - begin < 2) {
+                return;
+            }
+            int bad_allowed = std::bit_width(static_cast<std::size_t>(end - begin));
+            detail::pdq_sort_loop(begin, end, compare, bad_allowed, true);
+        }
+
+        template<class T, class Allocator, class Instrumentation, class BoundsCheck, class Compare = std::less<T>>
+        void pdq_sort(linear::dynamic_array<T, Allocator, Instrumentation, BoundsCheck>& array, Compare compare = Compare()) {
+            pdq_sort(array.data(), array.data() + array.size(), compare);
+        }
+    }
+}
+
+#endif
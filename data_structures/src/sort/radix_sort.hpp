@@ -0,0 +1,148 @@
+#ifndef DATA_STRUCTURES_SORT_RADIX_SORT_HPP
+#define DATA_STRUCTURES_SORT_RADIX_SORT_HPP
+
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "data_structures/src/linear/dynamic_array.hpp"
+
+namespace data_structures {
+    namespace sort {
+
+        template<class T>
+        concept radix_key_type = (std::integral<T> && !std::same_as<T, bool>) || (std::floating_point<T> && (sizeof(T) == 4 || sizeof(T) == 8));
+
+        // Maps a key to an unsigned integer with the same ordering: signed integers get their
+        // sign bit flipped, and floats have all bits flipped when negative and only the sign
+        // bit otherwise. Negative NaNs sort first, positive NaNs last and -0.0 before 0.0.
+        template<radix_key_type Key>
+        constexpr auto radix_key(Key key) noexcept {
+            if constexpr(std::floating_point<Key>) {
+                using bits_type = std::conditional_t<sizeof(Key) == 4, std::uint32_t, std::uint64_t>;
+                constexpr bits_type sign_bit = bits_type(1) << (std::numeric_limits<bits_type>::digits - 1);
+                bits_type bits = std::bit_cast<bits_type>(key);
+                return (bits & sign_bit) ? bits_type(~bits) : bits_type(bits | sign_bit);
+            }
+            else if constexpr(std::signed_integral<Key>) {
+                using bits_type = std::make_unsigned_t<Key>;
+                constexpr bits_type sign_bit = bits_type(1) << (std::numeric_limits<bits_type>::digits - 1);
+                return static_cast<bits_type>(static_cast<bits_type>(key) ^ sign_bit);
+            }
+            else {
+                return key;
+            }
+        }
+
+        struct identity_key {
+            template<class T>
+            constexpr const T& operator()(const T& value) const noexcept {
+                return value;
+            }
+        };
+
+        namespace detail {
+            inline constexpr std::size_t radix_bits = 8;
+            inline constexpr std::size_t radix_buckets = std::size_t(1) << radix_bits;
+            inline constexpr std::size_t radix_insertion_threshold = 64;
+
+            template<class T, class KeyFunction>
+            void radix_insertion_sort(T* values, std::size_t size, KeyFunction& key) {
+                for(std::size_t current = 1; current < size; ++current) {
+                    auto current_key = radix_key(key(values[current]));
+                    if(current_key >= radix_key(key(values[current - 1]))) {
+                        continue;
+                    }
+                    T value = std::move(values[current]);
+                    std::size_t position = current;
+                    do {
+                        values[position] = std::move(values[position - 1]);
+                        --position;
+                    } while(position > 0 && current_key < radix_key(key(values[position - 1])));
+                    values[position] = std::move(value);
+                }
+            }
+
+            // One counting pass builds the histograms for every digit, and a digit on which all
+            // keys agree is skipped, so narrow value ranges only pay for the digits that vary.
+            template<class T, class KeyFunction>
+            void radix_sort_buffers(T* values, T* scratch, std::size_t size, KeyFunction& key) {
+                using bits_type = decltype(radix_key(key(values[0])));
+                constexpr std::size_t digit_count = sizeof(bits_type);
+
+                std::size_t counts[digit_count][radix_buckets] = {};
+                for(std::size_t index = 0; index < size; ++index) {
+                    bits_type bits = radix_key(key(values[index]));
+                    for(std::size_t digit = 0; digit < digit_count; ++digit) {
+                        ++counts[digit][(bits >> (digit * radix_bits)) & (radix_buckets - 1)];
+                    }
+                }
+
+                T* source = values;
+                T* target = scratch;
+                for(std::size_t digit = 0; digit < digit_count; ++digit) {
+                    std::size_t shift = digit * radix_bits;
+                    std::size_t* count = counts[digit];
+                    if(count[(radix_key(key(source[0])) >> shift) & (radix_buckets - 1)] == size) {
+                        continue;
+                    }
+                    std::size_t offsets[radix_buckets];
+                    std::size_t running = 0;
+                    for(std::size_t bucket = 0; bucket < radix_buckets; ++bucket) {
+                        offsets[bucket] = running;
+                        running += count[bucket];
+                    }
+                    for(std::size_t index = 0; index < size; ++index) {
+                        std::size_t bucket = (radix_key(key(source[index])) >> shift) & (radix_buckets - 1);
+                        target[offsets[bucket]++] = std::move(source[index]);
+                    }
+                    std::swap(source, target);
+                }
+                if(source != values) {
+                    for(std::size_t index = 0; index < size; ++index) {
+                        values[index] = std::move(source[index]);
+                    }
+                }
+            }
+        }
+
+        // Stable LSD radix sort on 8 bit digits of radix_key(key(element)). The scratch span
+        // must hold at least as many constructed elements as values; its contents are
+        // clobbered. Passing the same scratch buffer to repeated sorts avoids reallocating it.
+        template<class T, class KeyFunction = identity_key>
+        void radix_sort(std::span<T> values, std::span<T> scratch, KeyFunction key = KeyFunction()) {
+            if(scratch.size() < values.size()) {
+                throw std::invalid_argument("Radix sort scratch buffer is smaller than the input.");
+            }
+            if(values.size() <= detail::radix_insertion_threshold) {
+                detail::radix_insertion_sort(values.data(), values.size(), key);
+                return;
+            }
+            detail::radix_sort_buffers(values.data(), scratch.data(), values.size(), key);
+        }
+
+        template<class T, class Allocator, class Instrumentation, class BoundsCheck, class KeyFunction = identity_key>
+        void radix_sort(linear::dynamic_array<T, Allocator, Instrumentation, BoundsCheck>& array, KeyFunction key = KeyFunction()) {
+            if(array.size() <= detail::radix_insertion_threshold) {
+                detail::radix_insertion_sort(array.data(), array.size(), key);
+                return;
+            }
+            linear::dynamic_array<T, Allocator, linear::no_instrumentation, linear::unchecked> scratch(array.get_allocator());
+            if constexpr(linear::implicit_lifetime_element<T>) {
+                scratch.resize_uninitialized(array.size());
+            }
+            else {
+                scratch.resize(array.size());
+            }
+            detail::radix_sort_buffers(array.data(), scratch.data(), array.size(), key);
+        }
+    }
+}
+
+#endif
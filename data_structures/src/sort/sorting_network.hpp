@@ -0,0 +1,114 @@
+#ifndef DATA_STRUCTURES_SORT_SORTING_NETWORK_HPP
+#define DATA_STRUCTURES_SORT_SORTING_NETWORK_HPP
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace data_structures {
+    namespace sort {
+
+        inline constexpr std::size_t max_network_size = 16;
+
+        namespace detail {
+            struct comparator {
+                std::size_t low;
+                std::size_t high;
+            };
+
+            // Batcher's odd-even merge sort, with comparators that would touch positions past
+            // the end dropped; the dropped positions behave like +infinity padding.
+            template<bool Emit>
+            constexpr std::size_t batcher_network(std::size_t size, comparator* out) {
+                std::size_t count = 0;
+                for(std::size_t p = 1; p < size; p <<= 1) {
+                    for(std::size_t k = p; k >= 1; k >>= 1) {
+                        for(std::size_t j = k % p; j + k < size; j += 2 * k) {
+                            for(std::size_t i = 0; i < k && i + j + k < size; ++i) {
+                                if((i + j) / (2 * p) == (i + j + k) / (2 * p)) {
+                                    if constexpr(Emit) {
+                                        out[count] = comparator{i + j, i + j + k};
+                                    }
+                                    ++count;
+                                }
+                            }
+                        }
+                    }
+                }
+                return count;
+            }
+
+            template<std::size_t Size>
+            constexpr auto make_network() {
+                std::array<comparator, batcher_network<false>(Size, nullptr)> network{};
+                batcher_network<true>(Size, network.data());
+                return network;
+            }
+
+            template<std::size_t Size>
+            inline constexpr auto network = make_network<Size>();
+
+            // Both outputs are selected from the comparison result rather than branched on, so
+            // the unrolled network runs without mispredictions and, for arithmetic types,
+            // compiles to min/max instructions the vectorizer can batch.
+            template<class T, class Compare>
+            inline void compare_exchange(T& low, T& high, Compare& compare) {
+                if constexpr(std::is_trivially_copyable_v<T>) {
+                    bool swapped = compare(high, low);
+                    T first = swapped ? high : low;
+                    T second = swapped ? low : high;
+                    low = first;
+                    high = second;
+                }
+                else if(compare(high, low)) {
+                    std::swap(low, high);
+                }
+            }
+
+            // Networks for 0 and 1 elements are empty, which leaves both parameters unused.
+            template<std::size_t Size, class T, class Compare, std::size_t... Index>
+            inline void apply_network([[maybe_unused]] T* values, [[maybe_unused]] Compare& compare, std::index_sequence<Index...>) {
+                (compare_exchange(values[network<Size>[Index].low], values[network<Size>[Index].high], compare), ...);
+            }
+
+            template<std::size_t Size, class T, class Compare>
+            void network_sort_fixed(T* values, Compare& compare) {
+                apply_network<Size>(values, compare, std::make_index_sequence<network<Size>.size()>());
+            }
+
+            template<class T, class Compare, std::size_t... Size>
+            constexpr auto make_network_table(std::index_sequence<Size...>) {
+                return std::array<void (*)(T*, Compare&), sizeof...(Size)>{&network_sort_fixed<Size, T, Compare>...};
+            }
+        }
+
+        // Sorts exactly Size elements with a fixed comparator network.
+        template<std::size_t Size, class T, class Compare = std::less<T>>
+        void network_sort(T* values, Compare compare = Compare()) {
+            detail::network_sort_fixed<Size>(values, compare);
+        }
+
+        namespace detail {
+            template<class T, class Compare>
+            void network_sort_dispatch(T* values, std::size_t size, Compare& compare) {
+                static constexpr auto table = make_network_table<T, Compare>(std::make_index_sequence<max_network_size + 1>());
+                table[size](values, compare);
+            }
+        }
+
+        // Sorts up to max_network_size elements, dispatching on the runtime size.
+        template<class T, class Compare = std::less<T>>
+        void network_sort(T* values, std::size_t size, Compare compare = Compare()) {
+            if(size > max_network_size) {
+                throw std::length_error("Sorting networks handle at most " + std::to_string(max_network_size) + " elements.");
+            }
+            detail::network_sort_dispatch(values, size, compare);
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,97 @@
+#include "gtest/gtest.h"
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+#include "data_structures/src/cache/clock_cache.hpp"
+
+using data_structures::cache::clock_cache;
+
+TEST(clock_cache_tests, ConsistencyTests) {
+    clock_cache<int, std::string> test_cache(64);
+    std::unordered_map<int, std::string> last_written;
+    std::mt19937 generator(11);
+    for(unsigned int round = 0; round < 20000; ++round) {
+        int key = static_cast<int>(generator() % 200);
+        switch(generator() % 3) {
+            case 0: {
+                std::string* found = test_cache.find(key);
+                if(found) {
+                    ASSERT_EQ(*found, last_written.at(key));
+                }
+                break;
+            }
+            case 1:
+                test_cache.put(key, std::to_string(round));
+                last_written[key] = std::to_string(round);
+                break;
+            default:
+                if(test_cache.contains(key)) {
+                    ASSERT_TRUE(test_cache.erase(key));
+                    ASSERT_FALSE(test_cache.contains(key));
+                }
+                else {
+                    ASSERT_FALSE(test_cache.erase(key));
+                }
+                break;
+        }
+        ASSERT_LE(test_cache.size(), test_cache.capacity());
+    }
+    std::set<int> keys;
+    test_cache.for_each([&](int key, const std::string& value) {
+        EXPECT_EQ(value, last_written.at(key));
+        keys.insert(key);
+    });
+    EXPECT_EQ(keys.size(), test_cache.size());
+}
+
+TEST(clock_cache_tests, SecondChanceTests) {
+    clock_cache<int, int> test_cache(4);
+    for(int key = 0; key < 4; ++key) {
+        test_cache.put(key, key);
+    }
+    EXPECT_NE(test_cache.find(0), nullptr);
+    EXPECT_NE(test_cache.find(2), nullptr);
+    test_cache.put(4, 4);
+    test_cache.put(5, 5);
+    EXPECT_TRUE(test_cache.contains(0));
+    EXPECT_TRUE(test_cache.contains(2));
+    EXPECT_FALSE(test_cache.contains(1));
+    EXPECT_FALSE(test_cache.contains(3));
+    EXPECT_EQ(test_cache.stats().evictions, 2);
+    EXPECT_EQ(test_cache.stats().hits, 2);
+}
+
+TEST(clock_cache_tests, ScanResistanceTests) {
+    clock_cache<int, int> test_cache(100);
+    for(int key = 0; key < 50; ++key) {
+        test_cache.put(key, key);
+    }
+    for(int round = 0; round < 4; ++round) {
+        for(int key = 0; key < 50; ++key) {
+            test_cache.get_or_insert(key, [key] { return key; });
+        }
+        for(int key = 0; key < 60; ++key) {
+            int scanned = 1000 + round * 100 + key;
+            test_cache.get_or_insert(scanned, [scanned] { return scanned; });
+        }
+    }
+    test_cache.reset_stats();
+    for(int key = 0; key < 50; ++key) {
+        test_cache.find(key);
+    }
+    EXPECT_GE(test_cache.stats().hit_rate(), 0.9);
+    EXPECT_THROW((clock_cache<int, int>(0)), std::invalid_argument);
+}
+
+TEST(clock_cache_tests, StorageTests) {
+    clock_cache<int, int> test_cache(5000);
+    EXPECT_EQ(test_cache.storage_capacity(), 5000);
+    for(int key = 0; key < 6000; ++key) {
+        test_cache.put(key, key);
+    }
+    EXPECT_EQ(test_cache.size(), 5000);
+    EXPECT_EQ(test_cache.storage_capacity(), 5000);
+}
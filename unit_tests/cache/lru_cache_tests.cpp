@@ -0,0 +1,134 @@
+#include "gtest/gtest.h"
+#include <list>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "data_structures/src/cache/lru_cache.hpp"
+
+using data_structures::cache::lru_cache;
+
+class lru_cache_tests: public ::testing::Test {
+    public:
+        std::list<std::pair<int, std::string>> test_list;
+        std::unordered_map<int, std::list<std::pair<int, std::string>>::iterator> test_map;
+
+    std::string* reference_find(int key) {
+        auto found = test_map.find(key);
+        if(found == test_map.end()) {
+            return nullptr;
+        }
+        test_list.splice(test_list.begin(), test_list, found->second);
+        return &found->second->second;
+    }
+
+    void reference_put(int key, const std::string& value, unsigned long capacity) {
+        if(std::string* existing = reference_find(key)) {
+            *existing = value;
+            return;
+        }
+        if(test_list.size() == capacity) {
+            test_map.erase(test_list.back().first);
+            test_list.pop_back();
+        }
+        test_list.emplace_front(key, value);
+        test_map[key] = test_list.begin();
+    }
+
+    void run_equality_tests(const lru_cache<int, std::string>& test_cache) {
+        std::vector<std::pair<int, std::string>> order;
+        test_cache.for_each([&](int key, const std::string& value) { order.emplace_back(key, value); });
+        std::vector<std::pair<int, std::string>> expected_order(test_list.begin(), test_list.end());
+        EXPECT_EQ(order, expected_order);
+        EXPECT_EQ(test_cache.size(), test_list.size());
+    }
+
+    void run_random_tests(unsigned long capacity, unsigned int key_range, unsigned int rounds) {
+        test_list.clear();
+        test_map.clear();
+        lru_cache<int, std::string> test_cache(capacity);
+        std::mt19937 generator(capacity + key_range);
+        for(unsigned int round = 0; round < rounds; ++round) {
+            int key = static_cast<int>(generator() % key_range);
+            switch(generator() % 4) {
+                case 0:
+                case 1: {
+                    std::string* expected = reference_find(key);
+                    std::string* found = test_cache.find(key);
+                    ASSERT_EQ(found == nullptr, expected == nullptr);
+                    if(found) {
+                        ASSERT_EQ(*found, *expected);
+                    }
+                    break;
+                }
+                case 2:
+                    reference_put(key, std::to_string(round), capacity);
+                    test_cache.put(key, std::to_string(round));
+                    break;
+                default: {
+                    bool expected = test_map.count(key) != 0;
+                    if(expected) {
+                        test_list.erase(test_map[key]);
+                        test_map.erase(key);
+                    }
+                    ASSERT_EQ(test_cache.erase(key), expected);
+                    break;
+                }
+            }
+        }
+        run_equality_tests(test_cache);
+    }
+};
+
+TEST_F(lru_cache_tests, RandomOperationTests) {
+    run_random_tests(1, 4, 200);
+    run_random_tests(8, 16, 2000);
+    run_random_tests(100, 150, 20000);
+}
+
+TEST_F(lru_cache_tests, StatisticsTests) {
+    lru_cache<int, int> test_cache(2);
+    test_cache.put(1, 10);
+    test_cache.put(2, 20);
+    EXPECT_NE(test_cache.find(1), nullptr);
+    test_cache.put(3, 30);
+    EXPECT_EQ(test_cache.find(2), nullptr);
+    EXPECT_EQ(*test_cache.find(1), 10);
+    EXPECT_EQ(test_cache.stats().hits, 2);
+    EXPECT_EQ(test_cache.stats().misses, 1);
+    EXPECT_EQ(test_cache.stats().insertions, 3);
+    EXPECT_EQ(test_cache.stats().evictions, 1);
+    EXPECT_DOUBLE_EQ(test_cache.stats().hit_rate(), 2.0 / 3.0);
+    EXPECT_EQ(*test_cache.peek(3), 30);
+    test_cache.reset_stats();
+    EXPECT_EQ(test_cache.stats().hits, 0);
+}
+
+TEST_F(lru_cache_tests, StorageTests) {
+    lru_cache<int, int> test_cache(5000);
+    EXPECT_EQ(test_cache.storage_capacity(), 5000);
+    for(int key = 0; key < 6000; ++key) {
+        test_cache.put(key, key);
+    }
+    EXPECT_EQ(test_cache.size(), 5000);
+    EXPECT_EQ(test_cache.storage_capacity(), 5000);
+}
+
+TEST_F(lru_cache_tests, GetOrInsertTests) {
+    lru_cache<int, long> test_cache(16);
+    int calls = 0;
+    auto square = [&](int key) {
+        return test_cache.get_or_insert(key, [&] { ++calls; return static_cast<long>(key) * key; });
+    };
+    for(int round = 0; round < 3; ++round) {
+        for(int key = 0; key < 10; ++key) {
+            EXPECT_EQ(square(key), static_cast<long>(key) * key);
+        }
+    }
+    EXPECT_EQ(calls, 10);
+    EXPECT_EQ(test_cache.stats().hits, 20);
+    EXPECT_THROW((lru_cache<int, int>(0)), std::invalid_argument);
+}
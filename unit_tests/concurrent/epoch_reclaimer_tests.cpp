@@ -0,0 +1,135 @@
+#include "gtest/gtest.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "data_structures/src/concurrent/epoch_reclaimer.hpp"
+
+using data_structures::concurrent::epoch_domain;
+
+namespace {
+    struct tracked_node {
+        static inline std::atomic<long> live{0};
+
+        long value;
+        tracked_node* next = nullptr;
+
+        explicit tracked_node(long initial) : value(initial) {
+            live.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        ~tracked_node() {
+            live.fetch_sub(1, std::memory_order_relaxed);
+        }
+    };
+
+    // A Treiber stack that reads nodes only while pinned, so popped nodes may be retired
+    // while other threads are still looking at them.
+    class epoch_stack {
+        public:
+            void push(epoch_domain::thread_handle& handle, long value) {
+                tracked_node* node = new tracked_node(value);
+                auto guard = handle.pin();
+                node->next = head_.load(std::memory_order_relaxed);
+                while(!head_.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed)) {}
+            }
+
+            bool pop(epoch_domain::thread_handle& handle, long& value) {
+                tracked_node* node;
+                {
+                    auto guard = handle.pin();
+                    node = head_.load(std::memory_order_acquire);
+                    while(node != nullptr && !head_.compare_exchange_weak(node, node->next, std::memory_order_acq_rel, std::memory_order_acquire)) {}
+                    if(node == nullptr) {
+                        return false;
+                    }
+                    value = node->value;
+                }
+                handle.retire(node);
+                return true;
+            }
+
+        private:
+            std::atomic<tracked_node*> head_{nullptr};
+    };
+}
+
+TEST(epoch_reclaimer_tests, PinnedThreadBlocksReclamationTests) {
+    {
+        epoch_domain domain(4);
+        auto writer = domain.register_thread();
+        auto reader = domain.register_thread();
+        {
+            auto reader_guard = reader.pin();
+            auto nested_guard = reader.pin();
+            EXPECT_TRUE(reader.is_pinned());
+            for(int i = 0; i < 10; ++i) {
+                writer.retire(new tracked_node(i));
+            }
+            writer.collect();
+            writer.collect();
+            EXPECT_EQ(tracked_node::live.load(), 10);
+            EXPECT_EQ(writer.pending(), 10);
+        }
+        EXPECT_FALSE(reader.is_pinned());
+        writer.collect();
+        writer.collect();
+        EXPECT_EQ(tracked_node::live.load(), 0);
+        EXPECT_EQ(writer.pending(), 0);
+        EXPECT_GE(domain.epoch(), 2u);
+
+        auto leaving = domain.register_thread();
+        {
+            auto guard = reader.pin();
+            leaving.retire(new tracked_node(1));
+            leaving.collect();
+            leaving = epoch_domain::thread_handle();
+            EXPECT_EQ(tracked_node::live.load(), 1);
+        }
+        writer.collect();
+        writer.collect();
+        writer.collect();
+        EXPECT_EQ(tracked_node::live.load(), 0);
+
+        writer.retire(new tracked_node(2));
+    }
+    EXPECT_EQ(tracked_node::live.load(), 0);
+}
+
+TEST(epoch_reclaimer_tests, ConcurrentStackTests) {
+    constexpr unsigned int thread_count = 4;
+    constexpr long operations = 20000;
+    std::atomic<long> popped_sum{0};
+    {
+        epoch_domain domain;
+        epoch_stack stack;
+        std::vector<std::thread> threads;
+        for(unsigned int thread = 0; thread < thread_count; ++thread) {
+            threads.emplace_back([&, thread]() {
+                auto handle = domain.register_thread();
+                long local_sum = 0;
+                for(long step = 0; step < operations; ++step) {
+                    stack.push(handle, thread * operations + step);
+                    long value;
+                    if(stack.pop(handle, value)) {
+                        local_sum += value;
+                    }
+                }
+                popped_sum.fetch_add(local_sum);
+            });
+        }
+        for(std::thread& thread : threads) {
+            thread.join();
+        }
+        auto handle = domain.register_thread();
+        long value;
+        long remaining = 0;
+        while(stack.pop(handle, value)) {
+            remaining += value;
+        }
+        popped_sum.fetch_add(remaining);
+    }
+    long total = thread_count * operations;
+    EXPECT_EQ(popped_sum.load(), total * (total - 1) / 2);
+    EXPECT_EQ(tracked_node::live.load(), 0);
+}
@@ -0,0 +1,136 @@
+#include "gtest/gtest.h"
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "data_structures/src/concurrent/hazard_pointer.hpp"
+
+using data_structures::concurrent::hazard_domain;
+
+namespace {
+    struct tracked_node {
+        static inline std::atomic<long> live{0};
+
+        long value;
+        tracked_node* next = nullptr;
+
+        explicit tracked_node(long initial) : value(initial) {
+            live.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        ~tracked_node() {
+            live.fetch_sub(1, std::memory_order_relaxed);
+        }
+    };
+
+    // A Treiber stack whose pop protects the head before reading its next pointer.
+    class hazard_stack {
+        public:
+            void push(long value) {
+                tracked_node* node = new tracked_node(value);
+                node->next = head_.load(std::memory_order_relaxed);
+                while(!head_.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed)) {}
+            }
+
+            bool pop(hazard_domain<>::thread_handle& handle, long& value) {
+                while(true) {
+                    tracked_node* node = handle.protect(0, head_);
+                    if(node == nullptr) {
+                        return false;
+                    }
+                    if(head_.compare_exchange_strong(node, node->next, std::memory_order_acq_rel)) {
+                        value = node->value;
+                        handle.reset(0);
+                        handle.retire(node);
+                        return true;
+                    }
+                }
+            }
+
+        private:
+            std::atomic<tracked_node*> head_{nullptr};
+    };
+}
+
+TEST(hazard_pointer_tests, ProtectedObjectSurvivesTests) {
+    {
+        hazard_domain<2> domain(1);
+        auto writer = domain.register_thread();
+        auto reader = domain.register_thread();
+        std::atomic<tracked_node*> shared{new tracked_node(7)};
+
+        tracked_node* seen = reader.protect(1, shared);
+        EXPECT_EQ(seen->value, 7);
+        writer.retire(shared.exchange(new tracked_node(8)));
+        writer.retire(new tracked_node(9));
+        EXPECT_EQ(writer.pending(), 2);
+        EXPECT_EQ(writer.collect(), 1);
+        EXPECT_EQ(seen->value, 7);
+        EXPECT_EQ(tracked_node::live.load(), 2);
+
+        reader.reset(1);
+        EXPECT_EQ(writer.collect(), 1);
+        EXPECT_EQ(tracked_node::live.load(), 1);
+        EXPECT_THROW(reader.reset(2), std::out_of_range);
+
+        reader.protect(0, shared);
+        writer.retire(shared.exchange(nullptr));
+        EXPECT_EQ(writer.collect(), 0);
+        reader = hazard_domain<2>::thread_handle();
+        EXPECT_EQ(writer.collect(), 1);
+        EXPECT_EQ(tracked_node::live.load(), 0);
+
+        auto leaving = domain.register_thread();
+        auto holder = domain.register_thread();
+        tracked_node* held = new tracked_node(10);
+        holder.set(0, held);
+        leaving.retire(held);
+        leaving = hazard_domain<2>::thread_handle();
+        EXPECT_EQ(tracked_node::live.load(), 1);
+        holder.reset_all();
+        EXPECT_EQ(writer.collect(), 1);
+        EXPECT_EQ(tracked_node::live.load(), 0);
+
+        writer.retire(new tracked_node(11));
+    }
+    EXPECT_EQ(tracked_node::live.load(), 0);
+}
+
+TEST(hazard_pointer_tests, ConcurrentStackTests) {
+    constexpr unsigned int thread_count = 4;
+    constexpr long operations = 20000;
+    std::atomic<long> popped_sum{0};
+    {
+        hazard_domain<> domain;
+        hazard_stack stack;
+        std::vector<std::thread> threads;
+        for(unsigned int thread = 0; thread < thread_count; ++thread) {
+            threads.emplace_back([&, thread]() {
+                auto handle = domain.register_thread();
+                long local_sum = 0;
+                for(long step = 0; step < operations; ++step) {
+                    stack.push(thread * operations + step);
+                    long value;
+                    if(stack.pop(handle, value)) {
+                        local_sum += value;
+                    }
+                }
+                popped_sum.fetch_add(local_sum);
+            });
+        }
+        for(std::thread& thread : threads) {
+            thread.join();
+        }
+        auto handle = domain.register_thread();
+        long value;
+        long remaining = 0;
+        while(stack.pop(handle, value)) {
+            remaining += value;
+        }
+        popped_sum.fetch_add(remaining);
+    }
+    long total = thread_count * operations;
+    EXPECT_EQ(popped_sum.load(), total * (total - 1) / 2);
+    EXPECT_EQ(tracked_node::live.load(), 0);
+}
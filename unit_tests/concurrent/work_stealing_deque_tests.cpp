@@ -0,0 +1,79 @@
+#include "gtest/gtest.h"
+#include <atomic>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "data_structures/src/concurrent/work_stealing_deque.hpp"
+
+using data_structures::concurrent::work_stealing_deque;
+
+TEST(work_stealing_deque_tests, OwnerAccessTests) {
+    work_stealing_deque<long> deque(2);
+    EXPECT_TRUE(deque.empty());
+    EXPECT_FALSE(deque.pop().has_value());
+    EXPECT_FALSE(deque.steal().has_value());
+
+    for(long value = 0; value < 100; ++value) {
+        deque.push(value);
+    }
+    EXPECT_EQ(deque.size(), 100);
+    EXPECT_GE(deque.capacity(), 100);
+
+    EXPECT_EQ(deque.pop(), std::optional<long>(99));
+    EXPECT_EQ(deque.steal(), std::optional<long>(0));
+    EXPECT_EQ(deque.steal(), std::optional<long>(1));
+    EXPECT_EQ(deque.pop(), std::optional<long>(98));
+    EXPECT_EQ(deque.size(), 96);
+
+    for(long value = 97; value >= 2; --value) {
+        EXPECT_EQ(deque.pop(), std::optional<long>(value));
+    }
+    EXPECT_TRUE(deque.empty());
+    EXPECT_FALSE(deque.pop().has_value());
+
+    deque.push(5);
+    EXPECT_EQ(deque.steal(), std::optional<long>(5));
+    EXPECT_FALSE(deque.pop().has_value());
+}
+
+TEST(work_stealing_deque_tests, ConcurrentStealTests) {
+    constexpr unsigned int thief_count = 3;
+    constexpr long item_count = 200000;
+    work_stealing_deque<long> deque(4);
+    std::vector<std::atomic<int>> taken(item_count);
+    std::atomic<bool> done{false};
+    std::vector<std::thread> thieves;
+    for(unsigned int thief = 0; thief < thief_count; ++thief) {
+        thieves.emplace_back([&]() {
+            while(!done.load(std::memory_order_acquire) || !deque.empty()) {
+                if(std::optional<long> value = deque.steal()) {
+                    taken[*value].fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+    for(long value = 0; value < item_count; ++value) {
+        deque.push(value);
+        if(value % 3 == 0) {
+            if(std::optional<long> popped = deque.pop()) {
+                taken[*popped].fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    }
+    while(std::optional<long> popped = deque.pop()) {
+        taken[*popped].fetch_add(1, std::memory_order_relaxed);
+    }
+    done.store(true, std::memory_order_release);
+    for(std::thread& thief : thieves) {
+        thief.join();
+    }
+    long missing = 0;
+    long duplicated = 0;
+    for(std::atomic<int>& count : taken) {
+        missing += count.load() == 0;
+        duplicated += count.load() > 1;
+    }
+    EXPECT_EQ(missing, 0);
+    EXPECT_EQ(duplicated, 0);
+}
@@ -0,0 +1,92 @@
+#include "gtest/gtest.h"
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include "data_structures/src/concurrent/work_stealing_pool.hpp"
+
+using data_structures::concurrent::task_group;
+using data_structures::concurrent::work_stealing_pool;
+
+namespace {
+    long fibonacci(work_stealing_pool& pool, long n) {
+        if(n < 12) {
+            return n < 2 ? n : fibonacci(pool, n - 1) + fibonacci(pool, n - 2);
+        }
+        long left = 0;
+        long right = 0;
+        task_group group(pool);
+        group.spawn([&]() { left = fibonacci(pool, n - 1); });
+        right = fibonacci(pool, n - 2);
+        group.sync();
+        return left + right;
+    }
+}
+
+TEST(work_stealing_pool_tests, ForkJoinTests) {
+    work_stealing_pool pool(4);
+    EXPECT_EQ(pool.thread_count(), 4);
+    EXPECT_EQ(fibonacci(pool, 25), 75025);
+
+    std::atomic<long> sum{0};
+    task_group group(pool);
+    for(long value = 1; value <= 1000; ++value) {
+        group.spawn([&sum, value]() { sum.fetch_add(value, std::memory_order_relaxed); });
+    }
+    group.sync();
+    EXPECT_EQ(sum.load(), 500500);
+
+    work_stealing_pool single(1);
+    EXPECT_EQ(fibonacci(single, 20), 6765);
+}
+
+TEST(work_stealing_pool_tests, ParallelForTests) {
+    work_stealing_pool pool(3);
+    constexpr unsigned long count = 100000;
+    std::vector<std::atomic<int>> visits(count);
+    std::atomic<unsigned long> work{0};
+    pool.parallel_for(0, count, [&](unsigned long index) {
+        visits[index].fetch_add(1, std::memory_order_relaxed);
+        unsigned long spin = index % 97 == 0 ? 2000 : 1;
+        unsigned long local = 0;
+        for(unsigned long step = 0; step < spin; ++step) {
+            local += step ^ index;
+        }
+        work.fetch_add(local & 1, std::memory_order_relaxed);
+    });
+    long wrong = 0;
+    for(std::atomic<int>& visit : visits) {
+        wrong += visit.load() != 1;
+    }
+    EXPECT_EQ(wrong, 0);
+
+    std::vector<long> squares(1000);
+    pool.parallel_for(10, 1000, [&](unsigned long index) { squares[index] = static_cast<long>(index * index); }, 7);
+    for(unsigned long index = 0; index < 1000; ++index) {
+        EXPECT_EQ(squares[index], index < 10 ? 0 : static_cast<long>(index * index));
+    }
+    pool.parallel_for(5, 5, [&](unsigned long) { FAIL(); });
+}
+
+TEST(work_stealing_pool_tests, ExceptionTests) {
+    work_stealing_pool pool(2);
+    task_group group(pool);
+    std::atomic<int> finished{0};
+    for(int task = 0; task < 50; ++task) {
+        group.spawn([&finished, task]() {
+            if(task == 17) {
+                throw std::runtime_error("task failed");
+            }
+            finished.fetch_add(1, std::memory_order_relaxed);
+        });
+    }
+    EXPECT_THROW(group.sync(), std::runtime_error);
+    EXPECT_EQ(finished.load(), 49);
+    EXPECT_NO_THROW(group.sync());
+
+    EXPECT_THROW(pool.parallel_for(0, 1000, [](unsigned long index) {
+        if(index == 500) {
+            throw std::logic_error("bad index");
+        }
+    }), std::logic_error);
+}
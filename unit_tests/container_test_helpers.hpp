@@ -0,0 +1,36 @@
+#ifndef DATA_STRUCTURES_UNIT_TESTS_CONTAINER_TEST_HELPERS_HPP
+#define DATA_STRUCTURES_UNIT_TESTS_CONTAINER_TEST_HELPERS_HPP
+
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Shared base for typed sequence container suites, which run over int and std::string and
+// compare each container against a standard one holding the same values.
+template<class T>
+class container_tests: public ::testing::Test {
+    public:
+        T make_value(unsigned int seed) {
+            if constexpr(std::is_same_v<T, std::string>) {
+                return "value " + std::to_string(seed);
+            }
+            else {
+                return static_cast<T>(seed);
+            }
+        }
+
+        // Checks size, indexing and forward iteration against any reference sequence.
+        template<class Container, class Reference>
+        void check_equal(const Container& test_container, const Reference& reference) {
+            ASSERT_EQ(test_container.size(), reference.size());
+            for(unsigned long i = 0; i < reference.size(); ++i) {
+                ASSERT_EQ(test_container[i], reference[i]) << "index " << i;
+            }
+            std::vector<T> iterated(test_container.begin(), test_container.end());
+            ASSERT_TRUE(std::equal(iterated.begin(), iterated.end(), reference.begin(), reference.end()));
+        }
+};
+
+#endif
@@ -0,0 +1,109 @@
+#include "gtest/gtest.h"
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "data_structures/src/filter/blocked_bloom_filter.hpp"
+
+using data_structures::filter::blocked_bloom_filter;
+
+template<class T>
+class blocked_bloom_filter_tests: public ::testing::Test {
+    public:
+        T make_key(std::uint64_t seed) {
+            if constexpr(std::is_same_v<T, std::string>) {
+                return "key-" + std::to_string(seed);
+            }
+            else {
+                return static_cast<T>(seed);
+            }
+        }
+
+    void run_false_positive_tests(unsigned long test_size, double false_positive_rate) {
+        blocked_bloom_filter<T> test_filter(test_size, false_positive_rate);
+        for(std::uint64_t i = 0; i < test_size; ++i) {
+            test_filter.insert(make_key(i * 2));
+        }
+        for(std::uint64_t i = 0; i < test_size; ++i) {
+            ASSERT_TRUE(test_filter.contains(make_key(i * 2)));
+        }
+        unsigned long false_positives = 0;
+        for(std::uint64_t i = 0; i < test_size; ++i) {
+            false_positives += test_filter.contains(make_key(i * 2 + 1));
+        }
+        EXPECT_LE(static_cast<double>(false_positives) / test_size, false_positive_rate * 1.5);
+        EXPECT_EQ(test_filter.size(), test_size);
+    }
+
+    void run_batch_tests(unsigned long test_size) {
+        std::vector<T> inserted;
+        std::vector<T> probed;
+        for(std::uint64_t i = 0; i < test_size; ++i) {
+            inserted.push_back(make_key(i * 3));
+            probed.push_back(make_key(i));
+        }
+        blocked_bloom_filter<T> batch_filter(test_size);
+        blocked_bloom_filter<T> single_filter(test_size);
+        batch_filter.insert_batch(std::span<const T>(inserted));
+        for(const T& key : inserted) {
+            single_filter.insert(key);
+        }
+        std::unique_ptr<bool[]> results(new bool[test_size]);
+        unsigned long found = batch_filter.contains_batch(std::span<const T>(probed), std::span<bool>(results.get(), test_size));
+        unsigned long expected_found = 0;
+        for(unsigned long i = 0; i < test_size; ++i) {
+            ASSERT_EQ(results[i], single_filter.contains(probed[i]));
+            expected_found += results[i];
+        }
+        EXPECT_EQ(found, expected_found);
+        EXPECT_GE(found, (test_size + 2) / 3);
+    }
+};
+
+TYPED_TEST_SUITE_P(blocked_bloom_filter_tests);
+
+TYPED_TEST_P(blocked_bloom_filter_tests, FalsePositiveTests) {
+    this->run_false_positive_tests(1, 0.01);
+    this->run_false_positive_tests(20000, 0.01);
+    this->run_false_positive_tests(20000, 0.001);
+}
+
+TYPED_TEST_P(blocked_bloom_filter_tests, BatchTests) {
+    this->run_batch_tests(0);
+    this->run_batch_tests(7);
+    this->run_batch_tests(1000);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(blocked_bloom_filter_tests,
+                            FalsePositiveTests,
+                            BatchTests
+                            );
+
+using blocked_bloom_filter_test_types = ::testing::Types<std::uint64_t, int, std::string>;
+INSTANTIATE_TYPED_TEST_SUITE_P(BlockedBloomFilter, blocked_bloom_filter_tests, blocked_bloom_filter_test_types);
+
+TEST(blocked_bloom_filter_layout_tests, MergeAndClearTests) {
+    blocked_bloom_filter<int> first(1000);
+    blocked_bloom_filter<int> second(1000);
+    for(int i = 0; i < 500; ++i) {
+        first.insert(i);
+        second.insert(i + 500);
+    }
+    first.merge(second);
+    for(int i = 0; i < 1000; ++i) {
+        EXPECT_TRUE(first.contains(i));
+    }
+    first.clear();
+    EXPECT_EQ(first.size(), 0);
+    EXPECT_FALSE(first.contains(1));
+    EXPECT_EQ(first.size_in_bytes(), first.block_count() * 32);
+
+    blocked_bloom_filter<int> larger(100000);
+    EXPECT_THROW(first.merge(larger), std::invalid_argument);
+    EXPECT_THROW(blocked_bloom_filter<int>(10, 0.0), std::invalid_argument);
+    EXPECT_THROW(blocked_bloom_filter<int>(10, 1.0), std::invalid_argument);
+}
@@ -0,0 +1,110 @@
+#include "gtest/gtest.h"
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <set>
+#include <span>
+#include <vector>
+
+#include "data_structures/src/filter/cuckoo_filter.hpp"
+
+using data_structures::filter::cuckoo_filter;
+
+class cuckoo_filter_tests: public ::testing::Test {
+    public:
+        void run_membership_tests(unsigned long test_size) {
+            cuckoo_filter<std::uint64_t> test_filter(test_size);
+            for(std::uint64_t i = 0; i < test_size; ++i) {
+                ASSERT_TRUE(test_filter.insert(i * 2));
+            }
+            EXPECT_EQ(test_filter.size(), test_size);
+            for(std::uint64_t i = 0; i < test_size; ++i) {
+                ASSERT_TRUE(test_filter.contains(i * 2));
+            }
+            unsigned long false_positives = 0;
+            for(std::uint64_t i = 0; i < test_size; ++i) {
+                false_positives += test_filter.contains(i * 2 + 1);
+            }
+            EXPECT_LE(false_positives, test_size / 1000 + 1);
+        }
+
+        void run_erase_tests(unsigned long test_size) {
+            cuckoo_filter<std::uint64_t> test_filter(test_size);
+            std::set<std::uint64_t> present;
+            std::mt19937_64 generator(test_size);
+            for(unsigned long round = 0; round < test_size * 4; ++round) {
+                std::uint64_t key = generator() % (test_size * 2);
+                if(present.count(key)) {
+                    ASSERT_TRUE(test_filter.erase(key));
+                    present.erase(key);
+                }
+                else if(present.size() < test_size) {
+                    ASSERT_TRUE(test_filter.insert(key));
+                    present.insert(key);
+                }
+            }
+            EXPECT_EQ(test_filter.size(), present.size());
+            for(std::uint64_t key : present) {
+                ASSERT_TRUE(test_filter.contains(key));
+            }
+        }
+};
+
+TEST_F(cuckoo_filter_tests, MembershipTests) {
+    run_membership_tests(1);
+    run_membership_tests(100);
+    run_membership_tests(50000);
+}
+
+TEST_F(cuckoo_filter_tests, EraseTests) {
+    run_erase_tests(10);
+    run_erase_tests(5000);
+}
+
+TEST_F(cuckoo_filter_tests, DuplicateTests) {
+    cuckoo_filter<int> test_filter(100);
+    ASSERT_TRUE(test_filter.insert(7));
+    ASSERT_TRUE(test_filter.insert(7));
+    EXPECT_TRUE(test_filter.erase(7));
+    EXPECT_TRUE(test_filter.contains(7));
+    EXPECT_TRUE(test_filter.erase(7));
+    EXPECT_FALSE(test_filter.contains(7));
+    EXPECT_FALSE(test_filter.erase(7));
+    EXPECT_EQ(test_filter.size(), 0);
+}
+
+TEST_F(cuckoo_filter_tests, OverflowTests) {
+    cuckoo_filter<std::uint64_t> test_filter(64);
+    std::vector<std::uint64_t> inserted;
+    for(std::uint64_t key = 0; test_filter.insert(key); ++key) {
+        inserted.push_back(key);
+    }
+    EXPECT_TRUE(test_filter.full());
+    EXPECT_GT(test_filter.load_factor(), 0.8);
+    for(std::uint64_t key : inserted) {
+        ASSERT_TRUE(test_filter.contains(key));
+    }
+    ASSERT_TRUE(test_filter.erase(inserted.front()));
+    EXPECT_FALSE(test_filter.full());
+    for(unsigned long i = 1; i < inserted.size(); ++i) {
+        ASSERT_TRUE(test_filter.contains(inserted[i]));
+    }
+}
+
+TEST_F(cuckoo_filter_tests, BatchTests) {
+    cuckoo_filter<std::uint64_t> test_filter(1000);
+    std::vector<std::uint64_t> probed;
+    for(std::uint64_t i = 0; i < 1000; ++i) {
+        test_filter.insert(i * 5);
+        probed.push_back(i);
+    }
+    std::unique_ptr<bool[]> results(new bool[probed.size()]);
+    unsigned long found = test_filter.contains_batch(std::span<const std::uint64_t>(probed), std::span<bool>(results.get(), probed.size()));
+    unsigned long expected_found = 0;
+    for(unsigned long i = 0; i < probed.size(); ++i) {
+        ASSERT_EQ(results[i], test_filter.contains(probed[i]));
+        expected_found += results[i];
+    }
+    EXPECT_EQ(found, expected_found);
+    EXPECT_GE(found, 200);
+}
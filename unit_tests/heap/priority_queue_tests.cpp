@@ -0,0 +1,242 @@
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "data_structures/src/heap/d_ary_heap.hpp"
+#include "data_structures/src/heap/indexed_heap.hpp"
+#include "data_structures/src/heap/radix_heap.hpp"
+
+using data_structures::heap::d_ary_heap;
+using data_structures::heap::indexed_heap;
+using data_structures::heap::priority_queue;
+using data_structures::heap::radix_heap;
+
+template<class Heap>
+class d_ary_heap_tests: public ::testing::Test {
+    public:
+        using value_type = typename Heap::value_type;
+        using compare_type = typename Heap::value_compare;
+
+        Heap test_heap;
+        std::priority_queue<value_type, std::vector<value_type>, compare_type> test_queue;
+
+    value_type make_value(std::mt19937& generator) {
+        if constexpr(std::is_same_v<value_type, std::string>) {
+            return std::to_string(generator() % 1000);
+        }
+        else {
+            return static_cast<value_type>(generator() % 1000);
+        }
+    }
+
+    void run_equality_tests() {
+        ASSERT_EQ(test_heap.size(), test_queue.size());
+        while(!test_queue.empty()) {
+            ASSERT_EQ(test_heap.top(), test_queue.top());
+            test_heap.pop();
+            test_queue.pop();
+        }
+        EXPECT_TRUE(test_heap.empty());
+    }
+
+    void run_push_pop_tests(unsigned int test_size) {
+        std::mt19937 generator(test_size);
+        for(unsigned int i = 0; i < test_size; ++i) {
+            value_type value = make_value(generator);
+            test_heap.push(value);
+            test_queue.push(value);
+            if(i % 3 == 2) {
+                ASSERT_EQ(test_heap.top(), test_queue.top());
+                test_heap.pop();
+                test_queue.pop();
+            }
+        }
+        run_equality_tests();
+    }
+
+    void run_construction_tests(unsigned int test_size) {
+        std::mt19937 generator(test_size);
+        std::vector<value_type> values;
+        for(unsigned int i = 0; i < test_size; ++i) {
+            values.push_back(make_value(generator));
+        }
+        test_heap = Heap(values.begin(), values.end());
+        test_queue = decltype(test_queue)(values.begin(), values.end());
+        run_equality_tests();
+    }
+};
+
+TYPED_TEST_SUITE_P(d_ary_heap_tests);
+
+TYPED_TEST_P(d_ary_heap_tests, PushPopTests) {
+    this->run_push_pop_tests(1);
+    this->run_push_pop_tests(10);
+    this->run_push_pop_tests(1000);
+}
+
+TYPED_TEST_P(d_ary_heap_tests, ConstructionTests) {
+    this->run_construction_tests(0);
+    this->run_construction_tests(7);
+    this->run_construction_tests(1000);
+}
+
+TYPED_TEST_P(d_ary_heap_tests, EmptyHeapTests) {
+    EXPECT_THROW(this->test_heap.top(), std::out_of_range);
+    EXPECT_THROW(this->test_heap.pop(), std::out_of_range);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(d_ary_heap_tests,
+                            PushPopTests,
+                            ConstructionTests,
+                            EmptyHeapTests
+                            );
+
+using d_ary_heap_test_types = ::testing::Types<d_ary_heap<int, 2>,
+                                               priority_queue<int>,
+                                               d_ary_heap<int, 8, std::greater<int>>,
+                                               d_ary_heap<std::string, 3>>;
+INSTANTIATE_TYPED_TEST_SUITE_P(DAryHeap, d_ary_heap_tests, d_ary_heap_test_types);
+
+class indexed_heap_tests: public ::testing::Test {
+    public:
+        std::vector<std::vector<std::pair<unsigned long, std::uint64_t>>> make_graph(unsigned int num_vertices, unsigned int num_edges) {
+            std::mt19937 generator(num_vertices);
+            std::vector<std::vector<std::pair<unsigned long, std::uint64_t>>> graph(num_vertices);
+            for(unsigned int i = 0; i < num_edges; ++i) {
+                graph[generator() % num_vertices].emplace_back(generator() % num_vertices, generator() % 100);
+            }
+            return graph;
+        }
+
+        template<class Graph>
+        std::vector<std::uint64_t> reference_distances(const Graph& graph) {
+            std::vector<std::uint64_t> distances(graph.size(), UINT64_MAX);
+            std::set<std::pair<std::uint64_t, unsigned long>> frontier;
+            distances[0] = 0;
+            frontier.emplace(0, 0);
+            while(!frontier.empty()) {
+                auto [distance, vertex] = *frontier.begin();
+                frontier.erase(frontier.begin());
+                for(auto [target, weight] : graph[vertex]) {
+                    if(distance + weight < distances[target]) {
+                        frontier.erase({distances[target], target});
+                        distances[target] = distance + weight;
+                        frontier.emplace(distances[target], target);
+                    }
+                }
+            }
+            return distances;
+        }
+};
+
+TEST_F(indexed_heap_tests, ShortestPathTests) {
+    auto graph = make_graph(500, 4000);
+    std::vector<std::uint64_t> expected = reference_distances(graph);
+
+    std::vector<std::uint64_t> distances(graph.size(), UINT64_MAX);
+    indexed_heap<std::uint64_t> frontier(graph.size());
+    distances[0] = 0;
+    frontier.push(0, 0);
+    while(!frontier.empty()) {
+        unsigned long vertex = frontier.top_id();
+        std::uint64_t distance = frontier.top_priority();
+        frontier.pop();
+        for(auto [target, weight] : graph[vertex]) {
+            if(distance + weight < distances[target]) {
+                distances[target] = distance + weight;
+                if(frontier.contains(target)) {
+                    frontier.decrease_key(target, distances[target]);
+                }
+                else {
+                    frontier.push(target, distances[target]);
+                }
+            }
+        }
+    }
+    EXPECT_EQ(distances, expected);
+}
+
+TEST_F(indexed_heap_tests, UpdateAndEraseTests) {
+    indexed_heap<int> test_heap(10);
+    std::set<std::pair<int, unsigned long>> test_set;
+    std::mt19937 generator(42);
+    for(unsigned long id = 0; id < 10; ++id) {
+        int priority = generator() % 50;
+        test_heap.push(id, priority);
+        test_set.emplace(priority, id);
+    }
+    for(unsigned int round = 0; round < 100; ++round) {
+        unsigned long id = generator() % 10;
+        int priority = generator() % 50;
+        test_set.erase({test_heap.priority(id), id});
+        test_heap.push_or_update(id, priority);
+        test_set.emplace(priority, id);
+        EXPECT_EQ(test_heap.top_priority(), test_set.begin()->first);
+    }
+
+    unsigned long erased_id = test_set.rbegin()->second;
+    test_set.erase({test_heap.priority(erased_id), erased_id});
+    test_heap.erase(erased_id);
+    EXPECT_FALSE(test_heap.contains(erased_id));
+    while(!test_set.empty()) {
+        EXPECT_EQ(test_heap.top_priority(), test_set.begin()->first);
+        test_set.erase(test_set.begin());
+        test_heap.pop();
+    }
+    EXPECT_TRUE(test_heap.empty());
+}
+
+TEST_F(indexed_heap_tests, InvalidOperationTests) {
+    indexed_heap<int> test_heap(4);
+    test_heap.push(1, 10);
+    EXPECT_THROW(test_heap.push(1, 5), std::invalid_argument);
+    EXPECT_THROW(test_heap.push(4, 5), std::out_of_range);
+    EXPECT_THROW(test_heap.decrease_key(1, 20), std::invalid_argument);
+    EXPECT_THROW(test_heap.increase_key(1, 5), std::invalid_argument);
+    EXPECT_THROW(test_heap.decrease_key(2, 5), std::invalid_argument);
+    test_heap.increase_key(1, 20);
+    EXPECT_EQ(test_heap.top_priority(), 20);
+}
+
+TEST(radix_heap_tests, MonotonePushPopTests) {
+    radix_heap<std::uint32_t, int> test_heap;
+    std::priority_queue<std::uint32_t, std::vector<std::uint32_t>, std::greater<std::uint32_t>> test_queue;
+    std::mt19937 generator(7);
+    for(unsigned int round = 0; round < 2000; ++round) {
+        unsigned int pushes = generator() % 4;
+        for(unsigned int i = 0; i < pushes; ++i) {
+            std::uint32_t key = test_heap.last_key() + generator() % 100000;
+            test_heap.push(key, static_cast<int>(key % 97));
+            test_queue.push(key);
+        }
+        if(!test_queue.empty()) {
+            ASSERT_EQ(test_heap.top_key(), test_queue.top());
+            auto [key, value] = test_heap.extract_top();
+            EXPECT_EQ(key, test_queue.top());
+            EXPECT_EQ(value, static_cast<int>(key % 97));
+            test_queue.pop();
+        }
+        ASSERT_EQ(test_heap.size(), test_queue.size());
+    }
+    EXPECT_THROW(test_heap.push(test_heap.last_key() - 1, 0), std::invalid_argument);
+}
+
+TEST(radix_heap_tests, ExtremeKeyTests) {
+    radix_heap<std::uint64_t, std::string> test_heap;
+    test_heap.push(UINT64_MAX, "max");
+    test_heap.push(0, "zero");
+    test_heap.push(1ULL << 63, "high");
+    EXPECT_EQ(test_heap.extract_top().second, "zero");
+    EXPECT_EQ(test_heap.extract_top().second, "high");
+    EXPECT_EQ(test_heap.extract_top().second, "max");
+    EXPECT_TRUE(test_heap.empty());
+    EXPECT_THROW(test_heap.pop(), std::out_of_range);
+}
@@ -0,0 +1,177 @@
+#include "gtest/gtest.h"
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "data_structures/src/linear/bit_array.hpp"
+
+using data_structures::linear::bit_array;
+
+class bit_array_tests: public ::testing::Test {
+    public:
+        bit_array test_bits;
+        std::vector<bool> test_vector;
+
+    void fill_random(unsigned long test_size, unsigned int density) {
+        std::mt19937 generator(static_cast<unsigned int>(test_size) + density);
+        test_bits.clear();
+        test_vector.clear();
+        for(unsigned long i = 0; i < test_size; ++i) {
+            bool value = generator() % 100 < density;
+            test_bits.push_back(value);
+            test_vector.push_back(value);
+        }
+    }
+
+    void run_equality_tests() {
+        ASSERT_EQ(test_bits.size(), test_vector.size());
+        unsigned long expected_count = 0;
+        for(unsigned long i = 0; i < test_vector.size(); ++i) {
+            ASSERT_EQ(test_bits.test(i), test_vector[i]);
+            expected_count += test_vector[i];
+        }
+        EXPECT_EQ(test_bits.count(), expected_count);
+        EXPECT_EQ(test_bits.any(), expected_count != 0);
+        EXPECT_EQ(test_bits.all(), expected_count == test_vector.size());
+    }
+
+    void run_modification_tests(unsigned long test_size) {
+        fill_random(test_size, 50);
+        std::mt19937 generator(static_cast<unsigned int>(test_size));
+        for(unsigned long round = 0; round < test_size; ++round) {
+            unsigned long index = generator() % test_size;
+            switch(generator() % 3) {
+                case 0:
+                    test_bits.set(index);
+                    test_vector[index] = true;
+                    break;
+                case 1:
+                    test_bits.reset(index);
+                    test_vector[index] = false;
+                    break;
+                default:
+                    test_bits.flip(index);
+                    test_vector[index] = !test_vector[index];
+                    break;
+            }
+        }
+        run_equality_tests();
+    }
+
+    void run_resize_tests(unsigned long first_size, unsigned long second_size, bool value) {
+        fill_random(first_size, 30);
+        test_bits.resize(second_size, value);
+        test_vector.resize(second_size, value);
+        run_equality_tests();
+    }
+
+    void run_find_tests(unsigned long test_size, unsigned int density) {
+        fill_random(test_size, density);
+        std::vector<unsigned long> expected;
+        for(unsigned long i = 0; i < test_vector.size(); ++i) {
+            if(test_vector[i]) {
+                expected.push_back(i);
+            }
+        }
+        std::vector<unsigned long> found;
+        for(unsigned long i = test_bits.find_first(); i != bit_array::npos; i = test_bits.find_next(i)) {
+            found.push_back(i);
+        }
+        EXPECT_EQ(found, expected);
+    }
+
+    void run_rank_select_tests(unsigned long test_size, unsigned int density) {
+        fill_random(test_size, density);
+        test_bits.build_rank_index();
+        unsigned long running_rank = 0;
+        for(unsigned long i = 0; i < test_vector.size(); ++i) {
+            ASSERT_EQ(test_bits.rank(i), running_rank);
+            if(test_vector[i]) {
+                ASSERT_EQ(test_bits.select(running_rank), i);
+                ++running_rank;
+            }
+        }
+        EXPECT_EQ(test_bits.rank(test_size), running_rank);
+        EXPECT_EQ(test_bits.select(running_rank), bit_array::npos);
+    }
+};
+
+TEST_F(bit_array_tests, ModificationTests) {
+    run_modification_tests(1);
+    run_modification_tests(64);
+    run_modification_tests(1000);
+}
+
+TEST_F(bit_array_tests, ResizeTests) {
+    run_resize_tests(0, 130, true);
+    run_resize_tests(70, 200, true);
+    run_resize_tests(200, 70, false);
+    run_resize_tests(70, 70, true);
+    bit_array all_set(100, true);
+    EXPECT_TRUE(all_set.all());
+    all_set.flip_all();
+    EXPECT_TRUE(all_set.none());
+    all_set.set_all();
+    EXPECT_EQ(all_set.count(), 100);
+}
+
+TEST_F(bit_array_tests, BulkOperationTests) {
+    bit_array first(300);
+    bit_array second(300);
+    std::vector<bool> first_vector(300);
+    std::vector<bool> second_vector(300);
+    std::mt19937 generator(3);
+    for(unsigned long i = 0; i < 300; ++i) {
+        first_vector[i] = generator() % 2;
+        second_vector[i] = generator() % 2;
+        first.set(i, first_vector[i]);
+        second.set(i, second_vector[i]);
+    }
+
+    bit_array and_result = first;
+    and_result &= second;
+    bit_array or_result = first;
+    or_result |= second;
+    bit_array xor_result = first;
+    xor_result ^= second;
+    bit_array and_not_result = first;
+    and_not_result.and_not(second);
+    for(unsigned long i = 0; i < 300; ++i) {
+        EXPECT_EQ(and_result[i], first_vector[i] && second_vector[i]);
+        EXPECT_EQ(or_result[i], first_vector[i] || second_vector[i]);
+        EXPECT_EQ(xor_result[i], first_vector[i] != second_vector[i]);
+        EXPECT_EQ(and_not_result[i], first_vector[i] && !second_vector[i]);
+    }
+    EXPECT_TRUE(xor_result == (bit_array(or_result).and_not(and_result)));
+
+    bit_array shorter(299);
+    EXPECT_THROW(first &= shorter, std::invalid_argument);
+}
+
+TEST_F(bit_array_tests, FindTests) {
+    run_find_tests(0, 50);
+    run_find_tests(1000, 0);
+    run_find_tests(1000, 1);
+    run_find_tests(1000, 50);
+    run_find_tests(1000, 100);
+}
+
+TEST_F(bit_array_tests, RankSelectTests) {
+    run_rank_select_tests(0, 50);
+    run_rank_select_tests(63, 50);
+    run_rank_select_tests(5000, 2);
+    run_rank_select_tests(5000, 50);
+    run_rank_select_tests(5000, 100);
+}
+
+TEST_F(bit_array_tests, InvalidOperationTests) {
+    bit_array bits(10);
+    EXPECT_THROW(bits.test(10), std::out_of_range);
+    EXPECT_THROW(bits.set(10), std::out_of_range);
+    EXPECT_THROW(bits.rank(0), std::logic_error);
+    bits.build_rank_index();
+    EXPECT_TRUE(bits.has_rank_index());
+    bits.set(3);
+    EXPECT_FALSE(bits.has_rank_index());
+    EXPECT_THROW(bits.select(0), std::logic_error);
+}
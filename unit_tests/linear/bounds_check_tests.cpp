@@ -0,0 +1,92 @@
+#include "gtest/gtest.h"
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+#include "data_structures/src/linear/dynamic_array.hpp"
+
+using data_structures::linear::abort_checked;
+using data_structures::linear::assert_checked;
+using data_structures::linear::default_bounds_check;
+using data_structures::linear::dynamic_array;
+using data_structures::linear::no_instrumentation;
+using data_structures::linear::throw_checked;
+using data_structures::linear::unchecked;
+
+template<class BoundsCheck>
+using checked_array = dynamic_array<int, std::allocator<int>, no_instrumentation, BoundsCheck>;
+
+template<class BoundsCheck>
+checked_array<BoundsCheck> make_checked_array(int num_elements) {
+    checked_array<BoundsCheck> test_arr;
+    for(int i = 0; i < num_elements; ++i) {
+        test_arr.push_back(i * 2);
+    }
+    return test_arr;
+}
+
+template<class BoundsCheck>
+class bounds_check_tests: public ::testing::Test {
+    public:
+    void run_in_range_tests(int num_elements) {
+        checked_array<BoundsCheck> test_arr = make_checked_array<BoundsCheck>(num_elements);
+        const checked_array<BoundsCheck>& const_arr = test_arr;
+        for(int i = 0; i < num_elements; ++i) {
+            EXPECT_EQ(test_arr.at(i), i * 2);
+            EXPECT_EQ(test_arr[i], i * 2);
+            EXPECT_EQ(const_arr.at(i), i * 2);
+        }
+        EXPECT_EQ(test_arr.front(), 0);
+        EXPECT_EQ(test_arr.back(), (num_elements - 1) * 2);
+        test_arr.erase(test_arr.begin());
+        EXPECT_EQ(test_arr.size(), num_elements - 1);
+    }
+};
+
+TYPED_TEST_SUITE_P(bounds_check_tests);
+
+TYPED_TEST_P(bounds_check_tests, InRangeTests) {
+    this->run_in_range_tests(1);
+    this->run_in_range_tests(20);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(bounds_check_tests, InRangeTests);
+
+using bounds_check_test_types = ::testing::Types<unchecked, assert_checked, throw_checked, abort_checked>;
+INSTANTIATE_TYPED_TEST_SUITE_P(BoundsCheck, bounds_check_tests, bounds_check_test_types);
+
+TEST(bounds_check_policy_tests, DefaultPolicyTests) {
+    EXPECT_TRUE((std::is_same_v<default_bounds_check, throw_checked>));
+    EXPECT_TRUE((std::is_same_v<dynamic_array<int>::bounds_check_type, throw_checked>));
+}
+
+TEST(bounds_check_policy_tests, ThrowPolicyTests) {
+    checked_array<throw_checked> test_arr = make_checked_array<throw_checked>(5);
+    EXPECT_THROW(test_arr.at(5), std::out_of_range);
+    EXPECT_THROW(test_arr[100], std::out_of_range);
+
+    checked_array<throw_checked> empty_arr;
+    EXPECT_THROW(empty_arr.front(), std::out_of_range);
+    EXPECT_THROW(empty_arr.erase(empty_arr.begin()), std::runtime_error);
+}
+
+TEST(bounds_check_policy_tests, AbortPolicyTests) {
+    checked_array<abort_checked> test_arr = make_checked_array<abort_checked>(5);
+    EXPECT_DEATH(test_arr.at(5), "Index 5 is out of range for size 5");
+
+    checked_array<abort_checked> empty_arr;
+    EXPECT_DEATH(empty_arr.erase(empty_arr.begin()), "empty");
+}
+
+#ifndef NDEBUG
+TEST(bounds_check_policy_tests, AssertPolicyTests) {
+    checked_array<assert_checked> test_arr = make_checked_array<assert_checked>(5);
+    EXPECT_DEATH(test_arr.at(7), "out of range");
+}
+#endif
+
+TEST(bounds_check_policy_tests, UncheckedPolicyTests) {
+    EXPECT_TRUE(noexcept(unchecked::check_index(1, 0)));
+    EXPECT_TRUE(noexcept(unchecked::check_not_empty(0)));
+    EXPECT_FALSE(noexcept(throw_checked::check_index(1, 0)));
+}
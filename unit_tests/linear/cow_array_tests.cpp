@@ -0,0 +1,167 @@
+#include "gtest/gtest.h"
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "data_structures/src/linear/cow_array.hpp"
+#include "unit_tests/container_test_helpers.hpp"
+
+using data_structures::linear::cow_array;
+
+template<class T>
+class cow_array_tests: public container_tests<T> {
+    public:
+        using container_tests<T>::make_value;
+        using container_tests<T>::check_equal;
+
+    // Mutates random copies out of a set of arrays that share buffers and checks that no
+    // mutation leaks into another copy.
+    void run_random_tests(unsigned int rounds) {
+        std::vector<cow_array<T>> arrays(1);
+        std::vector<std::vector<T>> references(1);
+        std::mt19937 generator(rounds);
+        for(unsigned int round = 0; round < rounds; ++round) {
+            unsigned long target = generator() % arrays.size();
+            cow_array<T>& test_array = arrays[target];
+            std::vector<T>& reference = references[target];
+            switch(generator() % 6) {
+                case 0:
+                    if(arrays.size() < 16) {
+                        arrays.push_back(test_array);
+                        references.push_back(reference);
+                    }
+                    break;
+                case 1:
+                    if(!reference.empty()) {
+                        unsigned long index = generator() % reference.size();
+                        test_array.set(index, make_value(round));
+                        reference[index] = make_value(round);
+                    }
+                    break;
+                case 2:
+                    if(!reference.empty()) {
+                        test_array.pop_back();
+                        reference.pop_back();
+                    }
+                    break;
+                case 3:
+                    if(generator() % 8 == 0) {
+                        test_array.clear();
+                        reference.clear();
+                    }
+                    break;
+                default:
+                    test_array.push_back(make_value(round));
+                    reference.push_back(make_value(round));
+                    break;
+            }
+        }
+        for(unsigned long i = 0; i < arrays.size(); ++i) {
+            check_equal(arrays[i], references[i]);
+        }
+    }
+};
+
+TYPED_TEST_SUITE_P(cow_array_tests);
+
+TYPED_TEST_P(cow_array_tests, RandomTests) {
+    this->run_random_tests(100);
+    this->run_random_tests(20000);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(cow_array_tests,
+                            RandomTests
+                            );
+
+using cow_array_test_types = ::testing::Types<int, std::string>;
+INSTANTIATE_TYPED_TEST_SUITE_P(CowArray, cow_array_tests, cow_array_test_types);
+
+TEST(cow_array_sharing_tests, ShareUntilWriteTests) {
+    cow_array<int> original = {1, 2, 3, 4};
+    EXPECT_EQ(original.use_count(), 1);
+    EXPECT_FALSE(original.is_shared());
+
+    cow_array<int> copy = original;
+    EXPECT_EQ(original.use_count(), 2);
+    EXPECT_EQ(copy.data(), original.data());
+    EXPECT_TRUE(copy == original);
+
+    copy.set(0, 10);
+    EXPECT_NE(copy.data(), original.data());
+    EXPECT_EQ(original.use_count(), 1);
+    EXPECT_EQ(copy.use_count(), 1);
+    EXPECT_EQ(original[0], 1);
+    EXPECT_EQ(copy[0], 10);
+    const int* unique_data = copy.data();
+    copy.mutable_at(1) = 20;
+    EXPECT_EQ(copy.data(), unique_data);
+
+    cow_array<int> second = original;
+    second.unshare();
+    EXPECT_NE(second.data(), original.data());
+    EXPECT_TRUE(second == original);
+    EXPECT_EQ(second.use_count(), 1);
+
+    cow_array<int> cleared = original;
+    cleared.clear();
+    EXPECT_TRUE(cleared.empty());
+    EXPECT_EQ(cleared.use_count(), 0);
+    EXPECT_EQ(original.size(), 4);
+
+    cow_array<int> empty;
+    EXPECT_EQ(empty.use_count(), 0);
+    EXPECT_EQ(empty.begin(), empty.end());
+    EXPECT_THROW(empty.at(0), std::out_of_range);
+    EXPECT_THROW(empty.pop_back(), std::out_of_range);
+    EXPECT_THROW(empty.set(0, 1), std::out_of_range);
+
+    cow_array<int> moved = std::move(copy);
+    EXPECT_EQ(moved[1], 20);
+    EXPECT_EQ(copy.use_count(), 0);
+}
+
+TEST(cow_array_sharing_tests, UnshareCapacityTests) {
+    cow_array<int> original(5000, 7);
+    cow_array<int> written = original;
+    written.set(0, 1);
+    EXPECT_EQ(written.capacity(), 5000);
+    cow_array<int> appended = original;
+    appended.push_back(8);
+    EXPECT_EQ(appended.capacity(), 5001);
+    EXPECT_EQ(appended[5000], 8);
+    EXPECT_EQ(original.size(), 5000);
+}
+
+TEST(cow_array_sharing_tests, ConcurrentCopyTests) {
+    cow_array<int> base;
+    for(int i = 0; i < 10000; ++i) {
+        base.push_back(i);
+    }
+    std::vector<std::thread> threads;
+    std::vector<long> sums(4, 0);
+    for(unsigned int thread = 0; thread < sums.size(); ++thread) {
+        threads.emplace_back([&base, &sums, thread]() {
+            for(int pass = 0; pass < 200; ++pass) {
+                cow_array<int> copy = base;
+                if(pass % 10 == 0) {
+                    copy.set(static_cast<unsigned long>(pass), -1);
+                    copy.set(static_cast<unsigned long>(pass), pass);
+                }
+                long sum = 0;
+                for(int value : copy) {
+                    sum += value;
+                }
+                sums[thread] = sum;
+            }
+        });
+    }
+    for(std::thread& thread : threads) {
+        thread.join();
+    }
+    for(long sum : sums) {
+        EXPECT_EQ(sum, 9999L * 10000 / 2);
+    }
+    EXPECT_EQ(base.use_count(), 1);
+}
@@ -0,0 +1,140 @@
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <deque>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "data_structures/src/linear/deque.hpp"
+#include "unit_tests/container_test_helpers.hpp"
+
+using data_structures::linear::deque;
+
+template<class T>
+class deque_tests: public container_tests<T> {
+    public:
+        using container_tests<T>::make_value;
+
+    template<class Deque>
+    void check_equal(const Deque& test_deque, const std::deque<T>& reference) {
+        ASSERT_NO_FATAL_FAILURE(container_tests<T>::check_equal(test_deque, reference));
+        std::vector<T> reversed(test_deque.crbegin(), test_deque.crend());
+        ASSERT_TRUE(std::equal(reversed.begin(), reversed.end(), reference.rbegin(), reference.rend()));
+        if(!reference.empty()) {
+            ASSERT_EQ(test_deque.front(), reference.front());
+            ASSERT_EQ(test_deque.back(), reference.back());
+        }
+    }
+
+    // Pushes and pops at random ends with phases that favour growing at the front, growing
+    // at the back and draining, so the map recentres and grows and blocks are freed.
+    template<unsigned long BlockSize>
+    void run_random_tests(unsigned int rounds) {
+        deque<T, BlockSize> test_deque;
+        std::deque<T> reference;
+        std::mt19937 generator(rounds + BlockSize);
+        for(unsigned int round = 0; round < rounds; ++round) {
+            unsigned int phase = (round / (rounds / 6 + 1)) % 3;
+            bool grow = phase == 2 ? generator() % 4 == 0 : generator() % 4 != 0;
+            bool front = phase == 0 ? generator() % 4 != 0 : generator() % 4 == 0;
+            if(grow || reference.empty()) {
+                T value = make_value(round);
+                if(front) {
+                    test_deque.push_front(value);
+                    reference.push_front(value);
+                }
+                else {
+                    test_deque.push_back(value);
+                    reference.push_back(value);
+                }
+            }
+            else if(front) {
+                test_deque.pop_front();
+                reference.pop_front();
+            }
+            else {
+                test_deque.pop_back();
+                reference.pop_back();
+            }
+            if(round % 97 == 0) {
+                check_equal(test_deque, reference);
+            }
+        }
+        check_equal(test_deque, reference);
+
+        deque<T, BlockSize> copy = test_deque;
+        check_equal(copy, reference);
+        EXPECT_TRUE(copy == test_deque);
+        deque<T, BlockSize> moved = std::move(copy);
+        check_equal(moved, reference);
+        EXPECT_TRUE(copy.empty());
+
+        test_deque.clear();
+        reference.clear();
+        check_equal(test_deque, reference);
+        test_deque.push_front(make_value(1));
+        test_deque.push_back(make_value(2));
+        reference.push_front(make_value(1));
+        reference.push_back(make_value(2));
+        check_equal(test_deque, reference);
+    }
+};
+
+TYPED_TEST_SUITE_P(deque_tests);
+
+TYPED_TEST_P(deque_tests, RandomTests) {
+    this->template run_random_tests<4>(10000);
+    this->template run_random_tests<16>(10000);
+    this->template run_random_tests<data_structures::linear::detail::default_deque_block_size<TypeParam>()>(100000);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(deque_tests,
+                            RandomTests
+                            );
+
+using deque_test_types = ::testing::Types<int, std::string>;
+INSTANTIATE_TYPED_TEST_SUITE_P(Deque, deque_tests, deque_test_types);
+
+TEST(deque_access_tests, ReferenceStabilityTests) {
+    deque<int, 8> test_deque;
+    test_deque.push_back(0);
+    int* first = &test_deque.front();
+    for(int i = 1; i < 1000; ++i) {
+        test_deque.push_back(i);
+        test_deque.push_front(-i);
+    }
+    EXPECT_EQ(first, &test_deque[999]);
+    EXPECT_EQ(*first, 0);
+}
+
+TEST(deque_access_tests, IteratorTests) {
+    deque<int, 4> test_deque;
+    for(int i = 0; i < 50; ++i) {
+        test_deque.push_front(i * 7 % 50);
+    }
+    std::sort(test_deque.begin(), test_deque.end());
+    for(int i = 0; i < 50; ++i) {
+        EXPECT_EQ(test_deque[i], i);
+    }
+    auto iterator = test_deque.begin() + 10;
+    EXPECT_EQ(*iterator, 10);
+    EXPECT_EQ(iterator[5], 15);
+    EXPECT_EQ(test_deque.end() - iterator, 40);
+    EXPECT_TRUE(iterator < test_deque.end());
+    deque<int, 4>::const_iterator const_iterator = iterator;
+    EXPECT_EQ(*(const_iterator - 3), 7);
+    EXPECT_EQ(*test_deque.rbegin(), 49);
+}
+
+TEST(deque_access_tests, BoundsTests) {
+    deque<int> test_deque = {1, 2, 3};
+    EXPECT_EQ(test_deque.at(2), 3);
+    EXPECT_THROW(test_deque.at(3), std::out_of_range);
+    test_deque.clear();
+    EXPECT_THROW(test_deque.pop_back(), std::out_of_range);
+    EXPECT_THROW(test_deque.pop_front(), std::out_of_range);
+    EXPECT_EQ(test_deque.begin(), test_deque.end());
+    EXPECT_EQ(test_deque.emplace_front(5), 5);
+    EXPECT_EQ(test_deque.size(), 1);
+}
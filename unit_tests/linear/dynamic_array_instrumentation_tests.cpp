@@ -0,0 +1,157 @@
+#include "gtest/gtest.h"
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include "data_structures/src/linear/dynamic_array.hpp"
+
+using data_structures::linear::counting_instrumentation;
+using data_structures::linear::dynamic_array;
+using data_structures::linear::dynamic_array_stats;
+using data_structures::linear::instrumentation_registry;
+using data_structures::linear::no_instrumentation;
+
+struct grow_test_site {
+    static constexpr const char* name = "grow_test_site";
+};
+
+struct reserve_test_site {
+    static constexpr const char* name = "reserve_test_site";
+};
+
+template<class T, class Site>
+using counted_array = dynamic_array<T, std::allocator<T>, counting_instrumentation<Site>>;
+
+class dynamic_array_instrumentation_tests: public ::testing::Test {
+    public:
+    void SetUp() override {
+        instrumentation_registry::instance().reset();
+    }
+
+    dynamic_array_stats find_site_stats(const char* site_name) {
+        dynamic_array_stats site_stats;
+        instrumentation_registry::instance().for_each([&](const char* name, const dynamic_array_stats& stats) {
+            if(std::strcmp(name, site_name) == 0) {
+                site_stats = stats;
+            }
+        });
+        return site_stats;
+    }
+};
+
+TEST_F(dynamic_array_instrumentation_tests, DisabledInstrumentationTests) {
+    EXPECT_TRUE(std::is_empty_v<no_instrumentation>);
+    EXPECT_FALSE(no_instrumentation::enabled);
+    EXPECT_EQ(sizeof(dynamic_array<int>), sizeof(dynamic_array<int, std::allocator<int>, no_instrumentation>));
+    EXPECT_LT(sizeof(dynamic_array<int>), sizeof(counted_array<int, grow_test_site>));
+}
+
+TEST_F(dynamic_array_instrumentation_tests, GrowTests) {
+    counted_array<int, grow_test_site> test_arr;
+    for(int i = 0; i < 100; ++i) {
+        test_arr.push_back(i * 2);
+    }
+    const dynamic_array_stats& stats = test_arr.get_instrumentation().stats();
+    EXPECT_GT(stats.allocations, 1);
+    EXPECT_EQ(stats.reallocations, stats.allocations - 1);
+    EXPECT_EQ(stats.max_capacity, test_arr.capacity());
+    EXPECT_GE(stats.bytes_allocated, test_arr.capacity() * sizeof(int));
+    EXPECT_GT(stats.element_moves, 100);
+    EXPECT_EQ(stats.element_copies, 0);
+}
+
+TEST_F(dynamic_array_instrumentation_tests, ReserveTests) {
+    counted_array<int, reserve_test_site> test_arr;
+    test_arr.reserve(100);
+    int value = 7;
+    for(int i = 0; i < 100; ++i) {
+        test_arr.push_back(value);
+    }
+    const dynamic_array_stats& stats = test_arr.get_instrumentation().stats();
+    EXPECT_EQ(stats.allocations, 1);
+    EXPECT_EQ(stats.reallocations, 0);
+    EXPECT_EQ(stats.element_copies, 100);
+    EXPECT_EQ(stats.element_moves, 0);
+}
+
+TEST_F(dynamic_array_instrumentation_tests, CopyAndMoveTests) {
+    counted_array<std::string, grow_test_site> test_arr;
+    std::string value = "instrumented";
+    test_arr.push_back(value);
+    test_arr.push_back(std::string("moved"));
+    test_arr.reserve(64);
+
+    const dynamic_array_stats& stats = test_arr.get_instrumentation().stats();
+    EXPECT_EQ(stats.element_copies, 1);
+    EXPECT_EQ(stats.element_moves, 1 + 1 + 2);
+
+    counted_array<std::string, grow_test_site> copy_arr = test_arr;
+    EXPECT_EQ(copy_arr.get_instrumentation().stats().element_copies, 2);
+    EXPECT_EQ(copy_arr.get_instrumentation().stats().allocations, 1);
+}
+
+TEST_F(dynamic_array_instrumentation_tests, ConstructingPathTests) {
+    std::string values[3] = {"a", "b", "c"};
+    counted_array<std::string, grow_test_site> filled(4, std::string("fill"));
+    EXPECT_EQ(filled.get_instrumentation().stats().element_copies, 4);
+
+    counted_array<std::string, grow_test_site> ranged(values, values + 3);
+    EXPECT_EQ(ranged.get_instrumentation().stats().element_copies, 3);
+    counted_array<std::string, grow_test_site> moved_range(std::make_move_iterator(values), std::make_move_iterator(values + 3));
+    EXPECT_EQ(moved_range.get_instrumentation().stats().element_copies, 0);
+    EXPECT_EQ(moved_range.get_instrumentation().stats().element_moves, 3);
+
+    counted_array<std::string, grow_test_site> test_arr;
+    test_arr.reserve(4);
+    test_arr.insert(test_arr.cend(), ranged.cbegin(), ranged.cend());
+    test_arr.insert(test_arr.cbegin() + 1, ranged.cbegin(), ranged.cend());
+    EXPECT_EQ(test_arr.get_instrumentation().stats().element_copies, 6);
+    EXPECT_EQ(test_arr.get_instrumentation().stats().element_moves, 3);
+    EXPECT_EQ(test_arr.get_instrumentation().stats().reallocations, 1);
+    test_arr.insert(test_arr.cbegin() + 2, filled.cbegin(), filled.cend());
+    EXPECT_EQ(test_arr.get_instrumentation().stats().element_copies, 10);
+    EXPECT_EQ(test_arr.get_instrumentation().stats().element_moves, 3 + 4);
+    EXPECT_EQ(test_arr.get_instrumentation().stats().reallocations, 1);
+
+    counted_array<std::string, grow_test_site> assigned;
+    assigned.reserve(8);
+    assigned.assign(5, std::string("x"));
+    assigned.assign(ranged.cbegin(), ranged.cend());
+    EXPECT_EQ(assigned.get_instrumentation().stats().element_copies, 5 + 3);
+    assigned = filled;
+    EXPECT_EQ(assigned.get_instrumentation().stats().element_copies, 5 + 3 + 4);
+
+    dynamic_array_stats assigned_stats = assigned.get_instrumentation().stats();
+    dynamic_array_stats filled_stats = filled.get_instrumentation().stats();
+    assigned.swap(filled);
+    EXPECT_EQ(assigned.get_instrumentation().stats(), filled_stats);
+    EXPECT_EQ(filled.get_instrumentation().stats(), assigned_stats);
+}
+
+TEST_F(dynamic_array_instrumentation_tests, RegistryTests) {
+    {
+        counted_array<int, grow_test_site> grow_arr;
+        for(int i = 0; i < 10; ++i) {
+            grow_arr.push_back(i * 2);
+        }
+        counted_array<int, reserve_test_site> reserve_arr;
+        reserve_arr.reserve(1000);
+
+        dynamic_array_stats grow_site_stats = find_site_stats(grow_test_site::name);
+        EXPECT_EQ(grow_site_stats, grow_arr.get_instrumentation().stats());
+        EXPECT_EQ(grow_site_stats, (counting_instrumentation<grow_test_site>::site_stats()));
+
+        dynamic_array_stats reserve_site_stats = find_site_stats(reserve_test_site::name);
+        EXPECT_EQ(reserve_site_stats.allocations, 1);
+        EXPECT_GE(reserve_site_stats.max_capacity, 1000);
+
+        dynamic_array_stats expected_total = grow_site_stats;
+        expected_total += reserve_site_stats;
+        EXPECT_EQ(instrumentation_registry::instance().total(), expected_total);
+    }
+    EXPECT_EQ(find_site_stats(grow_test_site::name).element_moves, 10 + 1 + 4);
+
+    instrumentation_registry::instance().reset();
+    EXPECT_EQ(instrumentation_registry::instance().total(), dynamic_array_stats());
+}
@@ -1,10 +1,15 @@
 #include "gtest/gtest.h"
+#include <algorithm>
+#include <array>
 #include <compare>
 #include <cstdlib>
 #include <iterator>
 #include <pthread.h>
 #include <random>
+#include <span>
 #include <stdexcept>
+#include <string>
+#include <type_traits>
 #include <vector>
 
 #include "data_structures/src/linear/dynamic_array.hpp"
@@ -593,6 +598,319 @@ REGISTER_TYPED_TEST_SUITE_P(dynamic_array_tests,
 using dynamic_array_test_types = ::testing::Types<std::string>;
 INSTANTIATE_TYPED_TEST_SUITE_P(DynamicArray, dynamic_array_tests, dynamic_array_test_types);
 
+template<class T>
+T make_compaction_value(unsigned int index) {
+    if constexpr(std::is_same_v<T, std::string>) {
+        return "value_" + std::to_string(index);
+    }
+    else {
+        return static_cast<T>(index);
+    }
+}
+
+template<class T>
+class dynamic_array_compaction_tests: public ::testing::Test {
+    public:
+        std::vector<T> test_vec;
+        dynamic_array<T> test_arr;
+
+    void construct_test_lists(unsigned int test_size) {
+        test_arr.clear();
+        test_vec.clear();
+        for(unsigned int i = 0; i < test_size; ++i) {
+            test_arr.push_back(make_compaction_value<T>(i));
+            test_vec.push_back(make_compaction_value<T>(i));
+        }
+    }
+
+    void run_equality_tests() {
+        ASSERT_EQ(test_arr.size(), test_vec.size());
+        for(unsigned int i = 0; i < test_arr.size(); ++i) {
+            EXPECT_EQ(test_arr[i], test_vec[i]);
+        }
+        EXPECT_EQ(static_cast<std::size_t>(std::distance(test_arr.begin(), test_arr.end())), test_vec.size());
+    }
+
+    void run_erase_if_tests(unsigned int test_size, unsigned int erase_stride) {
+        construct_test_lists(test_size);
+        std::vector<T> erased_values;
+        for(unsigned int i = 0; i < test_size; i += erase_stride) {
+            erased_values.push_back(make_compaction_value<T>(i));
+        }
+        auto should_erase = [&erased_values](const T& value) {
+            return std::find(erased_values.begin(), erased_values.end(), value) != erased_values.end();
+        };
+
+        std::size_t expected_erased = std::erase_if(test_vec, should_erase);
+        EXPECT_EQ(test_arr.erase_if(should_erase), expected_erased);
+        run_equality_tests();
+    }
+
+    void run_erase_indices_tests(unsigned int test_size, std::vector<unsigned long> erase_indices) {
+        construct_test_lists(test_size);
+        std::vector<T> expected_vec;
+        for(unsigned int i = 0; i < test_size; ++i) {
+            if(std::find(erase_indices.begin(), erase_indices.end(), i) == erase_indices.end()) {
+                expected_vec.push_back(test_vec[i]);
+            }
+        }
+        std::size_t expected_erased = test_vec.size() - expected_vec.size();
+        test_vec = expected_vec;
+
+        EXPECT_EQ(test_arr.erase_indices(std::span<const unsigned long>(erase_indices)), expected_erased);
+        run_equality_tests();
+    }
+
+    void run_unstable_erase_tests(unsigned int test_size) {
+        for(unsigned int i = 0; i < test_size; ++i) {
+            construct_test_lists(test_size);
+            typename dynamic_array<T>::const_iterator erase_iter = test_arr.cbegin();
+            erase_iter += i;
+            test_arr.unstable_erase(erase_iter);
+
+            test_vec[i] = test_vec.back();
+            test_vec.pop_back();
+            run_equality_tests();
+        }
+    }
+};
+
+TYPED_TEST_SUITE_P(dynamic_array_compaction_tests);
+
+TYPED_TEST_P(dynamic_array_compaction_tests, EraseIfTests) {
+    this->run_erase_if_tests(0, 1);
+    this->run_erase_if_tests(10, 1);
+    this->run_erase_if_tests(10, 3);
+    this->run_erase_if_tests(100, 10);
+    this->run_erase_if_tests(100, 200);
+}
+
+TYPED_TEST_P(dynamic_array_compaction_tests, EraseIndicesTests) {
+    this->run_erase_indices_tests(10, {});
+    this->run_erase_indices_tests(10, {0});
+    this->run_erase_indices_tests(10, {9});
+    this->run_erase_indices_tests(10, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+    this->run_erase_indices_tests(10, {1, 3, 3, 4, 8});
+    this->run_erase_indices_tests(100, {5, 17, 18, 50, 99});
+}
+
+TYPED_TEST_P(dynamic_array_compaction_tests, UnstableEraseTests) {
+    this->run_unstable_erase_tests(1);
+    this->run_unstable_erase_tests(10);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(dynamic_array_compaction_tests,
+                            EraseIfTests,
+                            EraseIndicesTests,
+                            UnstableEraseTests
+                            );
+
+using dynamic_array_compaction_test_types = ::testing::Types<int, std::string>;
+INSTANTIATE_TYPED_TEST_SUITE_P(DynamicArrayCompaction, dynamic_array_compaction_tests, dynamic_array_compaction_test_types);
+
+template<class Array>
+concept supports_uninitialized_growth = requires(Array arr) {
+    arr.resize_uninitialized(1);
+    arr.append_uninitialized(1);
+};
+
+struct overwrite_test_record {
+    int id;
+    double weight;
+};
+
+TEST(dynamic_array_uninitialized_tests, ResizeUninitializedTests) {
+    dynamic_array<int> test_arr;
+    test_arr.resize_uninitialized(1000);
+    EXPECT_EQ(test_arr.size(), 1000);
+    EXPECT_GE(test_arr.capacity(), 1000);
+    for(int i = 0; i < 1000; ++i) {
+        test_arr.data()[i] = i;
+    }
+    for(int i = 0; i < 1000; ++i) {
+        EXPECT_EQ(test_arr[i], i);
+    }
+    EXPECT_EQ(std::distance(test_arr.begin(), test_arr.end()), 1000);
+
+    test_arr.resize_uninitialized(10);
+    EXPECT_EQ(test_arr.size(), 10);
+    EXPECT_EQ(test_arr.back(), 9);
+}
+
+TEST(dynamic_array_uninitialized_tests, AppendUninitializedTests) {
+    dynamic_array<overwrite_test_record> test_arr;
+    std::vector<overwrite_test_record> test_vec;
+    for(int chunk = 0; chunk < 10; ++chunk) {
+        std::span<overwrite_test_record> appended = test_arr.append_uninitialized(chunk + 1);
+        EXPECT_EQ(appended.size(), chunk + 1);
+        EXPECT_EQ(appended.data() + appended.size(), test_arr.data() + test_arr.size());
+        for(int i = 0; i <= chunk; ++i) {
+            appended[i] = overwrite_test_record{chunk * 100 + i, chunk * 0.5};
+            test_vec.push_back(appended[i]);
+        }
+    }
+    ASSERT_EQ(test_arr.size(), test_vec.size());
+    for(std::size_t i = 0; i < test_vec.size(); ++i) {
+        EXPECT_EQ(test_arr[i].id, test_vec[i].id);
+        EXPECT_EQ(test_arr[i].weight, test_vec[i].weight);
+    }
+}
+
+TEST(dynamic_array_uninitialized_tests, ResizeForOverwriteTests) {
+    dynamic_array<std::string> test_arr;
+    test_arr.push_back("kept");
+    test_arr.resize_for_overwrite(20);
+    EXPECT_EQ(test_arr.size(), 20);
+    EXPECT_EQ(test_arr[0], "kept");
+    for(int i = 1; i < 20; ++i) {
+        EXPECT_TRUE(test_arr[i].empty());
+        test_arr[i] = std::to_string(i);
+    }
+    test_arr.resize_for_overwrite(2);
+    EXPECT_EQ(test_arr.size(), 2);
+    EXPECT_EQ(test_arr.back(), "1");
+}
+
+TEST(dynamic_array_uninitialized_tests, ImplicitLifetimeConstraintTests) {
+    EXPECT_TRUE(data_structures::linear::implicit_lifetime_element<int>);
+    EXPECT_TRUE(data_structures::linear::implicit_lifetime_element<overwrite_test_record>);
+    EXPECT_FALSE(data_structures::linear::implicit_lifetime_element<std::string>);
+    EXPECT_FALSE(supports_uninitialized_growth<dynamic_array<std::string>>);
+    EXPECT_TRUE(supports_uninitialized_growth<dynamic_array<int>>);
+}
+
+struct live_count_record {
+    static inline int live = 0;
+    int value = 0;
+
+    live_count_record() { ++live; }
+    live_count_record(int initial) : value(initial) { ++live; }
+    live_count_record(const live_count_record& other) : value(other.value) { ++live; }
+    live_count_record& operator=(const live_count_record& other) = default;
+    ~live_count_record() { --live; }
+};
+
+TEST(dynamic_array_copy_tests, CopyConstructsOnlyLiveValuesTests) {
+    {
+        dynamic_array<live_count_record> original;
+        original.reserve(100);
+        for(int i = 0; i < 5; ++i) {
+            original.push_back(live_count_record(i));
+        }
+        EXPECT_EQ(live_count_record::live, 5);
+        dynamic_array<live_count_record> copy = original;
+        EXPECT_EQ(live_count_record::live, 10);
+        EXPECT_EQ(copy.capacity(), original.size());
+        for(int i = 0; i < 5; ++i) {
+            EXPECT_EQ(copy[i].value, i);
+        }
+        copy.push_back(live_count_record(5));
+        EXPECT_EQ(copy.back().value, 5);
+
+        original.clear();
+        dynamic_array<live_count_record> empty_copy = original;
+        EXPECT_EQ(empty_copy.capacity(), 0u);
+        EXPECT_EQ(empty_copy.data(), nullptr);
+        empty_copy.push_back(live_count_record(6));
+        EXPECT_EQ(empty_copy.back().value, 6);
+    }
+    EXPECT_EQ(live_count_record::live, 0);
+}
+
+TEST(dynamic_array_copy_tests, ReserveExactTests) {
+    dynamic_array<int> values;
+    values.reserve_exact(5000);
+    EXPECT_EQ(values.capacity(), 5000u);
+    for(int i = 0; i < 5000; ++i) {
+        values.push_back(i);
+    }
+    EXPECT_EQ(values.capacity(), 5000u);
+    values.reserve_exact(10);
+    EXPECT_EQ(values.capacity(), 5000u);
+    EXPECT_EQ(values[4999], 4999);
+}
+
+// Runs the same edits on a dynamic_array and a std::vector so constant evaluation can compare
+// them; every allocation has to be freed before the evaluation ends.
+template<class Container>
+constexpr Container run_constexpr_edits(typename Container::value_type first, typename Container::value_type second) {
+    Container values;
+    for(int i = 0; i < 20; ++i) {
+        values.push_back(i % 2 == 0 ? first : second);
+    }
+    values.push_back(values[3]);
+    values.pop_back();
+    values.insert(values.cbegin() + 2, 3, second);
+    values.insert(values.cbegin() + 1, values[0]);
+    values.emplace(values.cbegin(), first);
+    values.emplace_back(values.back());
+    values.erase(values.cbegin() + 4);
+    values.erase(values.cbegin() + 1, values.cbegin() + 6);
+    values.resize(30, second);
+    values.resize(25);
+    Container copy = values;
+    copy.assign(4, first);
+    values.insert(values.cbegin() + 5, copy.cbegin(), copy.cend());
+    return values;
+}
+
+template<class T>
+constexpr bool constexpr_edits_match(T first, T second) {
+    dynamic_array<T> actual = run_constexpr_edits<dynamic_array<T>>(first, second);
+    std::vector<T> expected = run_constexpr_edits<std::vector<T>>(first, second);
+    if(actual.size() != expected.size()) {
+        return false;
+    }
+    for(unsigned long index = 0; index < actual.size(); ++index) {
+        if(!(actual[index] == expected[index])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+constexpr bool constexpr_value_semantics() {
+    dynamic_array<int> values = {5, 1, 4, 2, 3};
+    dynamic_array<int> copy(values);
+    dynamic_array<int> moved(std::move(copy));
+    moved.swap(copy);
+    copy.erase_if([](int value) { return value % 2 == 0; });
+    values.reserve(64);
+    values.resize_for_overwrite(7);
+    values[5] = 6;
+    values[6] = 7;
+    values.unstable_erase(values.cbegin());
+    dynamic_array<int> assigned;
+    assigned = values;
+    return copy == dynamic_array<int>{5, 1, 3} && moved.size() == 0 && assigned == values &&
+           values.size() == 6 && values.front() == 7 && values.back() == 6 && (copy <=> values) == std::weak_ordering::less;
+}
+
+constexpr auto constexpr_squares = data_structures::linear::make_array([]() {
+    dynamic_array<unsigned int> squares;
+    for(unsigned int i = 0; i * i < 200; ++i) {
+        squares.push_back(i * i);
+    }
+    return squares;
+});
+
+static_assert(constexpr_edits_match<int>(1, 2));
+static_assert(constexpr_edits_match<std::string>("first", "a second value too long for small buffers"));
+static_assert(constexpr_value_semantics());
+static_assert(constexpr_squares.size() == 15 && constexpr_squares[14] == 196);
+
+TEST(dynamic_array_constexpr_tests, ConstantEvaluationTests) {
+    EXPECT_TRUE(constexpr_edits_match<int>(1, 2));
+    EXPECT_TRUE(constexpr_edits_match<std::string>("first", "second"));
+    EXPECT_TRUE(constexpr_value_semantics());
+
+    dynamic_array<int> values = {1, 2, 3};
+    std::array<int, 3> copied = data_structures::linear::to_array<3>(values);
+    EXPECT_EQ(copied, (std::array<int, 3>{1, 2, 3}));
+    EXPECT_THROW(data_structures::linear::to_array<2>(values), std::length_error);
+    EXPECT_EQ(constexpr_squares[3], 9u);
+}
+
 // template<class T>
 // class dynamic_array_tests: public ::testing::TestWithParam<dynamic_array_test_params> {
 //     public:
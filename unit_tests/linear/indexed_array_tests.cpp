@@ -0,0 +1,144 @@
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "data_structures/src/linear/indexed_array.hpp"
+#include "unit_tests/container_test_helpers.hpp"
+
+using data_structures::linear::indexed_array;
+
+template<class T>
+class indexed_array_tests: public container_tests<T> {
+    public:
+        using container_tests<T>::make_value;
+        using container_tests<T>::check_equal;
+
+    // Random inserts and erases that favour the front, middle and end in turn so blocks
+    // split, merge and disappear.
+    template<unsigned long BlockSize>
+    void run_random_tests(unsigned int rounds) {
+        indexed_array<T, BlockSize> test_array;
+        std::vector<T> reference;
+        std::mt19937 generator(rounds + BlockSize);
+        for(unsigned int round = 0; round < rounds; ++round) {
+            bool grow = (round / (rounds / 4 + 1)) % 2 == 0 ? generator() % 4 != 0 : generator() % 4 == 0;
+            if(grow || reference.empty()) {
+                unsigned long index = generator() % (reference.size() + 1);
+                T value = make_value(round);
+                test_array.insert(index, value);
+                reference.insert(reference.begin() + index, value);
+            }
+            else {
+                unsigned long index = generator() % reference.size();
+                test_array.erase(index);
+                reference.erase(reference.begin() + index);
+            }
+            if(round % 97 == 0) {
+                check_equal(test_array, reference);
+            }
+        }
+        check_equal(test_array, reference);
+        while(!reference.empty()) {
+            unsigned long index = generator() % reference.size();
+            test_array.erase(index);
+            reference.erase(reference.begin() + index);
+        }
+        check_equal(test_array, reference);
+        EXPECT_EQ(test_array.block_count(), 0);
+    }
+
+    void run_append_tests(unsigned int test_size) {
+        indexed_array<T, 16> test_array;
+        std::vector<T> reference;
+        for(unsigned int i = 0; i < test_size; ++i) {
+            test_array.push_back(make_value(i));
+            reference.push_back(make_value(i));
+        }
+        check_equal(test_array, reference);
+        for(unsigned int i = 0; i < test_size / 2; ++i) {
+            test_array.pop_back();
+            reference.pop_back();
+        }
+        check_equal(test_array, reference);
+    }
+};
+
+TYPED_TEST_SUITE_P(indexed_array_tests);
+
+TYPED_TEST_P(indexed_array_tests, RandomOperationTests) {
+    this->template run_random_tests<4>(3000);
+    this->template run_random_tests<16>(20000);
+    this->template run_random_tests<indexed_array<TypeParam>::block_size>(20000);
+}
+
+TYPED_TEST_P(indexed_array_tests, AppendTests) {
+    this->run_append_tests(0);
+    this->run_append_tests(1);
+    this->run_append_tests(16);
+    this->run_append_tests(1000);
+}
+
+TYPED_TEST_P(indexed_array_tests, CopyAndMoveTests) {
+    indexed_array<TypeParam, 16> test_array;
+    std::vector<TypeParam> reference;
+    for(unsigned int i = 0; i < 200; ++i) {
+        test_array.insert(i / 2, this->make_value(i));
+        reference.insert(reference.begin() + i / 2, this->make_value(i));
+    }
+    indexed_array<TypeParam, 16> copy(test_array);
+    this->check_equal(copy, reference);
+    copy.erase(0);
+    this->check_equal(test_array, reference);
+
+    indexed_array<TypeParam, 16> moved(std::move(copy));
+    EXPECT_EQ(copy.size(), 0);
+    EXPECT_EQ(moved.size(), reference.size() - 1);
+    copy = test_array;
+    this->check_equal(copy, reference);
+    moved = std::move(copy);
+    this->check_equal(moved, reference);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(indexed_array_tests,
+                            RandomOperationTests,
+                            AppendTests,
+                            CopyAndMoveTests
+                            );
+
+using indexed_array_test_types = ::testing::Types<int, double, std::string>;
+INSTANTIATE_TYPED_TEST_SUITE_P(IndexedArray, indexed_array_tests, indexed_array_test_types);
+
+TEST(indexed_array_access_tests, BoundsTests) {
+    indexed_array<int> test_array = {1, 2, 3};
+    EXPECT_EQ(test_array.front(), 1);
+    EXPECT_EQ(test_array.back(), 3);
+    EXPECT_EQ(test_array.at(2), 3);
+    EXPECT_THROW(test_array.at(3), std::out_of_range);
+    EXPECT_THROW(test_array.insert(4, 0), std::out_of_range);
+    EXPECT_THROW(test_array.erase(3), std::out_of_range);
+    test_array.emplace(1, 7);
+    std::vector<int> visited;
+    test_array.for_each([&](int value) { visited.push_back(value); });
+    EXPECT_EQ(visited, (std::vector<int>{1, 7, 2, 3}));
+    auto last = test_array.end();
+    --last;
+    EXPECT_EQ(*last, 3);
+    test_array.clear();
+    EXPECT_TRUE(test_array.empty());
+    EXPECT_EQ(test_array.begin(), test_array.end());
+}
+
+TEST(indexed_array_access_tests, FrontInsertBlockBoundTests) {
+    indexed_array<int, 16> test_array;
+    for(int i = 0; i < 4000; ++i) {
+        test_array.insert(0, i);
+    }
+    EXPECT_LE(test_array.block_count(), 4000 / 8 + 1);
+    for(int i = 0; i < 4000; ++i) {
+        ASSERT_EQ(test_array[i], 3999 - i);
+    }
+}
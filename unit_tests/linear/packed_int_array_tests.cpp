@@ -0,0 +1,145 @@
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "data_structures/src/linear/dynamic_array.hpp"
+#include "data_structures/src/linear/packed_int_array.hpp"
+
+using data_structures::linear::dynamic_array;
+using data_structures::linear::packed_int_array;
+using data_structures::linear::packing_mode;
+
+class packed_int_array_tests: public ::testing::TestWithParam<packing_mode> {
+    public:
+        std::vector<std::uint64_t> make_values(unsigned long test_size, std::uint64_t base, std::uint64_t range) {
+            std::mt19937_64 generator(test_size + range);
+            std::vector<std::uint64_t> values;
+            for(unsigned long i = 0; i < test_size; ++i) {
+                values.push_back(base + generator() % range);
+            }
+            if(GetParam() == packing_mode::DELTA) {
+                std::sort(values.begin(), values.end());
+            }
+            return values;
+        }
+
+    void run_equality_tests(const packed_int_array& test_array, const std::vector<std::uint64_t>& values) {
+        ASSERT_EQ(test_array.size(), values.size());
+        for(unsigned long i = 0; i < values.size(); ++i) {
+            ASSERT_EQ(test_array[i], values[i]);
+        }
+        std::vector<std::uint64_t> decoded(values.size());
+        test_array.decode(0, std::span<std::uint64_t>(decoded));
+        EXPECT_EQ(decoded, values);
+    }
+
+    void run_construction_tests(unsigned long test_size, std::uint64_t base, std::uint64_t range) {
+        std::vector<std::uint64_t> values = make_values(test_size, base, range);
+        packed_int_array test_array(values.begin(), values.end(), GetParam());
+        run_equality_tests(test_array, values);
+    }
+
+    void run_push_back_tests(unsigned long test_size, std::uint64_t range) {
+        std::vector<std::uint64_t> values = make_values(test_size, 1000, range);
+        if(GetParam() != packing_mode::DELTA) {
+            std::reverse(values.begin(), values.end());
+        }
+        packed_int_array test_array(GetParam());
+        for(std::uint64_t value : values) {
+            test_array.push_back(value);
+        }
+        run_equality_tests(test_array, values);
+    }
+
+    void run_chunk_decode_tests(unsigned long test_size) {
+        std::vector<std::uint64_t> values = make_values(test_size, 5, 1 << 20);
+        packed_int_array test_array(values.begin(), values.end(), GetParam());
+        dynamic_array<std::uint32_t> chunk;
+        unsigned long decoded = 0;
+        for(unsigned long index = 0; index < test_array.chunk_count(); ++index) {
+            test_array.decode_chunk(index, chunk);
+            for(unsigned long offset = 0; offset < chunk.size(); ++offset) {
+                ASSERT_EQ(chunk[offset], values[decoded + offset]);
+            }
+            decoded += chunk.size();
+        }
+        EXPECT_EQ(decoded, values.size());
+    }
+};
+
+TEST_P(packed_int_array_tests, ConstructionTests) {
+    run_construction_tests(0, 0, 1);
+    run_construction_tests(1, 7, 1);
+    run_construction_tests(200, 42, 1);
+    run_construction_tests(1000, 0, 1 << 20);
+    run_construction_tests(1000, 1ULL << 40, 1 << 13);
+    run_construction_tests(300, 0, UINT64_MAX);
+}
+
+TEST_P(packed_int_array_tests, PushBackTests) {
+    run_push_back_tests(1, 10);
+    run_push_back_tests(500, 1 << 10);
+    run_push_back_tests(500, 1ULL << 50);
+}
+
+TEST_P(packed_int_array_tests, ChunkDecodeTests) {
+    run_chunk_decode_tests(0);
+    run_chunk_decode_tests(64);
+    run_chunk_decode_tests(1000);
+}
+
+TEST_P(packed_int_array_tests, InvalidOperationTests) {
+    packed_int_array test_array({1, 2, UINT64_MAX}, GetParam());
+    dynamic_array<std::uint32_t> chunk;
+    EXPECT_THROW(test_array.decode_chunk(0, chunk), std::overflow_error);
+    EXPECT_THROW(test_array.decode_chunk(1, chunk), std::out_of_range);
+    EXPECT_THROW(test_array.at(3), std::out_of_range);
+    std::vector<std::uint64_t> decoded(2);
+    EXPECT_THROW(test_array.decode(2, std::span<std::uint64_t>(decoded)), std::out_of_range);
+}
+
+INSTANTIATE_TEST_SUITE_P(PackingModes, packed_int_array_tests,
+                         ::testing::Values(packing_mode::DIRECT, packing_mode::FRAME_OF_REFERENCE, packing_mode::DELTA));
+
+TEST(packed_int_array_width_tests, WidthSelectionTests) {
+    std::vector<std::uint64_t> ids;
+    for(std::uint64_t i = 0; i < 4096; ++i) {
+        ids.push_back(i * 131 % (1 << 20));
+    }
+    packed_int_array direct(ids.begin(), ids.end());
+    EXPECT_EQ(direct.bit_width(), 20);
+    EXPECT_LT(direct.memory_usage(), ids.size() * sizeof(std::uint64_t) / 3);
+
+    packed_int_array offset({1000000, 1000003, 1000001}, packing_mode::FRAME_OF_REFERENCE);
+    EXPECT_EQ(offset.reference(), 1000000);
+    EXPECT_EQ(offset.bit_width(), 2);
+
+    packed_int_array constant({9, 9, 9, 9}, packing_mode::FRAME_OF_REFERENCE);
+    EXPECT_EQ(constant.bit_width(), 0);
+    EXPECT_EQ(constant[3], 9);
+
+    std::sort(ids.begin(), ids.end());
+    packed_int_array delta(ids.begin(), ids.end(), packing_mode::DELTA);
+    EXPECT_LE(delta.bit_width(), 9);
+    EXPECT_THROW(packed_int_array({5, 4}, packing_mode::DELTA), std::invalid_argument);
+    EXPECT_THROW(delta.push_back(0), std::invalid_argument);
+}
+
+// A strictly descending stream lowers the frame-of-reference on almost every append; with
+// a repack each time this would be quadratic and far too slow for the test timeout.
+TEST(packed_int_array_width_tests, DescendingPushBackTests) {
+    constexpr std::uint64_t count = 200000;
+    packed_int_array descending(packing_mode::FRAME_OF_REFERENCE);
+    for(std::uint64_t value = count; value > 0; --value) {
+        descending.push_back(value);
+    }
+    ASSERT_EQ(descending.size(), count);
+    EXPECT_LE(descending.reference(), 1);
+    EXPECT_EQ(descending.bit_width(), 18);
+    for(std::uint64_t index = 0; index < count; ++index) {
+        ASSERT_EQ(descending[index], count - index);
+    }
+}
@@ -0,0 +1,226 @@
+#include "gtest/gtest.h"
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "data_structures/src/linear/persistent_array.hpp"
+#include "unit_tests/container_test_helpers.hpp"
+
+using data_structures::linear::persistent_array;
+
+template<class T>
+class persistent_array_tests: public container_tests<T> {
+    public:
+        using container_tests<T>::make_value;
+
+    void check_equal(const persistent_array<T>& test_array, const std::vector<T>& reference) {
+        ASSERT_NO_FATAL_FAILURE(container_tests<T>::check_equal(test_array, reference));
+        std::vector<T> visited;
+        test_array.for_each([&](const T& value) { visited.push_back(value); });
+        ASSERT_EQ(visited, reference);
+    }
+
+    void run_push_pop_tests(unsigned int count) {
+        std::vector<persistent_array<T>> versions = {persistent_array<T>()};
+        std::vector<T> reference;
+        for(unsigned int i = 0; i < count; ++i) {
+            versions.push_back(versions.back().push_back(make_value(i)));
+            reference.push_back(make_value(i));
+        }
+        check_equal(versions.back(), reference);
+        for(unsigned int i = 0; i <= count; i += count / 7 + 1) {
+            check_equal(versions[i], std::vector<T>(reference.begin(), reference.begin() + i));
+        }
+
+        persistent_array<T> shrinking = versions.back();
+        for(unsigned int i = 0; i < count; ++i) {
+            shrinking = shrinking.pop_back();
+            reference.pop_back();
+            if(i % 61 == 0) {
+                check_equal(shrinking, reference);
+            }
+        }
+        EXPECT_TRUE(shrinking.empty());
+        EXPECT_EQ(versions.back().size(), count);
+    }
+
+    // Applies random updates, appends, pops, slices and concatenations to random earlier
+    // versions and checks at the end that none of the earlier versions changed.
+    void run_random_version_tests(unsigned int rounds, unsigned long max_size) {
+        std::vector<persistent_array<T>> versions = {persistent_array<T>()};
+        std::vector<std::vector<T>> references = {{}};
+        std::mt19937 generator(rounds);
+        for(unsigned int round = 0; round < rounds; ++round) {
+            unsigned long source = generator() % versions.size();
+            const persistent_array<T> base = versions[source];
+            std::vector<T> expected = references[source];
+            unsigned int operation = generator() % 6;
+            if(operation == 0 && !expected.empty()) {
+                unsigned long index = generator() % expected.size();
+                expected[index] = make_value(round);
+                versions.push_back(base.set(index, make_value(round)));
+            }
+            else if(operation == 1 && !expected.empty()) {
+                unsigned long first = generator() % (expected.size() + 1);
+                unsigned long last = first + generator() % (expected.size() - first + 1);
+                expected = std::vector<T>(expected.begin() + first, expected.begin() + last);
+                versions.push_back(base.slice(first, last));
+            }
+            else if(operation == 2) {
+                unsigned long other = generator() % versions.size();
+                if(expected.size() + references[other].size() > max_size) {
+                    continue;
+                }
+                expected.insert(expected.end(), references[other].begin(), references[other].end());
+                versions.push_back(base.concat(versions[other]));
+            }
+            else if(operation == 3 && !expected.empty()) {
+                expected.pop_back();
+                versions.push_back(base.pop_back());
+            }
+            else {
+                persistent_array<T> grown = base;
+                unsigned int count = generator() % 100;
+                for(unsigned int i = 0; i < count; ++i) {
+                    grown = grown.push_back(make_value(round + i));
+                    expected.push_back(make_value(round + i));
+                }
+                versions.push_back(grown);
+            }
+            references.push_back(expected);
+            check_equal(versions.back(), references.back());
+        }
+        for(unsigned long i = 0; i < versions.size(); ++i) {
+            check_equal(versions[i], references[i]);
+        }
+    }
+
+    void run_transient_tests(unsigned int count) {
+        persistent_array<T> original;
+        for(unsigned int i = 0; i < count; ++i) {
+            original = original.push_back(make_value(i));
+        }
+        std::vector<T> reference(original.begin(), original.end());
+
+        auto transient = original.transient();
+        std::vector<T> expected = reference;
+        std::mt19937 generator(count);
+        for(unsigned int i = 0; i < count; ++i) {
+            unsigned long index = generator() % transient.size();
+            transient.set(index, make_value(count + i));
+            expected[index] = make_value(count + i);
+            if(i % 3 == 0) {
+                transient.push_back(make_value(i));
+                expected.push_back(make_value(i));
+            }
+            if(i % 5 == 0) {
+                transient.pop_back();
+                expected.pop_back();
+            }
+        }
+        transient.append(original);
+        expected.insert(expected.end(), reference.begin(), reference.end());
+        persistent_array<T> updated = transient.persistent();
+        EXPECT_TRUE(transient.empty());
+        check_equal(updated, expected);
+        check_equal(original, reference);
+    }
+};
+
+TYPED_TEST_SUITE_P(persistent_array_tests);
+
+TYPED_TEST_P(persistent_array_tests, PushPopTests) {
+    this->run_push_pop_tests(0);
+    this->run_push_pop_tests(1);
+    this->run_push_pop_tests(33);
+    this->run_push_pop_tests(1057);
+    this->run_push_pop_tests(40000);
+}
+
+TYPED_TEST_P(persistent_array_tests, RandomVersionTests) {
+    this->run_random_version_tests(100, 200);
+    this->run_random_version_tests(1500, 60000);
+}
+
+TYPED_TEST_P(persistent_array_tests, TransientTests) {
+    this->run_transient_tests(1);
+    this->run_transient_tests(100);
+    this->run_transient_tests(5000);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(persistent_array_tests,
+                            PushPopTests,
+                            RandomVersionTests,
+                            TransientTests
+                            );
+
+using persistent_array_test_types = ::testing::Types<int, std::string>;
+INSTANTIATE_TYPED_TEST_SUITE_P(PersistentArray, persistent_array_tests, persistent_array_test_types);
+
+TEST(persistent_array_access_tests, BoundsTests) {
+    persistent_array<int> test_array = {1, 2, 3};
+    EXPECT_EQ(test_array.front(), 1);
+    EXPECT_EQ(test_array.back(), 3);
+    EXPECT_EQ(test_array.at(1), 2);
+    EXPECT_THROW(test_array.at(3), std::out_of_range);
+    EXPECT_THROW((void)test_array.set(3, 0), std::out_of_range);
+    EXPECT_THROW((void)test_array.slice(2, 1), std::out_of_range);
+    EXPECT_THROW((void)test_array.slice(0, 4), std::out_of_range);
+    EXPECT_THROW((void)persistent_array<int>().pop_back(), std::out_of_range);
+    EXPECT_EQ(test_array.take(2).size(), 2);
+    EXPECT_EQ(test_array.drop(5).size(), 0);
+    EXPECT_EQ(test_array.drop(1).front(), 2);
+}
+
+// Concatenating many small arrays must not let the tree grow deeper than a dense one would
+// by more than a level.
+TEST(persistent_array_access_tests, ConcatHeightTests) {
+    persistent_array<int> joined;
+    std::vector<int> reference;
+    for(int piece = 0; piece < 2000; ++piece) {
+        std::vector<int> values;
+        for(int i = 0; i < 1 + piece % 45; ++i) {
+            values.push_back(piece * 100 + i);
+        }
+        joined = joined.concat(persistent_array<int>(values.begin(), values.end()));
+        reference.insert(reference.end(), values.begin(), values.end());
+    }
+    ASSERT_EQ(joined.size(), reference.size());
+    for(unsigned long i = 0; i < reference.size(); ++i) {
+        ASSERT_EQ(joined[i], reference[i]);
+    }
+    EXPECT_LE(joined.height(), 4u);
+}
+
+TEST(persistent_array_access_tests, SnapshotReaderTests) {
+    persistent_array<int> base;
+    for(int i = 0; i < 5000; ++i) {
+        base = base.push_back(i);
+    }
+    std::vector<std::thread> readers;
+    std::vector<long> sums(4, 0);
+    for(unsigned int reader = 0; reader < sums.size(); ++reader) {
+        readers.emplace_back([snapshot = base, &sums, reader]() {
+            for(int pass = 0; pass < 20; ++pass) {
+                long sum = 0;
+                for(int value : snapshot) {
+                    sum += value;
+                }
+                sums[reader] = sum;
+            }
+        });
+    }
+    persistent_array<int> writer = base;
+    for(int i = 0; i < 20000; ++i) {
+        writer = writer.set(static_cast<unsigned long>(i) % writer.size(), -i).push_back(i);
+    }
+    for(std::thread& reader : readers) {
+        reader.join();
+    }
+    for(long sum : sums) {
+        EXPECT_EQ(sum, 4999L * 5000 / 2);
+    }
+    EXPECT_EQ(base[10], 10);
+}
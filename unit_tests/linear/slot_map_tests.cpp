@@ -0,0 +1,105 @@
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "data_structures/src/linear/slot_map.hpp"
+#include "unit_tests/container_test_helpers.hpp"
+
+using data_structures::linear::slot_handle;
+using data_structures::linear::slot_map;
+
+template<class T>
+class slot_map_tests: public container_tests<T> {
+    public:
+        using container_tests<T>::make_value;
+
+        slot_map<T> test_map;
+        std::vector<std::pair<slot_handle, T>> live;
+        std::vector<slot_handle> erased;
+
+    void run_equality_tests() {
+        ASSERT_EQ(test_map.size(), live.size());
+        for(const auto& [handle, value] : live) {
+            ASSERT_TRUE(test_map.contains(handle));
+            ASSERT_EQ(test_map.at(handle), value);
+            ASSERT_EQ(*test_map.find(handle), value);
+        }
+        for(const slot_handle& handle : erased) {
+            ASSERT_FALSE(test_map.contains(handle));
+            ASSERT_EQ(test_map.find(handle), nullptr);
+        }
+        std::vector<T> dense(test_map.begin(), test_map.end());
+        std::vector<T> expected;
+        for(const auto& entry : live) {
+            expected.push_back(entry.second);
+        }
+        std::sort(dense.begin(), dense.end());
+        std::sort(expected.begin(), expected.end());
+        EXPECT_EQ(dense, expected);
+        for(unsigned long position = 0; position < test_map.size(); ++position) {
+            ASSERT_EQ(test_map[test_map.handle_at(position)], test_map.values()[position]);
+        }
+    }
+
+    void run_random_tests(unsigned int rounds) {
+        std::mt19937 generator(rounds);
+        for(unsigned int round = 0; round < rounds; ++round) {
+            if(live.empty() || generator() % 3 != 0) {
+                T value = make_value(round);
+                live.emplace_back(test_map.insert(value), value);
+            }
+            else {
+                unsigned long victim = generator() % live.size();
+                ASSERT_TRUE(test_map.erase(live[victim].first));
+                ASSERT_FALSE(test_map.erase(live[victim].first));
+                erased.push_back(live[victim].first);
+                live.erase(live.begin() + victim);
+            }
+        }
+        run_equality_tests();
+    }
+};
+
+TYPED_TEST_SUITE_P(slot_map_tests);
+
+TYPED_TEST_P(slot_map_tests, RandomOperationTests) {
+    this->run_random_tests(10);
+    this->run_random_tests(1000);
+}
+
+TYPED_TEST_P(slot_map_tests, ClearTests) {
+    this->run_random_tests(100);
+    this->test_map.clear();
+    for(const auto& entry : this->live) {
+        this->erased.push_back(entry.first);
+    }
+    this->live.clear();
+    this->run_equality_tests();
+    this->run_random_tests(100);
+    EXPECT_LE(this->test_map.slot_count(), 200);
+}
+
+TYPED_TEST_P(slot_map_tests, StaleHandleTests) {
+    slot_handle first = this->test_map.insert(this->make_value(1));
+    this->test_map.erase(first);
+    slot_handle second = this->test_map.insert(this->make_value(2));
+    EXPECT_EQ(first.index, second.index);
+    EXPECT_NE(first.generation, second.generation);
+    EXPECT_FALSE(this->test_map.contains(first));
+    EXPECT_THROW(this->test_map.at(first), std::out_of_range);
+    EXPECT_THROW(this->test_map.at(slot_handle()), std::out_of_range);
+    EXPECT_THROW(this->test_map.handle_at(1), std::out_of_range);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(slot_map_tests,
+                            RandomOperationTests,
+                            ClearTests,
+                            StaleHandleTests
+                            );
+
+using slot_map_test_types = ::testing::Types<int, double, std::string>;
+INSTANTIATE_TYPED_TEST_SUITE_P(SlotMap, slot_map_tests, slot_map_test_types);
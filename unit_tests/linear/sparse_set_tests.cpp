@@ -0,0 +1,105 @@
+#include "gtest/gtest.h"
+#include <cstdint>
+#include <map>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "data_structures/src/linear/sparse_set.hpp"
+
+using data_structures::linear::sparse_map;
+using data_structures::linear::sparse_set;
+
+class sparse_set_tests: public ::testing::Test {
+    public:
+        void run_random_tests(unsigned long universe, unsigned int rounds) {
+            sparse_set<std::uint32_t> test_set(universe);
+            std::set<std::uint32_t> reference;
+            std::mt19937 generator(static_cast<unsigned int>(universe));
+            for(unsigned int round = 0; round < rounds; ++round) {
+                std::uint32_t key = generator() % universe;
+                switch(generator() % 5) {
+                    case 0:
+                    case 1:
+                        ASSERT_EQ(test_set.insert(key), reference.insert(key).second);
+                        break;
+                    case 2:
+                    case 3:
+                        ASSERT_EQ(test_set.erase(key), reference.erase(key) == 1);
+                        break;
+                    default:
+                        if(generator() % 50 == 0) {
+                            test_set.clear();
+                            reference.clear();
+                        }
+                        break;
+                }
+                ASSERT_EQ(test_set.contains(key), reference.count(key) == 1);
+            }
+            ASSERT_EQ(test_set.size(), reference.size());
+            std::set<std::uint32_t> members(test_set.begin(), test_set.end());
+            EXPECT_EQ(members, reference);
+            for(std::uint32_t key = 0; key < universe; ++key) {
+                ASSERT_EQ(test_set.contains(key), reference.count(key) == 1);
+            }
+        }
+};
+
+TEST_F(sparse_set_tests, RandomOperationTests) {
+    run_random_tests(1, 100);
+    run_random_tests(64, 2000);
+    run_random_tests(10000, 50000);
+}
+
+TEST_F(sparse_set_tests, UniverseTests) {
+    sparse_set<std::uint16_t> test_set(10);
+    EXPECT_THROW(test_set.insert(10), std::out_of_range);
+    EXPECT_FALSE(test_set.contains(5000));
+    EXPECT_FALSE(test_set.erase(5000));
+    test_set.reserve_universe(6000);
+    EXPECT_TRUE(test_set.insert(5000));
+    EXPECT_EQ(test_set.index_of(5000), 0);
+    EXPECT_THROW(test_set.index_of(4), std::out_of_range);
+    test_set.clear();
+    EXPECT_TRUE(test_set.empty());
+    EXPECT_FALSE(test_set.contains(5000));
+}
+
+TEST(sparse_map_tests, RandomOperationTests) {
+    sparse_map<std::string> test_map(500);
+    std::map<std::uint32_t, std::string> reference;
+    std::mt19937 generator(5);
+    for(unsigned int round = 0; round < 20000; ++round) {
+        std::uint32_t key = generator() % 500;
+        std::string value = std::to_string(round);
+        switch(generator() % 4) {
+            case 0:
+                ASSERT_EQ(test_map.insert(key, value), reference.emplace(key, value).second);
+                break;
+            case 1:
+                ASSERT_EQ(test_map.insert_or_assign(key, value), reference.insert_or_assign(key, value).second);
+                break;
+            case 2:
+                ASSERT_EQ(test_map.erase(key), reference.erase(key) == 1);
+                break;
+            default:
+                test_map[key] += "x";
+                reference[key] += "x";
+                break;
+        }
+    }
+    ASSERT_EQ(test_map.size(), reference.size());
+    std::map<std::uint32_t, std::string> contents;
+    test_map.for_each([&](std::uint32_t key, const std::string& value) { contents.emplace(key, value); });
+    EXPECT_EQ(contents, reference);
+    for(auto& [key, value] : reference) {
+        ASSERT_EQ(test_map.at(key), value);
+        ASSERT_EQ(*test_map.find(key), value);
+    }
+    test_map.clear();
+    EXPECT_TRUE(test_map.empty());
+    EXPECT_EQ(test_map.find(1), nullptr);
+    EXPECT_THROW(test_map.at(1), std::out_of_range);
+}
@@ -0,0 +1,152 @@
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "data_structures/src/linear/string_array.hpp"
+
+using data_structures::linear::string_array;
+
+template<class Offset>
+class string_array_tests: public ::testing::Test {
+    public:
+        std::vector<std::string> make_strings(unsigned int count, unsigned int seed) {
+            std::mt19937 generator(seed);
+            std::vector<std::string> values;
+            for(unsigned int i = 0; i < count; ++i) {
+                std::string value(generator() % 20, '\0');
+                for(char& character : value) {
+                    character = static_cast<char>(generator() % 4 == 0 ? generator() % 256 : 'a' + generator() % 3);
+                }
+                values.push_back(value);
+            }
+            return values;
+        }
+
+    void check_equal(const string_array<Offset>& test_array, const std::vector<std::string>& reference) {
+        ASSERT_EQ(test_array.size(), reference.size());
+        for(unsigned long i = 0; i < reference.size(); ++i) {
+            ASSERT_EQ(test_array[i], reference[i]);
+        }
+        std::vector<std::string> iterated(test_array.begin(), test_array.end());
+        ASSERT_EQ(iterated, reference);
+    }
+
+    void run_append_tests(unsigned int count) {
+        std::vector<std::string> reference = make_strings(count, count);
+        string_array<Offset> pushed;
+        for(const std::string& value : reference) {
+            pushed.push_back(value);
+        }
+        check_equal(pushed, reference);
+
+        string_array<Offset> bulk;
+        bulk.append(reference.begin(), reference.end());
+        check_equal(bulk, reference);
+        EXPECT_TRUE(bulk == pushed);
+
+        string_array<Offset> combined = bulk;
+        combined.append(pushed);
+        std::vector<std::string> doubled = reference;
+        doubled.insert(doubled.end(), reference.begin(), reference.end());
+        check_equal(combined, doubled);
+
+        string_array<Offset> self_appended = pushed;
+        self_appended.append(self_appended);
+        check_equal(self_appended, doubled);
+
+        for(unsigned int i = 0; i < count / 2; ++i) {
+            combined.pop_back();
+            doubled.pop_back();
+        }
+        check_equal(combined, doubled);
+    }
+
+    void run_sort_tests(unsigned int count) {
+        std::vector<std::string> reference = make_strings(count, count + 1);
+        string_array<Offset> test_array;
+        test_array.append(reference.begin(), reference.end());
+
+        auto permutation = test_array.sort_permutation();
+        ASSERT_EQ(permutation.size(), reference.size());
+        for(unsigned long i = 1; i < permutation.size(); ++i) {
+            std::string_view previous = test_array[permutation[i - 1]];
+            std::string_view current = test_array[permutation[i]];
+            ASSERT_TRUE(previous < current || (previous == current && permutation[i - 1] < permutation[i]));
+        }
+
+        test_array.sort();
+        std::sort(reference.begin(), reference.end());
+        check_equal(test_array, reference);
+
+        test_array.sort([](std::string_view first, std::string_view second) { return first.size() > second.size() || (first.size() == second.size() && first < second); });
+        std::sort(reference.begin(), reference.end(), [](const std::string& first, const std::string& second) { return first.size() > second.size() || (first.size() == second.size() && first < second); });
+        check_equal(test_array, reference);
+    }
+};
+
+TYPED_TEST_SUITE_P(string_array_tests);
+
+TYPED_TEST_P(string_array_tests, AppendTests) {
+    this->run_append_tests(0);
+    this->run_append_tests(1);
+    this->run_append_tests(3000);
+}
+
+TYPED_TEST_P(string_array_tests, SortTests) {
+    this->run_sort_tests(0);
+    this->run_sort_tests(1);
+    this->run_sort_tests(20);
+    this->run_sort_tests(5000);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(string_array_tests,
+                            AppendTests,
+                            SortTests
+                            );
+
+using string_array_test_types = ::testing::Types<std::uint32_t, std::uint64_t>;
+INSTANTIATE_TYPED_TEST_SUITE_P(StringArray, string_array_tests, string_array_test_types);
+
+TEST(string_array_access_tests, BoundsTests) {
+    string_array<> test_array = {"alpha", "", "gamma"};
+    EXPECT_EQ(test_array.front(), "alpha");
+    EXPECT_EQ(test_array.back(), "gamma");
+    EXPECT_EQ(test_array.at(1), "");
+    EXPECT_EQ(test_array.char_count(), 10);
+    EXPECT_THROW(test_array.at(3), std::out_of_range);
+
+    std::vector<std::uint32_t> selection = {2, 2, 0};
+    test_array.permute(selection);
+    EXPECT_EQ(test_array.size(), 3);
+    EXPECT_EQ(test_array[0], "gamma");
+    EXPECT_EQ(test_array[1], "gamma");
+    EXPECT_EQ(test_array[2], "alpha");
+    std::vector<std::uint32_t> invalid = {3};
+    EXPECT_THROW(test_array.permute(invalid), std::out_of_range);
+
+    string_array<std::uint8_t> narrow;
+    narrow.push_back(std::string(200, 'x'));
+    EXPECT_THROW(narrow.push_back(std::string(100, 'y')), std::length_error);
+    EXPECT_EQ(narrow.size(), 1);
+    std::vector<std::uint8_t> repeated = {0, 0};
+    EXPECT_THROW(narrow.permute(repeated), std::length_error);
+    EXPECT_EQ(narrow[0], std::string(200, 'x'));
+
+    string_array<> small;
+    for(int i = 0; i < 16; ++i) {
+        small.push_back("abcd");
+    }
+    small.append(small);
+    EXPECT_EQ(small.size(), 32);
+    EXPECT_EQ(small.char_count(), 128);
+    EXPECT_EQ(small[31], "abcd");
+
+    test_array.clear();
+    EXPECT_TRUE(test_array.empty());
+    EXPECT_EQ(test_array.begin(), test_array.end());
+}
@@ -0,0 +1,166 @@
+#include "gtest/gtest.h"
+#include <cstdint>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "data_structures/src/map/adaptive_radix_tree.hpp"
+
+using data_structures::map::adaptive_radix_tree;
+
+template<class Key>
+class adaptive_radix_tree_tests: public ::testing::Test {
+    public:
+        // Strings share long prefixes so compressed paths overflow the inline prefix bytes,
+        // and some keys are prefixes of others.
+        Key make_key(std::mt19937& generator, unsigned int range) {
+            if constexpr(std::is_same_v<Key, std::string>) {
+                static const std::string stems[] = {"", "a", "ab", "/api/v1/users/", "/api/v1/user", "/static/assets/images/very/long/path/"};
+                std::string key = stems[generator() % 6];
+                unsigned int suffix = generator() % range;
+                if(suffix % 3 != 0) {
+                    key += std::to_string(suffix);
+                }
+                return key;
+            }
+            else {
+                return static_cast<Key>(static_cast<long long>(generator() % range) - static_cast<long long>(range / 2)) * static_cast<Key>(977);
+            }
+        }
+
+    void check_equal(const adaptive_radix_tree<Key, int>& tree, const std::map<Key, int>& reference) {
+        ASSERT_EQ(tree.size(), reference.size());
+        std::vector<std::pair<Key, int>> visited;
+        tree.for_each([&](const Key& key, const int& value) {
+            visited.emplace_back(key, value);
+        });
+        std::vector<std::pair<Key, int>> expected(reference.begin(), reference.end());
+        ASSERT_EQ(visited, expected);
+    }
+
+    void run_random_tests(unsigned int range, unsigned int rounds) {
+        adaptive_radix_tree<Key, int> tree;
+        std::map<Key, int> reference;
+        std::mt19937 generator(range);
+        for(unsigned int round = 0; round < rounds; ++round) {
+            Key key = make_key(generator, range);
+            int value = static_cast<int>(round);
+            switch(generator() % 6) {
+                case 0:
+                case 1:
+                    ASSERT_EQ(tree.insert(key, value), reference.emplace(key, value).second);
+                    break;
+                case 2:
+                    ASSERT_EQ(tree.insert_or_assign(key, value), reference.count(key) == 0);
+                    reference[key] = value;
+                    break;
+                case 3:
+                case 4:
+                    ASSERT_EQ(tree.erase(key), reference.erase(key) == 1);
+                    break;
+                default: {
+                    const int* found = tree.find(key);
+                    auto expected = reference.find(key);
+                    ASSERT_EQ(found != nullptr, expected != reference.end());
+                    if(found != nullptr) {
+                        ASSERT_EQ(*found, expected->second);
+                    }
+                    break;
+                }
+            }
+            ASSERT_EQ(tree.contains(key), reference.count(key) == 1);
+            if(round % 1000 == 0) {
+                check_equal(tree, reference);
+            }
+        }
+        check_equal(tree, reference);
+        for(auto iterator = reference.begin(); iterator != reference.end();) {
+            ASSERT_TRUE(tree.erase(iterator->first));
+            iterator = reference.erase(iterator);
+            if(reference.size() % 64 == 0) {
+                check_equal(tree, reference);
+            }
+        }
+        EXPECT_TRUE(tree.empty());
+    }
+};
+
+TYPED_TEST_SUITE_P(adaptive_radix_tree_tests);
+
+TYPED_TEST_P(adaptive_radix_tree_tests, RandomOperationTests) {
+    this->run_random_tests(10, 500);
+    this->run_random_tests(300, 20000);
+    this->run_random_tests(100000, 20000);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(adaptive_radix_tree_tests,
+                            RandomOperationTests
+                            );
+
+using adaptive_radix_tree_test_types = ::testing::Types<std::string, std::int64_t, std::uint32_t, std::int16_t>;
+INSTANTIATE_TYPED_TEST_SUITE_P(AdaptiveRadixTree, adaptive_radix_tree_tests, adaptive_radix_tree_test_types);
+
+TEST(adaptive_radix_tree_node_tests, GrowAndShrinkTests) {
+    adaptive_radix_tree<std::string, int> tree;
+    std::string stem = "shared-prefix-longer-than-inline-";
+    for(int byte = 0; byte < 256; ++byte) {
+        ASSERT_TRUE(tree.insert(stem + static_cast<char>(byte) + "tail", byte));
+    }
+    ASSERT_TRUE(tree.insert(stem, -1));
+    for(int byte = 0; byte < 256; ++byte) {
+        ASSERT_EQ(tree.at(stem + static_cast<char>(byte) + "tail"), byte);
+    }
+    EXPECT_FALSE(tree.contains(stem + "x"));
+    EXPECT_FALSE(tree.contains("shared-prefix-longer-than-inline"));
+    for(int byte = 255; byte >= 1; --byte) {
+        ASSERT_TRUE(tree.erase(stem + static_cast<char>(byte) + "tail"));
+        ASSERT_EQ(tree.at(stem), -1);
+        ASSERT_EQ(tree.at(stem + '\0' + "tail"), 0);
+    }
+    ASSERT_TRUE(tree.erase(stem));
+    EXPECT_EQ(tree.at(stem + '\0' + "tail"), 0);
+    EXPECT_EQ(tree.size(), 1);
+    EXPECT_THROW(tree.at("missing"), std::out_of_range);
+}
+
+TEST(adaptive_radix_tree_node_tests, PrefixScanTests) {
+    adaptive_radix_tree<std::string, int> tree;
+    std::map<std::string, int> reference;
+    std::mt19937 generator(12);
+    const char* routes[] = {"/api/", "/api/v1/", "/api/v2/", "/apiary/", "/static/", "/"};
+    for(int round = 0; round < 3000; ++round) {
+        std::string key = std::string(routes[generator() % 6]) + std::to_string(generator() % 500);
+        tree[key] = round;
+        reference[key] = round;
+    }
+    for(std::string prefix : {"", "/", "/api", "/api/", "/api/v1/1", "/apia", "/static/49", "/nothing", "/api/v1/123456"}) {
+        std::vector<std::pair<std::string, int>> visited;
+        tree.for_each_prefix(prefix, [&](const std::string& key, int value) {
+            visited.emplace_back(key, value);
+        });
+        std::vector<std::pair<std::string, int>> expected;
+        for(auto iterator = reference.lower_bound(prefix); iterator != reference.end() && iterator->first.compare(0, prefix.size(), prefix) == 0; ++iterator) {
+            expected.emplace_back(*iterator);
+        }
+        EXPECT_EQ(visited, expected) << "prefix " << prefix;
+    }
+
+    int visited_count = 0;
+    tree.for_each([&](const std::string&, int&) {
+        return ++visited_count < 10;
+    });
+    EXPECT_EQ(visited_count, 10);
+
+    adaptive_radix_tree<std::string, int> copy(tree);
+    tree.clear();
+    EXPECT_EQ(copy.size(), reference.size());
+    for(const auto& [key, value] : reference) {
+        ASSERT_EQ(copy.at(key), value);
+    }
+    adaptive_radix_tree<std::string, int> moved(std::move(copy));
+    EXPECT_EQ(moved.size(), reference.size());
+    EXPECT_TRUE(copy.empty());
+}
@@ -0,0 +1,87 @@
+#include "gtest/gtest.h"
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "data_structures/src/map/hash_index.hpp"
+
+using data_structures::map::hash_index;
+
+class hash_index_tests: public ::testing::Test {
+    public:
+        using index_type = hash_index<std::string>;
+
+        index_type test_index;
+        std::vector<std::string> keys;
+        std::unordered_map<std::string, index_type::slot_type> test_map;
+
+    auto key_at() {
+        return [this](index_type::slot_type slot) -> const std::string& { return keys[slot]; };
+    }
+
+    void insert(const std::string& key) {
+        test_index.insert(test_index.hash(key), static_cast<index_type::slot_type>(keys.size()));
+        test_map[key] = static_cast<index_type::slot_type>(keys.size());
+        keys.push_back(key);
+    }
+
+    void erase(const std::string& key) {
+        index_type::slot_type slot = test_index.erase(key, key_at());
+        ASSERT_EQ(slot, test_map.at(key));
+        test_map.erase(key);
+        index_type::slot_type last = static_cast<index_type::slot_type>(keys.size() - 1);
+        if(slot != last) {
+            keys[slot] = keys[last];
+            test_index.relocate(test_index.hash(keys[slot]), last, slot);
+            test_map[keys[slot]] = slot;
+        }
+        keys.pop_back();
+    }
+
+    void run_equality_tests(unsigned int key_range) {
+        ASSERT_EQ(test_index.size(), test_map.size());
+        for(unsigned int i = 0; i < key_range; ++i) {
+            std::string key = std::to_string(i);
+            auto found = test_map.find(key);
+            ASSERT_EQ(test_index.find(key, key_at()), found == test_map.end() ? index_type::npos : found->second);
+        }
+    }
+
+    void run_random_tests(unsigned int key_range, unsigned int rounds) {
+        std::mt19937 generator(key_range);
+        for(unsigned int round = 0; round < rounds; ++round) {
+            std::string key = std::to_string(generator() % key_range);
+            if(test_map.count(key)) {
+                erase(key);
+            }
+            else {
+                insert(key);
+            }
+        }
+        run_equality_tests(key_range);
+    }
+};
+
+TEST_F(hash_index_tests, RandomOperationTests) {
+    run_random_tests(10, 100);
+    run_random_tests(1000, 5000);
+    run_random_tests(50000, 100000);
+}
+
+TEST_F(hash_index_tests, GrowthTests) {
+    EXPECT_EQ(test_index.find("missing", key_at()), index_type::npos);
+    EXPECT_EQ(test_index.erase("missing", key_at()), index_type::npos);
+    for(unsigned int i = 0; i < 10000; ++i) {
+        insert(std::to_string(i));
+    }
+    EXPECT_LE(test_index.size() * 8, test_index.bucket_count() * 7);
+    run_equality_tests(10000);
+    test_index.clear();
+    EXPECT_TRUE(test_index.empty());
+    EXPECT_EQ(test_index.find("1", key_at()), index_type::npos);
+
+    EXPECT_THROW(test_index.reserve(1ul << 40), std::length_error);
+    EXPECT_TRUE(test_index.empty());
+}
@@ -0,0 +1,101 @@
+#include "gtest/gtest.h"
+#include <cstdint>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "data_structures/src/map/string_pool.hpp"
+
+using data_structures::map::sharded_string_pool;
+using data_structures::map::string_pool;
+
+class string_pool_tests: public ::testing::Test {
+    public:
+        template<class Pool>
+        void run_random_tests(Pool& pool, unsigned int range, unsigned int rounds) {
+            std::unordered_map<std::string, std::uint32_t> reference;
+            std::mt19937 generator(range);
+            for(unsigned int round = 0; round < rounds; ++round) {
+                std::string value = "token-" + std::to_string(generator() % range);
+                if(generator() % 3 == 0) {
+                    auto expected = reference.find(value);
+                    ASSERT_EQ(pool.find(value), expected == reference.end() ? Pool::npos : expected->second);
+                    continue;
+                }
+                std::uint32_t id = pool.intern(value);
+                auto [existing, inserted] = reference.emplace(value, id);
+                ASSERT_EQ(id, existing->second);
+                ASSERT_EQ(std::string(pool.at(id)), value);
+            }
+            ASSERT_EQ(pool.size(), reference.size());
+            for(const auto& [value, id] : reference) {
+                ASSERT_EQ(pool.find(value), id);
+                ASSERT_EQ(std::string(pool.at(id)), value);
+            }
+        }
+};
+
+TEST_F(string_pool_tests, RandomInternTests) {
+    string_pool<> pool;
+    run_random_tests(pool, 10, 1000);
+    pool.clear();
+    EXPECT_TRUE(pool.empty());
+    run_random_tests(pool, 50000, 100000);
+
+    string_pool<std::uint64_t> wide_pool;
+    run_random_tests(wide_pool, 1000, 10000);
+
+    sharded_string_pool<> sharded_pool;
+    run_random_tests(sharded_pool, 50000, 100000);
+}
+
+TEST_F(string_pool_tests, DenseIdTests) {
+    string_pool<> pool;
+    pool.reserve(4, 16);
+    EXPECT_EQ(pool.intern("b"), 0u);
+    EXPECT_EQ(pool.intern(""), 1u);
+    EXPECT_EQ(pool.intern("a"), 2u);
+    EXPECT_EQ(pool.intern("b"), 0u);
+    EXPECT_EQ(pool.size(), 3);
+    EXPECT_EQ(pool.char_count(), 2);
+    EXPECT_EQ(pool[1], "");
+    EXPECT_TRUE(pool.contains(""));
+    EXPECT_FALSE(pool.contains("c"));
+    EXPECT_EQ(pool.find("c"), string_pool<>::npos);
+    EXPECT_THROW(pool.at(3), std::out_of_range);
+    EXPECT_EQ(pool.strings()[2], "a");
+}
+
+TEST_F(string_pool_tests, ConcurrentInternTests) {
+    sharded_string_pool<8> pool;
+    constexpr unsigned int thread_count = 4;
+    constexpr unsigned int range = 5000;
+    std::vector<std::vector<std::uint32_t>> ids(thread_count, std::vector<std::uint32_t>(range));
+    std::vector<std::thread> threads;
+    for(unsigned int thread = 0; thread < thread_count; ++thread) {
+        threads.emplace_back([&, thread]() {
+            for(unsigned int step = 0; step < range; ++step) {
+                unsigned int value = (step * 7919 + thread * 613) % range;
+                ids[thread][value] = pool.intern("key-" + std::to_string(value));
+            }
+        });
+    }
+    for(std::thread& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(pool.size(), range);
+    std::set<std::uint32_t> distinct;
+    for(unsigned int value = 0; value < range; ++value) {
+        for(unsigned int thread = 1; thread < thread_count; ++thread) {
+            ASSERT_EQ(ids[thread][value], ids[0][value]);
+        }
+        distinct.insert(ids[0][value]);
+        ASSERT_EQ(pool.at(ids[0][value]), "key-" + std::to_string(value));
+        ASSERT_EQ(pool.visit(ids[0][value], [](std::string_view view) { return view.size(); }), ("key-" + std::to_string(value)).size());
+    }
+    EXPECT_EQ(distinct.size(), range);
+}
@@ -0,0 +1,81 @@
+#include "gtest/gtest.h"
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "data_structures/src/linear/dynamic_array.hpp"
+#include "data_structures/src/memory/huge_page_allocator.hpp"
+
+using data_structures::linear::dynamic_array;
+using data_structures::memory::huge_page_allocator;
+using data_structures::memory::huge_page_mode;
+using data_structures::memory::huge_page_options;
+using data_structures::memory::huge_page_size;
+using data_structures::memory::numa_policy;
+
+std::array<huge_page_options, 5> huge_page_option_list = {
+    huge_page_options{huge_page_mode::NONE, numa_policy::LOCAL, 0},
+    huge_page_options{huge_page_mode::TRANSPARENT, numa_policy::LOCAL, 0},
+    huge_page_options{huge_page_mode::EXPLICIT, numa_policy::LOCAL, 0},
+    huge_page_options{huge_page_mode::TRANSPARENT, numa_policy::BIND, 1},
+    huge_page_options{huge_page_mode::TRANSPARENT, numa_policy::INTERLEAVE, 1},
+};
+
+class huge_page_allocator_tests: public ::testing::Test {
+    public:
+        using huge_array = dynamic_array<std::uint64_t, huge_page_allocator<std::uint64_t>>;
+
+    void run_allocation_tests(const huge_page_options& options, std::size_t num_elements) {
+        huge_page_allocator<std::uint64_t> alloc(options);
+        std::uint64_t* buffer = alloc.allocate(num_elements);
+        ASSERT_NE(buffer, nullptr);
+        if(options.mode != huge_page_mode::NONE && num_elements * sizeof(std::uint64_t) >= options.mmap_threshold) {
+            EXPECT_EQ(reinterpret_cast<std::uintptr_t>(buffer) % huge_page_size, 0);
+        }
+        for(std::size_t i = 0; i < num_elements; ++i) {
+            buffer[i] = i;
+        }
+        for(std::size_t i = 0; i < num_elements; i += 4096) {
+            EXPECT_EQ(buffer[i], i);
+        }
+        alloc.deallocate(buffer, num_elements);
+    }
+
+    void run_container_tests(const huge_page_options& options, std::size_t num_elements) {
+        huge_array test_arr{huge_page_allocator<std::uint64_t>(options)};
+        std::vector<std::uint64_t> test_vec;
+        for(std::size_t i = 0; i < num_elements; ++i) {
+            test_arr.push_back(i * 7);
+            test_vec.push_back(i * 7);
+        }
+        EXPECT_EQ(test_arr.get_allocator(), huge_page_allocator<std::uint64_t>(options));
+
+        huge_array copy_arr = test_arr;
+        EXPECT_EQ(copy_arr.get_allocator(), test_arr.get_allocator());
+        ASSERT_EQ(copy_arr.size(), test_vec.size());
+        for(std::size_t i = 0; i < test_vec.size(); i += 997) {
+            EXPECT_EQ(test_arr[i], test_vec[i]);
+            EXPECT_EQ(copy_arr[i], test_vec[i]);
+        }
+    }
+};
+
+TEST_F(huge_page_allocator_tests, SmallAllocationTests) {
+    for(const huge_page_options& options: huge_page_option_list) {
+        this->run_allocation_tests(options, 1);
+        this->run_allocation_tests(options, 1000);
+    }
+}
+
+TEST_F(huge_page_allocator_tests, LargeAllocationTests) {
+    for(const huge_page_options& options: huge_page_option_list) {
+        this->run_allocation_tests(options, huge_page_size / sizeof(std::uint64_t));
+        this->run_allocation_tests(options, 3 * huge_page_size / sizeof(std::uint64_t) + 5);
+    }
+}
+
+TEST_F(huge_page_allocator_tests, ContainerTests) {
+    for(const huge_page_options& options: huge_page_option_list) {
+        this->run_container_tests(options, 1 << 20);
+    }
+}
@@ -0,0 +1,114 @@
+#include "gtest/gtest.h"
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+#include "data_structures/src/perf/benchmark_runner.hpp"
+#include "data_structures/src/perf/perf_counters.hpp"
+
+using data_structures::perf::benchmark_options;
+using data_structures::perf::benchmark_runner;
+using data_structures::perf::counter;
+using data_structures::perf::counter_count;
+using data_structures::perf::counter_values;
+using data_structures::perf::perf_counters;
+using data_structures::perf::perf_scope;
+
+namespace {
+    std::uint64_t busy_work(unsigned long iterations) {
+        std::uint64_t value = 1;
+        for(unsigned long step = 0; step < iterations; ++step) {
+            value = value * 6364136223846793005ull + step;
+            data_structures::perf::do_not_optimize(value);
+        }
+        return value;
+    }
+}
+
+// Hosts without a PMU, or sandboxes that block perf_event_open, leave every hardware counter
+// unavailable; these tests check whichever case the host provides.
+TEST(perf_counters_tests, ScopeTests) {
+    perf_counters counters;
+    counter_values delta;
+    {
+        perf_scope scope(counters, delta);
+        busy_work(1000000);
+    }
+    EXPECT_GT(delta.nanoseconds, 0u);
+    bool any_available = false;
+    for(unsigned int index = 0; index < counter_count; ++index) {
+        counter which = static_cast<counter>(index);
+        EXPECT_EQ(delta.has(which), counters.available(which));
+        any_available = any_available || counters.available(which);
+        if(!delta.has(which)) {
+            EXPECT_EQ(delta[which], 0u);
+        }
+    }
+    EXPECT_EQ(counters.any_available(), any_available);
+    if(counters.available(counter::INSTRUCTIONS)) {
+        EXPECT_GT(delta[counter::INSTRUCTIONS], 1000000u);
+    }
+    if(counters.available(counter::CYCLES)) {
+        EXPECT_GT(delta[counter::CYCLES], 0u);
+    }
+}
+
+TEST(perf_counters_tests, ValueArithmeticTests) {
+    counter_values earlier;
+    counter_values later;
+    for(unsigned int index = 0; index < counter_count; ++index) {
+        earlier.available[index] = true;
+        later.available[index] = index != 2;
+        earlier.counts[index] = 10 * index;
+        later.counts[index] = 25 * index;
+    }
+    earlier.counts[4] = 200;
+    earlier.nanoseconds = 100;
+    later.nanoseconds = 350;
+
+    counter_values delta = later - earlier;
+    EXPECT_EQ(delta.nanoseconds, 250u);
+    EXPECT_EQ(delta[counter::INSTRUCTIONS], 15u);
+    EXPECT_EQ(delta[counter::BRANCH_MISSES], 0u);
+    EXPECT_FALSE(delta.has(counter::L1D_MISSES));
+    EXPECT_TRUE(delta.has(counter::CYCLES));
+
+    counter_values total = delta;
+    total += delta;
+    EXPECT_EQ(total.nanoseconds, 500u);
+    EXPECT_EQ(total[counter::DTLB_MISSES], 150u);
+    EXPECT_FALSE(total.has(counter::L1D_MISSES));
+}
+
+TEST(perf_counters_tests, BenchmarkRunnerTests) {
+    benchmark_options options;
+    options.repetitions = 3;
+    options.filter = "busy";
+    benchmark_runner runner(options);
+
+    unsigned int calls = 0;
+    EXPECT_TRUE(runner.run("busy/loop", 100000, [&]() {
+        ++calls;
+        busy_work(100000);
+    }));
+    EXPECT_FALSE(runner.run("skipped", 1, [&]() { ++calls; }));
+    EXPECT_EQ(calls, 4u);
+    ASSERT_EQ(runner.result_count(), 1u);
+
+    const auto& result = runner.result(0);
+    EXPECT_EQ(result.name, "busy/loop");
+    EXPECT_EQ(result.operations, 100000u);
+    EXPECT_GT(result.nanoseconds_per_operation(), 0.0);
+    if(runner.counters().available(counter::INSTRUCTIONS)) {
+        EXPECT_GT(result.per_operation(counter::INSTRUCTIONS), 1.0);
+    }
+
+    std::ostringstream output;
+    runner.report(output);
+    std::string report = output.str();
+    EXPECT_NE(report.find("busy/loop"), std::string::npos);
+    EXPECT_NE(report.find("dTLB misses"), std::string::npos);
+    if(!runner.counters().any_available()) {
+        EXPECT_NE(report.find("n/a"), std::string::npos);
+    }
+}
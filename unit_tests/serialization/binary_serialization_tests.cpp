@@ -0,0 +1,207 @@
+#include "gtest/gtest.h"
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+#include "data_structures/src/linear/bounds_check.hpp"
+#include "data_structures/src/linear/dynamic_array.hpp"
+#include "data_structures/src/linear/dynamic_array_instrumentation.hpp"
+#include "data_structures/src/serialization/binary_serialization.hpp"
+
+using data_structures::linear::counting_instrumentation;
+using data_structures::linear::dynamic_array;
+using data_structures::linear::no_instrumentation;
+using data_structures::linear::unchecked;
+using data_structures::serialization::payload_alignment;
+using data_structures::serialization::read_from;
+using data_structures::serialization::serialization_error;
+using data_structures::serialization::view_from;
+using data_structures::serialization::write_to;
+
+struct serialization_test_record {
+    std::uint32_t id;
+    float weight;
+    std::uint64_t timestamp;
+
+    bool operator==(const serialization_test_record& other) const = default;
+};
+
+template<class T>
+T make_test_value(unsigned int seed) {
+    if constexpr(std::is_same_v<T, serialization_test_record>) {
+        return serialization_test_record{seed, seed * 0.5f, seed * 1000ULL};
+    }
+    else {
+        return static_cast<T>(seed * 3 + 1);
+    }
+}
+
+template<class T>
+class binary_serialization_tests: public ::testing::Test {
+    public:
+        dynamic_array<T> test_arr;
+
+    void fill_test_array(unsigned int num_elements) {
+        test_arr.clear();
+        for(unsigned int i = 0; i < num_elements; ++i) {
+            test_arr.push_back(make_test_value<T>(i));
+        }
+    }
+
+    void run_equality_tests(const dynamic_array<T>& restored_arr) {
+        ASSERT_EQ(restored_arr.size(), test_arr.size());
+        for(unsigned int i = 0; i < test_arr.size(); ++i) {
+            EXPECT_EQ(restored_arr[i], test_arr[i]);
+        }
+    }
+
+    std::string serialize_to_string() {
+        std::ostringstream output;
+        write_to(output, test_arr);
+        return output.str();
+    }
+
+    void run_stream_round_trip_tests(unsigned int num_elements) {
+        fill_test_array(num_elements);
+        std::istringstream input(serialize_to_string());
+        dynamic_array<T> restored_arr;
+        read_from(input, restored_arr);
+        run_equality_tests(restored_arr);
+    }
+
+    void run_file_descriptor_round_trip_tests(unsigned int num_elements) {
+        fill_test_array(num_elements);
+        std::FILE* snapshot_file = std::tmpfile();
+        ASSERT_NE(snapshot_file, nullptr);
+        int fd = fileno(snapshot_file);
+
+        write_to(fd, test_arr);
+        ASSERT_EQ(::lseek(fd, 0, SEEK_SET), 0);
+
+        dynamic_array<T> restored_arr;
+        read_from(fd, restored_arr);
+        run_equality_tests(restored_arr);
+        std::fclose(snapshot_file);
+    }
+
+    void run_view_tests(unsigned int num_elements) {
+        fill_test_array(num_elements);
+        std::string snapshot = serialize_to_string();
+        EXPECT_EQ(snapshot.size(), payload_alignment + num_elements * sizeof(T));
+
+        std::vector<std::uint64_t> aligned_buffer((snapshot.size() + 7) / 8 + 8);
+        std::memcpy(aligned_buffer.data(), snapshot.data(), snapshot.size());
+
+        std::span<const T> view = view_from<T>(aligned_buffer.data(), snapshot.size());
+        ASSERT_EQ(view.size(), test_arr.size());
+        for(unsigned int i = 0; i < view.size(); ++i) {
+            EXPECT_EQ(view[i], test_arr[i]);
+        }
+        if(num_elements > 0) {
+            EXPECT_EQ(reinterpret_cast<const char*>(view.data()), reinterpret_cast<const char*>(aligned_buffer.data()) + payload_alignment);
+        }
+    }
+
+    void run_corruption_tests(unsigned int num_elements) {
+        fill_test_array(num_elements);
+        std::string snapshot = serialize_to_string();
+        std::vector<std::uint64_t> aligned_buffer((snapshot.size() + 7) / 8);
+
+        std::string corrupt_payload = snapshot;
+        corrupt_payload[payload_alignment] ^= 0x5A;
+        std::memcpy(aligned_buffer.data(), corrupt_payload.data(), corrupt_payload.size());
+        EXPECT_THROW(view_from<T>(aligned_buffer.data(), corrupt_payload.size()), serialization_error);
+        EXPECT_NO_THROW(view_from<T>(aligned_buffer.data(), corrupt_payload.size(), false));
+
+        std::istringstream corrupt_input(corrupt_payload);
+        dynamic_array<T> restored_arr;
+        EXPECT_THROW(read_from(corrupt_input, restored_arr), serialization_error);
+        EXPECT_EQ(restored_arr.size(), 0u);
+
+        std::string truncated = snapshot.substr(0, snapshot.size() - 1);
+        std::istringstream truncated_input(truncated);
+        restored_arr.push_back(this->test_arr[0]);
+        EXPECT_THROW(read_from(truncated_input, restored_arr), serialization_error);
+        EXPECT_EQ(restored_arr.size(), 0u);
+        EXPECT_THROW(view_from<T>(aligned_buffer.data(), truncated.size()), serialization_error);
+
+        std::string bad_magic = snapshot;
+        bad_magic[0] ^= 0x01;
+        std::memcpy(aligned_buffer.data(), bad_magic.data(), bad_magic.size());
+        EXPECT_THROW(view_from<T>(aligned_buffer.data(), bad_magic.size()), serialization_error);
+
+        std::memcpy(aligned_buffer.data(), snapshot.data(), snapshot.size());
+        EXPECT_THROW(view_from<char>(aligned_buffer.data(), snapshot.size()), serialization_error);
+    }
+};
+
+TYPED_TEST_SUITE_P(binary_serialization_tests);
+
+TYPED_TEST_P(binary_serialization_tests, StreamRoundTripTests) {
+    this->run_stream_round_trip_tests(0);
+    this->run_stream_round_trip_tests(1);
+    this->run_stream_round_trip_tests(1000);
+}
+
+TYPED_TEST_P(binary_serialization_tests, FileDescriptorRoundTripTests) {
+    this->run_file_descriptor_round_trip_tests(0);
+    this->run_file_descriptor_round_trip_tests(1000);
+}
+
+TYPED_TEST_P(binary_serialization_tests, ViewTests) {
+    this->run_view_tests(0);
+    this->run_view_tests(3);
+    this->run_view_tests(1000);
+}
+
+TYPED_TEST_P(binary_serialization_tests, CorruptionTests) {
+    this->run_corruption_tests(100);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(binary_serialization_tests,
+                            StreamRoundTripTests,
+                            FileDescriptorRoundTripTests,
+                            ViewTests,
+                            CorruptionTests
+                            );
+
+using binary_serialization_test_types = ::testing::Types<std::uint32_t, double, serialization_test_record>;
+INSTANTIATE_TYPED_TEST_SUITE_P(BinarySerialization, binary_serialization_tests, binary_serialization_test_types);
+
+namespace {
+    struct serialization_test_site {
+        static constexpr const char* name = "serialization_tests";
+    };
+}
+
+// Arrays with a non-default instrumentation or bounds check policy serialize the same way.
+TEST(binary_serialization_policy_tests, PolicyRoundTripTests) {
+    using unchecked_array = dynamic_array<std::uint32_t, std::allocator<std::uint32_t>, no_instrumentation, unchecked>;
+    using counted_array = dynamic_array<std::uint32_t, std::allocator<std::uint32_t>, counting_instrumentation<serialization_test_site>>;
+
+    unchecked_array unchecked_arr;
+    counted_array counted_arr;
+    for(std::uint32_t i = 0; i < 100; ++i) {
+        unchecked_arr.push_back(i * 7);
+        counted_arr.push_back(i * 11);
+    }
+
+    std::ostringstream unchecked_output;
+    write_to(unchecked_output, unchecked_arr);
+    std::istringstream unchecked_input(unchecked_output.str());
+    unchecked_array unchecked_restored;
+    read_from(unchecked_input, unchecked_restored);
+    EXPECT_EQ(unchecked_restored, unchecked_arr);
+
+    std::ostringstream counted_output;
+    write_to(counted_output, counted_arr);
+    std::istringstream counted_input(counted_output.str());
+    counted_array counted_restored;
+    read_from(counted_input, counted_restored);
+    EXPECT_EQ(counted_restored, counted_arr);
+    EXPECT_GE(counted_restored.get_instrumentation().stats().allocations, 1u);
+}
@@ -0,0 +1,103 @@
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "data_structures/src/linear/dynamic_array.hpp"
+#include "data_structures/src/sort/pdq_sort.hpp"
+
+using data_structures::linear::dynamic_array;
+using data_structures::sort::pdq_sort;
+
+template<class T>
+class pdq_sort_tests: public ::testing::Test {
+    public:
+        T make_value(std::mt19937& generator, unsigned int range) {
+            if constexpr(std::is_same_v<T, std::string>) {
+                return std::to_string(generator() % range);
+            }
+            else {
+                return static_cast<T>(generator() % range);
+            }
+        }
+
+    template<class Compare = std::less<T>>
+    void run_sort_tests(std::vector<T> values, Compare compare = Compare()) {
+        dynamic_array<T> test_array;
+        for(const T& value : values) {
+            test_array.push_back(value);
+        }
+        pdq_sort(test_array, compare);
+        std::sort(values.begin(), values.end(), compare);
+        ASSERT_EQ(test_array.size(), values.size());
+        for(unsigned long i = 0; i < values.size(); ++i) {
+            ASSERT_EQ(test_array[i], values[i]);
+        }
+    }
+
+    std::vector<T> make_random(unsigned int test_size, unsigned int range) {
+        std::mt19937 generator(test_size + range);
+        std::vector<T> values;
+        for(unsigned int i = 0; i < test_size; ++i) {
+            values.push_back(make_value(generator, range));
+        }
+        return values;
+    }
+};
+
+TYPED_TEST_SUITE_P(pdq_sort_tests);
+
+TYPED_TEST_P(pdq_sort_tests, RandomTests) {
+    for(unsigned int test_size : {0u, 1u, 2u, 5u, 16u, 17u, 23u, 24u, 100u, 129u, 10000u}) {
+        this->run_sort_tests(this->make_random(test_size, 1000000));
+    }
+    this->run_sort_tests(this->make_random(5000, 1000000), std::greater<TypeParam>());
+}
+
+TYPED_TEST_P(pdq_sort_tests, PatternTests) {
+    std::vector<TypeParam> values = this->make_random(20000, 1000000);
+    std::sort(values.begin(), values.end());
+    this->run_sort_tests(values);
+    std::reverse(values.begin(), values.end());
+    this->run_sort_tests(values);
+
+    this->run_sort_tests(this->make_random(20000, 3));
+    this->run_sort_tests(this->make_random(20000, 1));
+
+    std::vector<TypeParam> organ_pipe = this->make_random(10000, 1000000);
+    std::sort(organ_pipe.begin(), organ_pipe.begin() + 5000);
+    std::sort(organ_pipe.begin() + 5000, organ_pipe.end(), std::greater<TypeParam>());
+    this->run_sort_tests(organ_pipe);
+
+    std::vector<TypeParam> nearly_sorted = values;
+    std::sort(nearly_sorted.begin(), nearly_sorted.end());
+    std::mt19937 generator(1);
+    for(unsigned int i = 0; i < 20; ++i) {
+        std::swap(nearly_sorted[generator() % nearly_sorted.size()], nearly_sorted[generator() % nearly_sorted.size()]);
+    }
+    this->run_sort_tests(nearly_sorted);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(pdq_sort_tests,
+                            RandomTests,
+                            PatternTests
+                            );
+
+using pdq_sort_test_types = ::testing::Types<int, unsigned long, double, std::string>;
+INSTANTIATE_TYPED_TEST_SUITE_P(PdqSort, pdq_sort_tests, pdq_sort_test_types);
+
+TEST(pdq_sort_adversarial_tests, HeapsortFallbackTests) {
+    std::vector<int> values(50000);
+    for(unsigned int i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<int>(i % 2 == 0 ? i : values.size() - i);
+    }
+    long comparisons = 0;
+    std::vector<int> expected = values;
+    std::sort(expected.begin(), expected.end());
+    pdq_sort(values.data(), values.data() + values.size(), [&](int first, int second) { ++comparisons; return first < second; });
+    EXPECT_EQ(values, expected);
+    EXPECT_LT(comparisons, 50000L * 40);
+}
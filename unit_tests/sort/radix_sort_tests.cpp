@@ -0,0 +1,165 @@
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "data_structures/src/linear/dynamic_array.hpp"
+#include "data_structures/src/sort/radix_sort.hpp"
+
+using data_structures::linear::dynamic_array;
+using data_structures::sort::radix_key;
+using data_structures::sort::radix_sort;
+
+template<class T>
+class radix_sort_tests: public ::testing::Test {
+    public:
+        T make_value(std::mt19937_64& generator) {
+            if constexpr(std::is_floating_point_v<T>) {
+                std::uniform_real_distribution<T> distribution(-1e6, 1e6);
+                return distribution(generator);
+            }
+            else {
+                return static_cast<T>(generator());
+            }
+        }
+
+    void run_sort_tests(unsigned int test_size) {
+        std::mt19937_64 generator(test_size);
+        dynamic_array<T> test_array;
+        std::vector<T> values;
+        for(unsigned int i = 0; i < test_size; ++i) {
+            T value = make_value(generator);
+            test_array.push_back(value);
+            values.push_back(value);
+        }
+        radix_sort(test_array);
+        std::sort(values.begin(), values.end());
+        ASSERT_EQ(test_array.size(), values.size());
+        for(unsigned long i = 0; i < values.size(); ++i) {
+            ASSERT_EQ(test_array[i], values[i]);
+        }
+    }
+
+    void run_extreme_value_tests() {
+        std::vector<T> values = {std::numeric_limits<T>::max(), std::numeric_limits<T>::lowest(), T(0), T(1), std::numeric_limits<T>::min()};
+        if constexpr(std::is_signed_v<T>) {
+            values.push_back(T(-1));
+        }
+        std::mt19937_64 generator(3);
+        for(unsigned int i = 0; i < 200; ++i) {
+            values.push_back(make_value(generator));
+        }
+        std::vector<T> scratch(values.size());
+        std::vector<T> expected = values;
+        radix_sort(std::span<T>(values), std::span<T>(scratch));
+        std::sort(expected.begin(), expected.end());
+        EXPECT_EQ(values, expected);
+    }
+};
+
+TYPED_TEST_SUITE_P(radix_sort_tests);
+
+TYPED_TEST_P(radix_sort_tests, RandomTests) {
+    this->run_sort_tests(0);
+    this->run_sort_tests(1);
+    this->run_sort_tests(64);
+    this->run_sort_tests(65);
+    this->run_sort_tests(20000);
+}
+
+TYPED_TEST_P(radix_sort_tests, ExtremeValueTests) {
+    this->run_extreme_value_tests();
+}
+
+REGISTER_TYPED_TEST_SUITE_P(radix_sort_tests,
+                            RandomTests,
+                            ExtremeValueTests
+                            );
+
+using radix_sort_test_types = ::testing::Types<std::uint8_t, std::int16_t, std::uint32_t, std::int32_t, std::uint64_t, std::int64_t, float, double>;
+INSTANTIATE_TYPED_TEST_SUITE_P(RadixSort, radix_sort_tests, radix_sort_test_types);
+
+TEST(radix_sort_record_tests, StableKeyExtractionTests) {
+    struct record {
+        std::int32_t key;
+        std::string name;
+    };
+    dynamic_array<record> records;
+    std::vector<record> expected;
+    std::mt19937 generator(9);
+    for(unsigned int i = 0; i < 5000; ++i) {
+        record value{static_cast<std::int32_t>(generator() % 200) - 100, std::to_string(i)};
+        records.push_back(value);
+        expected.push_back(value);
+    }
+    radix_sort(records, [](const record& value) { return value.key; });
+    std::stable_sort(expected.begin(), expected.end(), [](const record& first, const record& second) { return first.key < second.key; });
+    for(unsigned long i = 0; i < expected.size(); ++i) {
+        ASSERT_EQ(records[i].key, expected[i].key);
+        ASSERT_EQ(records[i].name, expected[i].name);
+    }
+}
+
+TEST(radix_sort_record_tests, KeyOrderingTests) {
+    EXPECT_LT(radix_key(-0.0), radix_key(0.0));
+    EXPECT_LT(radix_key(-std::numeric_limits<double>::infinity()), radix_key(-1e300));
+    EXPECT_LT(radix_key(1e300), radix_key(std::numeric_limits<double>::infinity()));
+    EXPECT_LT(radix_key(std::int8_t(-128)), radix_key(std::int8_t(127)));
+
+    std::vector<int> values(10);
+    std::vector<int> scratch(5);
+    EXPECT_THROW(radix_sort(std::span<int>(values), std::span<int>(scratch)), std::invalid_argument);
+}
+
+namespace {
+    // Stateful allocator that records how many bytes were requested through its own state, so
+    // a test can tell whether a temporary used it or a default-constructed one.
+    template<class T>
+    struct tracking_allocator {
+        using value_type = T;
+
+        std::shared_ptr<std::size_t> bytes;
+
+        explicit tracking_allocator(std::shared_ptr<std::size_t> counter) : bytes(std::move(counter)) {}
+
+        template<class U>
+        tracking_allocator(const tracking_allocator<U>& other) : bytes(other.bytes) {}
+
+        T* allocate(std::size_t count) {
+            *bytes += count * sizeof(T);
+            return std::allocator<T>().allocate(count);
+        }
+
+        void deallocate(T* pointer, std::size_t count) {
+            std::allocator<T>().deallocate(pointer, count);
+        }
+
+        template<class U>
+        bool operator==(const tracking_allocator<U>& other) const {
+            return bytes == other.bytes;
+        }
+    };
+}
+
+TEST(radix_sort_record_tests, ScratchAllocatorTests) {
+    auto bytes = std::make_shared<std::size_t>(0);
+    tracking_allocator<std::uint32_t> allocator(bytes);
+    dynamic_array<std::uint32_t, tracking_allocator<std::uint32_t>> values(allocator);
+    values.reserve(4096);
+    for(std::uint32_t i = 0; i < 4096; ++i) {
+        values.push_back(4095 - i);
+    }
+    std::size_t before = *bytes;
+    radix_sort(values);
+    EXPECT_GE(*bytes - before, 4096 * sizeof(std::uint32_t));
+    for(std::uint32_t i = 0; i < 4096; ++i) {
+        ASSERT_EQ(values[i], i);
+    }
+}
@@ -0,0 +1,44 @@
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "data_structures/src/sort/sorting_network.hpp"
+
+using data_structures::sort::max_network_size;
+using data_structures::sort::network_sort;
+
+TEST(sorting_network_tests, ZeroOneTests) {
+    for(std::size_t size = 0; size <= max_network_size; ++size) {
+        for(unsigned int pattern = 0; pattern < (1u << size); ++pattern) {
+            std::vector<int> values(size);
+            for(std::size_t i = 0; i < size; ++i) {
+                values[i] = (pattern >> i) & 1;
+            }
+            network_sort(values.data(), size);
+            ASSERT_TRUE(std::is_sorted(values.begin(), values.end())) << "size " << size << " pattern " << pattern;
+        }
+    }
+}
+
+TEST(sorting_network_tests, RandomTests) {
+    std::mt19937 generator(4);
+    for(std::size_t size = 0; size <= max_network_size; ++size) {
+        std::vector<std::string> values;
+        for(std::size_t i = 0; i < size; ++i) {
+            values.push_back(std::to_string(generator() % 100));
+        }
+        std::vector<std::string> expected = values;
+        std::sort(expected.begin(), expected.end(), std::greater<std::string>());
+        network_sort(values.data(), size, std::greater<std::string>());
+        EXPECT_EQ(values, expected);
+    }
+
+    double fixed[8] = {3.5, -1.0, 8.25, 0.0, -7.5, 2.0, 2.0, 1.0};
+    network_sort<8>(fixed);
+    EXPECT_TRUE(std::is_sorted(fixed, fixed + 8));
+    EXPECT_THROW(network_sort(fixed, max_network_size + 1), std::length_error);
+}